@@ -25,9 +25,35 @@ _.defaults <- function(obj, defaults) {
 //
 ::hikari.internal._loaded <- { };
 
-// Globals that store properties of the hero.
-::heroX <- 0
-::heroY <- 0
+//
+// Per-frame state of the world. The engine fills this in once per frame, so
+// read from it rather than keeping copies around.
+//
+::world <- {
+    heroId = -1,
+    heroX = 0,
+    heroY = 0,
+    heroBottomY = 0,
+    isHeroShooting = false
+};
+
+//
+// Updates a batch of behaviors in one go; called by the engine once per frame
+// rather than calling into each behavior separately. Slots are cleared as they
+// are visited so the engine's array doesn't keep behaviors alive.
+//
+::hikari.internal.updateBehaviors <- function(behaviors, count, dt) {
+    for(local i = 0; i < count; ++i) {
+        local behavior = behaviors[i];
+        behaviors[i] = null;
+
+        try {
+            behavior.update(dt);
+        } catch(error) {
+            ::log("Error updating behavior: " + error);
+        }
+    }
+};
 
 function require(fileName, reload = false) {
     local _loaded = ::hikari.internal._loaded;
@@ -17,7 +17,7 @@ class AppearingBlockBehavior extends DoodadBehavior {
         base.attachHost(newHost, instanceConfig);
 
         if(host) {
-            host.changeAnimation(("animation" in classConfig) ? classConfig.animation : "appearing-block-blue");
+            changeAnimation(("animation" in classConfig) ? classConfig.animation : "appearing-block-blue");
             host.isObstacle = true;
             host.isShielded = false;
             host.isPhasing = true;
@@ -17,7 +17,7 @@
                 switch(state) {
                     case State.IDLE:
                         if(enteringNewState) {
-                            host.changeAnimation("idle");
+                            changeAnimation("idle");
                             host.velocityX = 0;
                             host.isShielded = true;
                             enteringNewState = false;
@@ -48,7 +48,7 @@
                     case State.JUMPING:
                         if(enteringNewState) {
                             facePlayer();
-                            host.changeAnimation("jumping");
+                            changeAnimation("jumping");
                             host.velocityY = -5.0;
                             enteringNewState = false;
                         }
@@ -20,7 +20,7 @@ class DoodadBehavior extends EnemyBehavior {
         base.attachHost(newHost, instanceConfig);
 
         if(host) {
-            host.changeAnimation(("animation" in classConfig) ? classConfig.animation : "default");
+            changeAnimation(("animation" in classConfig) ? classConfig.animation : "default");
             host.isObstacle = true;
             host.isShielded = false;
             host.isPhasing = false;
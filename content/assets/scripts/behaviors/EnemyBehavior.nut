@@ -21,6 +21,13 @@ class EnemyBehavior {
      */
     host = null;
 
+    /**
+     * Handles of the host's animations, by name. Filled in as animations are
+     * used; see changeAnimation().
+     * @type {Table}
+     */
+    animationHandles = null;
+
     /**
      * Constructor. Takes a configuration table (optional).
      *
@@ -47,6 +54,7 @@ class EnemyBehavior {
      */
     function attachHost(newHost, instanceConfig = {}) {
         host = newHost;
+        animationHandles = {};
     }
 
     /**
@@ -55,6 +63,7 @@ class EnemyBehavior {
      */
     function detachHost() {
         host = null;
+        animationHandles = null;
     }
 
     /**
@@ -115,13 +124,29 @@ class EnemyBehavior {
 
     }
 
+    /**
+     * Changes the host's animation. Each name is looked up in the engine the
+     * first time it is used, and only its handle is passed after that.
+     *
+     * @param {String} animationName the name of the animation to play
+     */
+    function changeAnimation(animationName) {
+        if(host != null) {
+            if(!(animationName in animationHandles)) {
+                animationHandles[animationName] <- host.getAnimationHandle(animationName);
+            }
+
+            host.changeAnimationByHandle(animationHandles[animationName]);
+        }
+    }
+
     /**
      * Causes the enemy to turn toward the player.
      */
     function facePlayer() {
         if(host != null) {
             local hostX = host.getX();
-            local targetX = ::heroX;
+            local targetX = ::world.heroX;
 
             // If I'm to the right of the hero, face left, otherwise face right
             if(hostX > targetX) {
@@ -35,7 +35,7 @@ class FallingPlatformBehavior extends DoodadBehavior {
         base.attachHost(newHost, instanceConfig);
 
         if(host) {
-            host.changeAnimation(("animation" in classConfig) ? classConfig.animation : "destructable-wall-vertical-green");
+            changeAnimation(("animation" in classConfig) ? classConfig.animation : "destructable-wall-vertical-green");
             host.isObstacle = true;
             host.isShielded = false;
             host.isPhasing = true;
@@ -47,7 +47,7 @@ class FallingPlatformBehavior extends DoodadBehavior {
 
     function handleObjectTouch(otherId) {
         if(host) {
-            if(otherId == ::heroId) {
+            if(otherId == ::world.heroId) {
                 shouldCount = true;
                 // host.isGravitated = true;
             }
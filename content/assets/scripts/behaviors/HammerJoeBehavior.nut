@@ -29,7 +29,7 @@ class HammerJoeBehavior extends EnemyBehavior {
                 case State.IDLE:
                     if(enteringNewState) {
                         facePlayer();
-                        host.changeAnimation("idle");
+                        changeAnimation("idle");
                         host.isShielded = true;
                         enteringNewState = false;
                     }
@@ -42,7 +42,7 @@ class HammerJoeBehavior extends EnemyBehavior {
                     break;
                 case State.PRESHOOTING:
                     if(enteringNewState) {
-                        host.changeAnimation("open-mask");
+                        changeAnimation("open-mask");
                         host.isShielded = false;
                         enteringNewState = false;
                     }
@@ -55,7 +55,7 @@ class HammerJoeBehavior extends EnemyBehavior {
                     break;
                 case State.SHOOTING:
                     if(enteringNewState) {
-                        host.changeAnimation("shooting");
+                        changeAnimation("shooting");
                         enteringNewState = false;
                         host.fireWeapon();
                     }
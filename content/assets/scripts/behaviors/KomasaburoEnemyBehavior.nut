@@ -29,7 +29,7 @@ class KomasaburoEnemyBehavior extends EnemyBehavior {
                 case State.IDLE:
                     if(enteringNewState) {
                         facePlayer();
-                        host.changeAnimation("idle");
+                        changeAnimation("idle");
                         enteringNewState = false;
                     }
 
@@ -42,7 +42,7 @@ class KomasaburoEnemyBehavior extends EnemyBehavior {
                 case State.SHOOTING:
                     if(enteringNewState) {
                         facePlayer();
-                        host.changeAnimation("shooting");
+                        changeAnimation("shooting");
                         host.fireWeapon();
                         enteringNewState = false;
                     }
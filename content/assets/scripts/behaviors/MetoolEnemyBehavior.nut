@@ -92,7 +92,7 @@
 
                 if(host) {
                     host.isShielded = true;
-                    host.changeAnimation("guarding");
+                    changeAnimation("guarding");
                     host.velocityX = 0.0;
                 }
             }
@@ -103,9 +103,9 @@
             }
 
             if(stateTimer >= 1.0) {
-                local distanceX = abs(::heroX - host.getX());
+                local distanceX = abs(::world.heroX - host.getX());
 
-                if(distanceX <= ATTACK_RANGE_X && !isHeroShooting) {
+                if(distanceX <= ATTACK_RANGE_X && !::world.isHeroShooting) {
                     setState("attacking");
                 }
             }
@@ -122,7 +122,7 @@
 
                 if(host) {
                     host.isShielded = false;
-                    host.changeAnimation("shooting");
+                    changeAnimation("shooting");
                     host.weaponId = 5;
                 }
             }
@@ -145,7 +145,7 @@
                 enteringNewState = false;
 
                 if(host) {
-                    host.changeAnimation("walking");
+                    changeAnimation("walking");
                 }
             }
 
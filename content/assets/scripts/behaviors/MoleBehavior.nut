@@ -42,7 +42,7 @@ class MoleBehavior extends EnemyBehavior {
         base.attachHost(newHost);
 
         if(host != null) {
-            host.changeAnimation("idle");
+            changeAnimation("idle");
             host.zIndex = -1;
 
             chooseDirection(instanceConfig);
@@ -60,14 +60,14 @@ class MoleBehavior extends EnemyBehavior {
 
                 if(dir == "Up") {
                     host.direction = Directions.Up;
-                    host.changeAnimation("drilling-up");
+                    changeAnimation("drilling-up");
                 } else {
                     host.direction = Directions.Down;
-                    host.changeAnimation("drilling-down");
+                    changeAnimation("drilling-down");
                 }
             } else {
                 host.direction = Directions.Down;
-                host.changeAnimation("drilling-down");
+                changeAnimation("drilling-down");
             }
         }
     }
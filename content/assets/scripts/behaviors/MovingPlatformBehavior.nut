@@ -37,7 +37,7 @@ class MovingPlatformBehavior extends DoodadBehavior {
         base.attachHost(newHost, instanceConfig);
 
         if(host) {
-            host.changeAnimation(("animation" in classConfig) ? classConfig.animation : "destructable-wall-vertical-green");
+            changeAnimation(("animation" in classConfig) ? classConfig.animation : "destructable-wall-vertical-green");
             host.isObstacle = true;
             host.isShielded = false;
             host.isPhasing = true;
@@ -37,7 +37,7 @@ class OctopusBatteryEnemyBehavior extends EnemyBehavior {
             switch(state) {
                 case State.IDLE:
                     if(enteringNewState) {
-                        host.changeAnimation("stopping");
+                        changeAnimation("stopping");
                         host.velocityX = 0;
                         host.velocityY = 0;
                         enteringNewState = false;
@@ -46,7 +46,7 @@ class OctopusBatteryEnemyBehavior extends EnemyBehavior {
                     timer += dt;
 
                     if(timer >= 2.0) {
-                        ::log("I'm idle, but now I will move... " + timer + " heroX = " + heroX);
+                        ::log("I'm idle, but now I will move... " + timer + " heroX = " + ::world.heroX);
                         timer = 0.0;
                         enteringNewState = true;
                         state = State.MOVING;
@@ -54,7 +54,7 @@ class OctopusBatteryEnemyBehavior extends EnemyBehavior {
                     break;
                 case State.MOVING:
                     if(enteringNewState) {
-                        host.changeAnimation("walking");
+                        changeAnimation("walking");
                         enteringNewState = false;
 
                         switch(dir) {
@@ -34,7 +34,7 @@ class SpringerBehavior extends GroundWalkingBehavior {
             switch(state) {
                 case State.IDLE:
                     if(enteringNewState) {
-                        host.changeAnimation("attacking");
+                        changeAnimation("attacking");
                         host.isShielded = true;
                         enteringNewState = false;
                         timer = 0.0;
@@ -62,14 +62,14 @@ class SpringerBehavior extends GroundWalkingBehavior {
 
                 case State.MOVING:
                     if(enteringNewState) {
-                        host.changeAnimation("idle");
+                        changeAnimation("idle");
                         host.isShielded = true;
                         enteringNewState = false;
                     }
 
                     speed = normalSpeed;
 
-                    if(abs(host.getY() - ::heroBottomY) < 5) {
+                    if(abs(host.getY() - ::world.heroBottomY) < 5) {
                         speed = fastSpeed;
                     }
 
@@ -84,7 +84,7 @@ class SpringerBehavior extends GroundWalkingBehavior {
         base.attachHost(newHost);
 
         if(host != null) {
-            host.changeAnimation("attacking");
+            changeAnimation("attacking");
         }
     }
 
@@ -92,7 +92,7 @@ class SpringerBehavior extends GroundWalkingBehavior {
      * @override
      */
     function handleObjectTouch(otherId) {
-        if(otherId == ::heroId) {
+        if(otherId == ::world.heroId) {
             if(state != State.IDLE) {
                 enteringNewState = true;
                 state = State.IDLE;
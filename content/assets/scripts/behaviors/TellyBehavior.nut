@@ -67,8 +67,8 @@ class TellyEnemyBehavior extends EnemyBehavior {
     function adjustCourse() {
         local hostX = host.getX();
         local hostY = host.getY();
-        local targetX = ::heroX;
-        local targetY = ::heroY;
+        local targetX = ::world.heroX;
+        local targetY = ::world.heroY;
         local distanceX = targetX - hostX;
         local distanceY = targetY - hostY;
 
@@ -2,7 +2,6 @@ uniform sampler2D texture;
 uniform sampler2D colorTableTexture;
 uniform float colorTableWidth;
 uniform float colorTableHeight;
-uniform float paletteIndex;
 
 void main()
 {
@@ -13,6 +12,11 @@ void main()
         discard;
     }
 
+    // The palette index comes in through the red channel of the vertex color
+    // (0-255) rather than a uniform, so sprites with different palettes can
+    // be drawn in the same batch.
+    float paletteIndex = floor(gl_Color.r * 255.0 + 0.5);
+
     // Apply color mapping to opaque pixels.
     //
     // The source pixel RGB values are are normalized between 0.0 and 1.0,
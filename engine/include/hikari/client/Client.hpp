@@ -10,12 +10,16 @@
 
 #include <SFML/Graphics.hpp>
 
+#include <cstdint>
 #include <memory>
 #include <string>
  
 namespace hikari {
 
     class EventBus;
+    class GamePlayState;
+    class Input;
+    class InputRecorder;
     class KeyboardInput;
 
     class Client {
@@ -30,6 +34,34 @@ namespace hikari {
         static const unsigned int SCREEN_WIDTH;
         static const unsigned int SCREEN_HEIGHT;
         static const unsigned int SCREEN_BITS_PER_PIXEL;
+        static const unsigned int DEFAULT_HEADLESS_FRAMES;
+
+        /**
+         * Settings taken from the command line:
+         *
+         *   --headless           run without a window, renderer or audio
+         *   --stage <map file>   go straight to this map, like "map-pearl.json"
+         *   --frames <count>     how many ticks to simulate when headless
+         *   --input <file>       ScriptedInput JSON to drive the hero with
+         *   --record <file>      save the hero's input to a replay file
+         *   --replay <file>      drive the hero with a replay file
+         *   --seed <number>      seed for gameplay random numbers
+         *
+         * Headless runs still load textures, which need an OpenGL context.
+         * On machines without a display, run under xvfb-run.
+         */
+        struct LaunchOptions {
+            bool headless;
+            unsigned int frameCount;
+            std::string mapFileName;
+            std::string inputScriptPath;
+            std::string recordPath;
+            std::string replayPath;
+            bool hasRandomSeed;
+            std::uint32_t randomSeed;
+
+            LaunchOptions();
+        };
         
         /**
          * Initializes the client from the configuration file.
@@ -48,6 +80,7 @@ namespace hikari {
         void initLogging(int argc, char** argv);
         void initServices();
         void initWindow();
+        void parseArguments(int argc, char** argv);
  
         void deinitFileSystem();
         
@@ -57,11 +90,26 @@ namespace hikari {
         void loadDamageTable();
 
         void loop();
+        void exportProfile();
+
+        /**
+         * Runs the simulation as fast as possible for a fixed number of
+         * ticks, without a window, and logs how fast it went.
+         */
+        int runHeadless();
+
+        /**
+         * Sets up the hero's input and the random seed for a scripted,
+         * recorded or replayed session.
+         */
+        void initGamePlayInput(GamePlayState & gamePlayState);
+        void saveRecording() const;
         
         Json::Value gameConfigJson;
         ClientConfig clientConfig;
         std::shared_ptr<GameConfig> gameConfig;
         GameController controller;
+        std::weak_ptr<GamePlayState> gamePlayState;
         ServiceLocator services;
         std::shared_ptr<KeyboardInput> globalInput;
         std::shared_ptr<EventBus> globalEventBus;
@@ -70,6 +118,9 @@ namespace hikari {
         sf::RenderTexture screenBuffer;
         sf::View screenBufferView;
         bool quitGame;
+        float speedMultiplier;  // scales each tick's time step; replays use the recorded one
+        LaunchOptions launchOptions;
+        std::shared_ptr<InputRecorder> inputRecorder;
  
     public:
         Client(int argc, char** argv);
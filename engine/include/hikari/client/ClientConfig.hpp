@@ -22,10 +22,17 @@ namespace hikari {
         static const char* PROPERTY_VIDEOMODE;
         static const char* PROPERTY_BINDINGS;
         static const char* PROPERTY_KEYBOARD_BINDINGS;
+        static const char* PROPERTY_LOGGING;
+        static const char* PROPERTY_LOGGING_LEVEL;
+        static const char* PROPERTY_LOGGING_ASYNC;
+        static const char* PROPERTY_LOGGING_BUFFERSIZE;
 
         bool enableVsync;
         bool enableFpsDisplay;
         unsigned int stackSize;
+        bool enableAsyncLogging;
+        unsigned int logBufferSize;
+        std::string logLevel;
         float musicVolume;
         float sampleVolume;
         std::string videoMode;
@@ -57,6 +64,15 @@ namespace hikari {
 
         unsigned int getScriptingStackSize() const;
 
+        bool isAsyncLoggingEnabled() const;
+        unsigned int getLogBufferSize() const;
+
+        /**
+         * Gets the name of the most verbose log level to report, as
+         * understood by Log::parseLevel.
+         */
+        std::string getLogLevel() const;
+
         std::string getVideoMode() const;
         void setVideoMode(const std::string & mode);
 
@@ -27,8 +27,8 @@ namespace hikari {
         float sampleVolume;
         float musicVolume;
 
-        NSFSoundStream musicStream;
-        NSFSoundStream sampleStream;
+        std::unique_ptr<NSFSoundStream> musicStream;
+        std::unique_ptr<NSFSoundStream> sampleStream;
 
         std::unique_ptr<SoundLibrary> library;
 
@@ -38,6 +38,14 @@ namespace hikari {
         typedef int MusicId;
         typedef int SampleId;
 
+        /**
+         * Creates an AudioService which never touches the audio device, for
+         * running without a sound card (like in headless simulations).
+         * Nothing is loaded, so every request to play something is ignored.
+         * Volume and mute state are still tracked.
+         */
+        AudioService();
+
         AudioService(const Json::Value &configuration);
         virtual ~AudioService();
 
@@ -1,6 +1,8 @@
 #ifndef HIKARI_CLIENT_AUDIO_NSFSOUNDSTREAM_HPP
 #define HIKARI_CLIENT_AUDIO_NSFSOUNDSTREAM_HPP
 
+#include "hikari/client/audio/SampleMixer.hpp"
+
 #include <memory>
 #include <SFML/Audio.hpp>
 #include <SFML/System.hpp>
@@ -9,7 +11,6 @@
 #include <stack>
 #include <string>
 #include <vector>
-#include <list>
 #include <unordered_map>
 
 struct Music_Emu;
@@ -161,8 +162,9 @@ namespace hikari {
 
         typedef std::pair<std::shared_ptr<Music_Emu>, std::shared_ptr<std::vector<short>>> SamplerPair;
         std::stack<SamplerPair> availableSamplers;
-        std::list<SamplerPair> activeSamplers;
+        std::vector<SamplerPair> activeSamplers;
         std::unordered_map<int, SamplerPair> samplerSlots;
+        std::vector<const short*> mixSources;        ///< Buffers of the samplers mixed this chunk
 
         std::unique_ptr<short[]> masterBuffer;       ///< Audio buffer to read/write to
         std::vector<std::unique_ptr<short[]>> sampleBuffers;
@@ -0,0 +1,60 @@
+#ifndef HIKARI_CLIENT_AUDIO_SAMPLECACHE
+#define HIKARI_CLIENT_AUDIO_SAMPLECACHE
+
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+namespace hikari {
+
+    /**
+     * Reads and writes pre-rendered samples in the on-disk cache format: a
+     * small header followed by raw 16-bit PCM in native byte order.
+     *
+     * The header records how the samples were rendered. A file rendered at
+     * a different rate or channel count, or by an older version of the
+     * renderer, is rejected so it can be rendered again. Bump VERSION
+     * whenever rendering changes.
+     */
+    class SampleCache {
+    public:
+        static const char MAGIC[4];
+        static const std::uint32_t VERSION;
+
+        struct Header {
+            char magic[4];
+            std::uint32_t version;
+            std::uint32_t sampleRate;
+            std::uint32_t channelCount;
+            std::uint32_t sampleCount;
+        };
+
+        /**
+         * Writes samples with a header describing them.
+         *
+         * @param output       the stream to write to
+         * @param sampleRate   the rate the samples were rendered at
+         * @param channelCount the number of interleaved channels
+         * @param pcm          the samples
+         */
+        static void write(std::ostream & output, std::uint32_t sampleRate, std::uint32_t channelCount, const std::vector<short> & pcm);
+
+        /**
+         * Reads samples from the contents of a cache file.
+         *
+         * @param contents     the whole file
+         * @param sampleRate   the rate the samples must have been rendered at
+         * @param channelCount the number of channels the samples must have
+         * @param pcm          receives the samples; untouched on failure
+         * @return true if the file was read, false if it is truncated, isn't
+         *         a cache file, or is stale
+         */
+        static bool read(const std::vector<char> & contents, std::uint32_t sampleRate, std::uint32_t channelCount, std::vector<short> & pcm);
+
+    private:
+        SampleCache();
+    };
+
+} // hikari
+
+#endif // HIKARI_CLIENT_AUDIO_SAMPLECACHE
@@ -0,0 +1,26 @@
+#ifndef HIKARI_CLIENT_AUDIO_SAMPLEMIXER
+#define HIKARI_CLIENT_AUDIO_SAMPLEMIXER
+
+#include <cstddef>
+
+namespace hikari {
+
+    /**
+     * Mixes several buffers of 16-bit PCM samples into one.
+     *
+     * Sources are summed into a 32-bit accumulator one buffer at a time and
+     * then clamped back into 16-bit range, so loud passages saturate instead
+     * of wrapping around. Work is done in fixed-size blocks of straight loops
+     * over contiguous memory, which compilers turn into SIMD code. Mixing
+     * never allocates.
+     *
+     * @param sources     pointers to the source buffers
+     * @param sourceCount the number of source buffers
+     * @param output      buffer receiving the mixed samples; may not alias a source
+     * @param sampleCount the number of samples in each buffer
+     */
+    void mixSamples(const short * const * sources, std::size_t sourceCount, short * output, std::size_t sampleCount);
+
+} // hikari
+
+#endif // HIKARI_CLIENT_AUDIO_SAMPLEMIXER
@@ -0,0 +1,58 @@
+#ifndef HIKARI_CLIENT_AUDIO_SAMPLERENDERER
+#define HIKARI_CLIENT_AUDIO_SAMPLERENDERER
+
+#include <memory>
+#include <string>
+#include <vector>
+
+struct Music_Emu;
+
+namespace hikari {
+
+    /**
+     * Renders tracks of a music file (NSF, NSFE, etc.) into PCM samples
+     * without playing them. Each renderer owns its own emulator, so separate
+     * renderers can be used from separate threads at the same time.
+     */
+    class SampleRenderer {
+    private:
+        static const long SAMPLE_RATE;
+        static const unsigned int CHANNEL_COUNT;
+        static const std::size_t MAXIMUM_SAMPLE_COUNT;
+
+        std::unique_ptr<Music_Emu> emu;
+        std::vector<short> renderBuffer;
+
+    public:
+        /**
+         * Creates a renderer for a music file that has already been read
+         * into memory.
+         *
+         * @param fileName the name of the file, used to detect its format
+         * @param fileData the contents of the file
+         */
+        SampleRenderer(const std::string & fileName, const std::vector<char> & fileData);
+        ~SampleRenderer();
+
+        /**
+         * Checks whether the file could be loaded by an emulator.
+         */
+        bool isValid() const;
+
+        /**
+         * Renders a track until it ends or reaches the maximum sample length
+         * (4 seconds), whichever comes first.
+         *
+         * @param track   the track to render
+         * @param samples receives the interleaved stereo samples
+         * @return true if the track was rendered, false otherwise
+         */
+        bool render(int track, std::vector<short> & samples);
+
+        static long getSampleRate();
+        static unsigned int getChannelCount();
+    };
+
+} // hikari
+
+#endif // HIKARI_CLIENT_AUDIO_SAMPLERENDERER
@@ -20,6 +20,7 @@ namespace hikari {
         static const unsigned int MUSIC_BUFFER_SIZE;
         static const unsigned int SAMPLE_BUFFER_SIZE;
         static const unsigned int AUDIO_SAMPLE_RATE;
+        static const char * SAMPLE_CACHE_DIRECTORY;
 
         struct MusicEntry {
             unsigned int track;
@@ -37,6 +38,18 @@ namespace hikari {
             std::shared_ptr<GMESoundStream> sampleStream;
         };
 
+        /**
+         * A sample waiting to be turned into a SamplePlayer. Its PCM data
+         * comes either from the on-disk cache or from a render job.
+         */
+        struct PendingSample {
+            std::string name;
+            std::string cachePath;
+            std::shared_ptr<SampleEntry> entry;
+            std::vector<short> pcm;
+            bool needsRendering;
+        };
+
         struct SamplePlayer {
             std::shared_ptr<sf::SoundBuffer> buffer;
             std::shared_ptr<sf::Sound> player;
@@ -54,6 +67,18 @@ namespace hikari {
 
         void loadLibrary();
 
+        /**
+         * Renders every pending sample that wasn't found in the cache. Work is
+         * spread across a pool of threads; each thread creates its own
+         * emulator for each NSF file it renders from.
+         */
+        void renderSamples(std::vector<PendingSample> & pendingSamples,
+            const std::vector<std::string> & nsfFiles,
+            const std::vector<std::vector<char>> & nsfContents) const;
+
+        bool readCachedSample(PendingSample & pendingSample) const;
+        void writeCachedSample(const PendingSample & pendingSample) const;
+
     public:
         SoundLibrary(const std::string & file);
 
@@ -11,8 +11,10 @@
 #include "hikari/client/game/objects/BlockSequence.hpp"
 
 #include "hikari/client/game/GameWorld.hpp"
+#include "hikari/client/game/SpriteBatch.hpp"
 #include "hikari/core/game/map/RoomTransition.hpp"
 #include "hikari/core/game/Direction.hpp"
+#include "hikari/core/util/Random.hpp"
 
 
 #include <SFML/Graphics/RenderTarget.hpp>
@@ -45,6 +47,7 @@ namespace gcn {
 namespace hikari {
 
     namespace gui {
+        class CommandConsole;
         class EnergyMeter;
         class EnergyGauge;
         class Panel;
@@ -62,8 +65,9 @@ namespace hikari {
     class ServiceLocator;
     class ImageCache;
     class SquirrelService;
+    class ScriptWorldState;
     class ScreenEffectsService;
-    class RealTimeInput;
+    class Input;
     class Door;
     class Room;
     class Map;
@@ -73,11 +77,10 @@ namespace hikari {
     class CutSceneHeroActionController;
     class WorldCollisionResolver;
     class Spawner;
-    class EventBus;
+    class EventBusImpl;
     class KeyboardInput;
     class WeaponTable;
     class DamageTable;
-    class Particle;
     class CollectableItem;
     class Task;
 
@@ -99,18 +102,27 @@ namespace hikari {
 
     private:
         static const std::string MENU_ACTION_ETANK;
+
+        /**
+         * How long queued events may be processed for in one update, in
+         * milliseconds, unless changed with setEventProcessingBudget().
+         * Whatever doesn't fit is handled next update.
+         */
+        static const unsigned long EVENT_PROCESSING_BUDGET_MILLIS;
+
         std::string name;
         GameController & controller;
         std::weak_ptr<AudioService> audioService;
         std::weak_ptr<GuiService> guiService;
-        std::shared_ptr<EventBus> eventBus;
+        std::shared_ptr<EventBusImpl> eventBus;
         std::weak_ptr<WeaponTable> weaponTable;
         std::weak_ptr<DamageTable> damageTable;
         std::weak_ptr<GameConfig> gameConfig;
         std::weak_ptr<GameProgress> gameProgress;
         std::shared_ptr<ImageCache> imageCache;
-        std::shared_ptr<RealTimeInput> userInput;
+        std::shared_ptr<Input> userInput;
         std::shared_ptr<SquirrelService> scriptEnv;
+        std::unique_ptr<ScriptWorldState> scriptWorldState;
         std::shared_ptr<ScreenEffectsService> screenEffectsService;
         std::shared_ptr<WorldCollisionResolver> collisionResolver;
         std::shared_ptr<Map> currentMap;
@@ -135,9 +147,13 @@ namespace hikari {
         std::unique_ptr<gui::Menu> guiWeaponMenu;
         std::unique_ptr<gcn::ActionListener> guiWeaponMenuActionListener;
         std::unique_ptr<gcn::SelectionListener> guiWeaponMenuSelectionListener;
+        std::unique_ptr<gui::CommandConsole> console;
         std::unique_ptr<KeyboardInput> keyboardInput;
         std::unique_ptr<Vector2<float>> oldHeroPosition;
+        std::weak_ptr<MapLoader> mapLoader;
+        std::map< std::string, std::string > mapFiles;      // map file name -> path, loaded on first use
         std::map< std::string, std::shared_ptr<Map> > maps;
+        std::string mapOverride;                            // when set, played instead of the current boss' map
         std::vector<std::weak_ptr<Spawner>> itemSpawners;
         std::vector<std::weak_ptr<Spawner>> deactivatedItemSpawners;
         std::vector<std::shared_ptr<BlockSequence>> blockSequences;
@@ -145,6 +161,8 @@ namespace hikari {
         std::list<std::pair<int, std::string>> bonusChancesTable;
         std::queue<std::shared_ptr<Task>> taskQueue;
         GameWorld world;
+        mutable SpriteBatch spriteBatch;                    // reused every frame so drawing doesn't allocate
+        Random random;
         Camera camera;
         sf::View view;
         sf::RectangleShape spawnerMarker;
@@ -159,11 +177,13 @@ namespace hikari {
         bool isHeroAlive;
         bool gotoNextState;
         bool isRestoringEnergy;
+        unsigned long eventProcessingBudget;
 
         //
         // Resource Management
         //
-        void loadAllMaps(const std::weak_ptr<MapLoader> &mapLoader, const Json::Value &params);
+        void findAllMaps(const Json::Value &params);
+        std::shared_ptr<Map> loadMap(const std::string & fileName);
 
         //
         // Gameplay Mechanics
@@ -334,6 +354,8 @@ namespace hikari {
         // GUI
         //
         void buildGui();
+        void buildConsole(const Json::Value &params);
+        bool handleConsoleEvent(const sf::Event &event);
         void updateGui();
         void fadeOut();
         void fadeIn();
@@ -409,12 +431,13 @@ namespace hikari {
             float bubbleSpawnLongTimer;
             float bubbleSpawnShortTimer;
             bool gotoNextState;
+            std::vector<int> nearbyFeatures; // Reused for room queries
 
             /**
              * Spawns a small bubble that float up toward the top of the screen. These
              * are the bubbles that spawn from Rock's mouth when he's underwater.
              */
-            std::shared_ptr<Particle> spawnSmallBubble();
+            void spawnSmallBubble();
 
         public:
             PlayingSubState(GamePlayState & gamePlayState);
@@ -503,6 +526,49 @@ namespace hikari {
         //
         void refillPlayerEnergy(int amount);
         void refillWeaponEnergy(int amount);
+
+        /**
+         * Replaces the input that controls the hero. By default the keyboard
+         * is polled directly; headless runs supply scripted input instead.
+         * The input is updated by this state once per update.
+         */
+        void setUserInput(const std::shared_ptr<Input> & input);
+
+        /**
+         * Plays the given map instead of the current boss' stage the next
+         * time this state is entered. Pass an empty string to go back to
+         * normal stage selection.
+         *
+         * @param mapFileName the map's file name, like "map-pearl.json"
+         */
+        void setMapOverride(const std::string & mapFileName);
+
+        /**
+         * Whether the command console is open and taking the keyboard. The
+         * console is closed whenever this state is left.
+         */
+        bool isConsoleOpen() const;
+
+        /**
+         * Reseeds the random numbers used by gameplay, like bonus item drops.
+         * The seed is taken from the clock when this state is created.
+         */
+        void setRandomSeed(std::uint32_t seed);
+
+        /**
+         * Changes how long queued events may be processed for per update.
+         * Replays need EventBus::INFINITE: a time budget makes the order in
+         * which events happen depend on how fast the machine is.
+         */
+        void setEventProcessingBudget(unsigned long maxMillis);
+
+        /**
+         * Adds debugging commands for this state to a console. The state's
+         * own console, toggled with ~, gets them when it's built:
+         *
+         *   events  shows which gameplay event types cost the most to handle
+         */
+        void registerConsoleCommands(gui::CommandConsole & console);
     };
 
 } // hikari
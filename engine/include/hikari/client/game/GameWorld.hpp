@@ -1,17 +1,20 @@
 #ifndef HIKARI_CLIENT_GAME_GAMEWORLD
 #define HIKARI_CLIENT_GAME_GAMEWORLD
 
+#include "hikari/client/game/ParticleSystem.hpp"
+#include "hikari/client/game/RenderQueue.hpp"
+#include "hikari/client/game/SpawnOwnerTable.hpp"
 #include "hikari/core/game/Updatable.hpp"
 #include "hikari/core/math/Vector2.hpp"
 #include "hikari/core/game/Direction.hpp"
+#include "hikari/core/geom/SpatialHash.hpp"
+#include "hikari/core/util/SlotMap.hpp"
 
 #include <SFML/Graphics/RenderTarget.hpp>
 
 #include <memory>
-#include <queue>
 #include <unordered_map>
 #include <vector>
-#include <list>
 
 namespace sf {
     class RenderTarget;
@@ -28,46 +31,90 @@ namespace hikari {
     class Entity;
     class Enemy;
     class EnemyFactory;
-    class Particle;
     class ParticleFactory;
     class Projectile;
     class ProjectileFactory;
+    class Spawner;
     class EventBus;
 
     class GameWorld : public Updatable {
+    public:
+        /**
+            Objects with the same z-index are drawn in this order.
+        */
+        enum RenderLayer {
+            RENDER_LAYER_ITEMS = 0,
+            RENDER_LAYER_ENEMIES,
+            RENDER_LAYER_BLOCKS,
+            RENDER_LAYER_HERO,
+            RENDER_LAYER_PROJECTILES
+        };
+
     private:
         std::weak_ptr<EventBus> eventBus;
         std::shared_ptr<Hero> player;
         std::shared_ptr<Room> currentRoom;
         std::weak_ptr<ItemFactory> itemFactory;
         std::weak_ptr<EnemyFactory> enemyFactory;
-        std::weak_ptr<ParticleFactory> particleFactory;
         std::weak_ptr<ProjectileFactory> projectileFactory;
-        std::list<std::shared_ptr<GameObject>> queuedAdditions;
-        std::list<std::shared_ptr<GameObject>> queuedRemovals;
-        std::vector<std::shared_ptr<GameObject>> activeObjects;
+        std::vector<std::shared_ptr<GameObject>> queuedAdditions;
+        std::vector<std::shared_ptr<GameObject>> queuedRemovals;
+        SlotMap<std::shared_ptr<GameObject>> activeObjects;
 
-        std::list<std::shared_ptr<CollectableItem>> queuedItemAdditions;
-        std::list<std::shared_ptr<CollectableItem>> queuedItemRemovals;
-        std::vector<std::shared_ptr<CollectableItem>> activeItems;
+        std::vector<std::shared_ptr<CollectableItem>> queuedItemAdditions;
+        std::vector<std::shared_ptr<CollectableItem>> queuedItemRemovals;
+        SlotMap<std::shared_ptr<CollectableItem>> activeItems;
 
-        std::list<std::shared_ptr<Enemy>> queuedEnemyAdditions;
-        std::list<std::shared_ptr<Enemy>> queuedEnemyRemovals;
-        std::vector<std::shared_ptr<Enemy>> activeEnemies;
+        std::vector<std::shared_ptr<Enemy>> queuedEnemyAdditions;
+        std::vector<std::shared_ptr<Enemy>> queuedEnemyRemovals;
+        SlotMap<std::shared_ptr<Enemy>> activeEnemies;
 
-        std::list<std::shared_ptr<Particle>> queuedParticleAdditions;
-        std::list<std::shared_ptr<Particle>> queuedParticleRemovals;
-        std::vector<std::shared_ptr<Particle>> activeParticles;
+        std::vector<std::shared_ptr<Projectile>> queuedProjectileAdditions;
+        std::vector<std::shared_ptr<Projectile>> queuedProjectileRemovals;
+        SlotMap<std::shared_ptr<Projectile>> activeProjectiles;
 
-        std::list<std::shared_ptr<Projectile>> queuedProjectileAdditions;
-        std::list<std::shared_ptr<Projectile>> queuedProjectileRemovals;
-        std::vector<std::shared_ptr<Projectile>> activeProjectiles;
+        ParticleSystem particles;
+        RenderQueue renderQueue;
 
-        std::unordered_map<int, std::shared_ptr<GameObject>> objectRegistry;
+        /**
+            Everything the world knows about an object that is in it.
+        */
+        struct RegisteredObject {
+            std::shared_ptr<GameObject> object;
+            SlotHandle handle;          // Into the active set for the object's type
+            SlotHandle obstacleHandle;  // Into the obstacle set, if it is an obstacle
+            bool removalQueued;         // Keeps it from being queued twice
+
+            RegisteredObject();
+        };
+
+        std::unordered_map<int, RegisteredObject> objectRegistry;
+        SpawnOwnerTable<Spawner> spawnOwners;
+        SpatialHash<Enemy*> enemyIndex;
+        SpatialHash<Entity*> obstacleIndex;
+        SlotMap<Entity*> obstacles;
         bool gravityEnabled;
 
         void processAdditions();
 
+        template <typename T>
+        bool registerObject(const std::shared_ptr<T> & object, SlotMap<std::shared_ptr<T>> & activeSet);
+
+        template <typename T>
+        void unregisterObject(int objectId, SlotMap<std::shared_ptr<T>> & activeSet);
+
+        bool markForRemoval(int objectId);
+
+        void addObstacle(Entity * obstacle);
+        void removeObstacle(Entity * obstacle);
+        void syncObstacleIndex();
+
+        /**
+            Adds an enemy to or removes it from the obstacle index when its
+            obstacle status changes while it is in the world.
+        */
+        void handleObstacleStatusChange(Entity & entity);
+
     public:
         GameWorld();
         virtual ~GameWorld();
@@ -86,31 +133,102 @@ namespace hikari {
         void queueObjectAddition(const std::shared_ptr<GameObject> &obj);
         void queueObjectAddition(const std::shared_ptr<CollectableItem> &obj);
         void queueObjectAddition(const std::shared_ptr<Enemy> &obj);
-        void queueObjectAddition(const std::shared_ptr<Particle> &obj);
         void queueObjectAddition(const std::shared_ptr<Projectile> &obj);
 
         void queueObjectRemoval(const std::shared_ptr<GameObject> &obj);
         void queueObjectRemoval(const std::shared_ptr<CollectableItem> &obj);
         void queueObjectRemoval(const std::shared_ptr<Enemy> &obj);
-        void queueObjectRemoval(const std::shared_ptr<Particle> &obj);
         void queueObjectRemoval(const std::shared_ptr<Projectile> &obj);
 
         void removeAllObjects();
         void processRemovals();
 
         std::shared_ptr<CollectableItem> spawnCollectableItem(const std::string & name) const;
-        std::unique_ptr<Enemy> spawnEnemy(const std::string & name) const;
-        std::unique_ptr<Particle> spawnParticle(const std::string & name) const;
-        std::unique_ptr<Projectile> spawnProjectile(const std::string & name) const;
+        std::shared_ptr<Enemy> spawnEnemy(const std::string & name) const;
+
+        /**
+         * Prepares for a number of enemies to be spawned by name later on.
+         *
+         * @see EnemyFactory::prewarm
+         */
+        void prewarmEnemies(const std::string & name, std::size_t count) const;
+
+        /**
+         * Makes a Spawner the owner of an object it spawned. When the object
+         * is removed its owner is told directly, through
+         * Spawner::onSpawnRemoved, so spawners don't have to listen for every
+         * ObjectRemovedEventData on the bus.
+         *
+         * @param objectId the ID of the spawned object
+         * @param spawner  the Spawner that spawned it
+         */
+        void setSpawnOwner(int objectId, const std::weak_ptr<Spawner> & spawner);
+        std::shared_ptr<Projectile> spawnProjectile(const std::string & name) const;
 
         const std::weak_ptr<GameObject> getObjectById(int id) const;
 
+        /**
+            Gets the active objects of one type. Each set is kept in one
+            contiguous array; removing an object moves the last one into its
+            place, so the order isn't the order objects were added in.
+        */
         const std::vector<std::shared_ptr<CollectableItem>> & getActiveItems() const;
         const std::vector<std::shared_ptr<Enemy>> & getActiveEnemies() const;
-        const std::vector<std::shared_ptr<Particle>> & getActiveParticles() const;
         const std::vector<std::shared_ptr<Projectile>> & getActiveProjectiles() const;
 
-        std::vector<std::shared_ptr<Entity>> getObstacles() const;
+        /**
+            Gets the particles in the world. Particles are spawned, updated and
+            drawn through the ParticleSystem rather than as individual objects.
+
+            @return the world's particles
+        */
+        ParticleSystem & getParticles();
+        const ParticleSystem & getParticles() const;
+
+        /**
+            Gets the active objects in the order they are drawn. Items,
+            enemies, projectiles and the player are added and removed along
+            with the objects themselves; anything else that should be drawn
+            with them has to be added by its owner.
+
+            @return the world's render queue
+        */
+        RenderQueue & getRenderQueue();
+        const RenderQueue & getRenderQueue() const;
+
+        /**
+            Finds the obstacles whose bounding boxes may overlap a region. The
+            obstacle index is maintained as objects are added and removed and
+            when one of them changes its obstacle status, so this doesn't scan
+            the list of active enemies. Callers must still test the bounding
+            boxes of the returned obstacles. Results are ordered by object ID.
+
+            @param bounds  the region to test, in world coordinates
+            @param results receives the candidate obstacles (cleared first)
+        */
+        void queryObstacles(const BoundingBox<float> & bounds, std::vector<Entity*> & results);
+
+        /**
+            Refreshes the spatial index of active enemies so that it reflects
+            their current hit box positions. Only enemies that moved into a
+            different set of grid cells are rehashed. This should be called
+            once per tick after enemies have moved and before any calls to
+            queryEnemies.
+
+            @see queryEnemies
+        */
+        void updateEnemyIndex();
+
+        /**
+            Finds the active enemies whose hit boxes may overlap a region. This
+            is a broadphase query; callers must still test the hit boxes of the
+            returned enemies. Results are ordered by object ID.
+
+            @param bounds  the region to test, in world coordinates
+            @param results receives the candidate enemies (cleared first)
+            @see updateEnemyIndex
+        */
+        void queryEnemies(const BoundingBox<float> & bounds, std::vector<Enemy*> & results) const;
 
         void setPlayer(const std::shared_ptr<Hero>& player);
 
@@ -0,0 +1,39 @@
+#ifndef HIKARI_CLIENT_GAME_INPUTRECORDER
+#define HIKARI_CLIENT_GAME_INPUTRECORDER
+
+#include "hikari/core/Platform.hpp"
+#include "hikari/client/game/Input.hpp"
+#include "hikari/client/game/InputRecording.hpp"
+
+#include <cstdint>
+#include <memory>
+
+namespace hikari {
+
+    /**
+     * InputRecorder is a decorator for an Input which writes down the state
+     * of every button each time it is updated. The recording can be played
+     * back later with a ReplayInput.
+     */
+    class HIKARI_API InputRecorder : public Input {
+    private:
+        std::shared_ptr<Input> input;
+        InputRecording recording;
+
+    public:
+        InputRecorder(const std::shared_ptr<Input> & input, std::uint32_t randomSeed, float speedMultiplier = 1.0f);
+        virtual ~InputRecorder() { }
+
+        virtual const bool isUp(const Button &button) const;
+        virtual const bool isDown(const Button &button) const;
+        virtual const bool isHeld(const Button &button) const;
+        virtual const bool wasPressed(const Button &button) const;
+        virtual const bool wasReleased(const Button &button) const;
+        virtual void update(float dt);
+
+        const InputRecording & getRecording() const;
+    };
+
+} // hikari
+
+#endif // HIKARI_CLIENT_GAME_INPUTRECORDER
@@ -0,0 +1,83 @@
+#ifndef HIKARI_CLIENT_GAME_INPUTRECORDING
+#define HIKARI_CLIENT_GAME_INPUTRECORDING
+
+#include "hikari/core/Platform.hpp"
+#include "hikari/client/game/Input.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+namespace hikari {
+
+    /**
+     * The state of every button for every tick of a play session, plus the
+     * random seed and game speed the session was played with. Together they
+     * are enough to play the session back exactly.
+     *
+     * On disk a recording is a small header followed by run-length encoded
+     * button states, so holding a button (or nothing) for a long time costs
+     * almost nothing:
+     *
+     *     "HKIR"  magic
+     *     u8      version
+     *     u32     random seed
+     *     f32     speed multiplier (version 2 and up)
+     *     u32     tick count
+     *     u32     run count
+     *     runs    u16 buttons, u16 tick count (each run)
+     *
+     * All numbers are little-endian. Version 1 recordings have no speed
+     * multiplier and were always played at normal speed.
+     */
+    class HIKARI_API InputRecording {
+    private:
+        static const char MAGIC[4];
+        static const std::uint8_t VERSION;
+
+        std::uint32_t randomSeed;
+        float speedMultiplier;
+        std::vector<std::uint16_t> ticks;
+
+    public:
+        explicit InputRecording(std::uint32_t randomSeed = 0, float speedMultiplier = 1.0f);
+
+        std::uint32_t getRandomSeed() const;
+        void setRandomSeed(std::uint32_t seed);
+
+        /**
+         * Gets how much each tick's time step was scaled by while recording.
+         * Replays have to use the same step to stay in sync.
+         */
+        float getSpeedMultiplier() const;
+        void setSpeedMultiplier(float multiplier);
+
+        /**
+         * Adds one tick's worth of button state to the end of the recording.
+         */
+        void addTick(Input::Button buttons);
+
+        /**
+         * Gets the buttons that were down during a tick. Ticks past the end
+         * of the recording have no buttons down.
+         */
+        Input::Button getTick(std::size_t tick) const;
+        std::size_t getTickCount() const;
+
+        void clear();
+
+        void write(std::ostream & output) const;
+
+        /**
+         * Replaces this recording with one read from a stream.
+         *
+         * @return true if the stream held a valid recording; if not, this
+         *         recording is left empty
+         */
+        bool read(std::istream & input);
+    };
+
+} // hikari
+
+#endif // HIKARI_CLIENT_GAME_INPUTRECORDING
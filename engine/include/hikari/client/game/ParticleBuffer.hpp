@@ -0,0 +1,172 @@
+#ifndef HIKARI_CLIENT_GAME_PARTICLEBUFFER
+#define HIKARI_CLIENT_GAME_PARTICLEBUFFER
+
+#include "hikari/client/game/objects/ParticleTemplate.hpp"
+#include "hikari/core/game/Animation.hpp"
+#include "hikari/core/geom/Rectangle2D.hpp"
+#include "hikari/core/math/Vector2.hpp"
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace sf {
+    class Texture;
+}
+
+namespace hikari {
+
+    /**
+     * The particles of a ParticleSystem, without anything to do with drawing
+     * them.
+     *
+     * Particles aren't objects; each one is a row across a set of parallel
+     * arrays (position, velocity, age, animation frame) so that updating and
+     * culling them is a tight loop over contiguous memory. Removing a
+     * particle moves the last row into its place, so rows aren't kept in
+     * spawn order.
+     *
+     * Every distinct texture used by the registered templates gets an index,
+     * and visitQuads() reports each particle with the index of its texture so
+     * that particles can be drawn one batch per texture.
+     *
+     * @see ParticleSystem
+     */
+    class ParticleBuffer {
+    public:
+        typedef int TemplateId;
+
+        static const TemplateId INVALID_TEMPLATE;
+
+    private:
+        struct Template {
+            ParticleTemplate description;
+            std::size_t textureIndex;
+        };
+
+        std::vector<Template> templates;
+        std::unordered_map<std::string, TemplateId> templateIds;
+        std::vector<std::shared_ptr<sf::Texture>> textures;
+
+        //
+        // Particle data. Every array has one entry per live particle.
+        //
+        std::vector<TemplateId> templateId;
+        std::vector<float> positionX;
+        std::vector<float> positionY;
+        std::vector<float> velocityX;
+        std::vector<float> velocityY;
+        std::vector<float> age;
+        std::vector<float> maximumAge;
+        std::vector<float> frameTime;
+        std::vector<unsigned int> frame;
+
+        void kill(std::size_t index);
+        void advanceFrame(std::size_t index, float dt);
+
+    public:
+        ParticleBuffer();
+
+        /**
+         * Finds the ID of a template registered with addTemplate().
+         *
+         * @return the template's ID, or INVALID_TEMPLATE if there's no such template
+         */
+        TemplateId findTemplate(const std::string & name) const;
+
+        /**
+         * Registers a template. Templates sharing a texture share its index.
+         *
+         * @return the new template's ID
+         */
+        TemplateId addTemplate(const std::string & name, const ParticleTemplate & description);
+
+        /**
+         * Spawns a particle with a specific maximum age (in seconds).
+         *
+         * @return true if the particle was spawned, false if the template is invalid
+         */
+        bool spawn(TemplateId id, const Vector2<float> & position,
+            const Vector2<float> & velocity, float maximumAge);
+
+        /**
+         * Gets the maximum age of a template's particles.
+         */
+        float getMaximumAge(TemplateId id) const;
+
+        /**
+         * Moves, ages and animates every particle. Particles which are too
+         * old or whose bounds no longer touch the view are removed.
+         *
+         * @param dt   time elapsed since the last update, in seconds
+         * @param view the visible area, in world coordinates
+         */
+        void update(float dt, const Rectangle2D<float> & view);
+
+        /**
+         * Calls a visitor with the quad of every particle which has something
+         * to show:
+         *
+         *     visitor(textureIndex, left, top, width, height, u, v)
+         *
+         * The position is in whole pixels, offset by the frame's hotspot, and
+         * (u, v) is the top left of the frame in its texture.
+         */
+        template <typename QuadVisitor>
+        void visitQuads(QuadVisitor & visitor) const;
+
+        /**
+         * Removes every particle. Templates are kept.
+         */
+        void clear();
+
+        /**
+         * Reserves room for a number of particles so that spawning up to that
+         * many doesn't allocate.
+         */
+        void reserve(std::size_t count);
+
+        std::size_t size() const;
+
+        /**
+         * Gets the position of the particle in a given row.
+         */
+        Vector2<float> getPosition(std::size_t index) const;
+
+        std::size_t getTextureCount() const;
+        const std::shared_ptr<sf::Texture> & getTexture(std::size_t textureIndex) const;
+    };
+
+    template <typename QuadVisitor>
+    void ParticleBuffer::visitQuads(QuadVisitor & visitor) const {
+        const std::size_t count = templateId.size();
+
+        for(std::size_t i = 0; i < count; ++i) {
+            const Template & entry = templates[templateId[i]];
+            const Animation * animation = entry.description.animation.get();
+
+            if(!animation || animation->getNumberOfFrames() == 0) {
+                continue;
+            }
+
+            const auto & currentFrame = animation->getFrameAt(frame[i]);
+            const auto & source = currentFrame.getSourceRectangle();
+            const auto & hotspot = currentFrame.getHotspot();
+
+            visitor(
+                entry.textureIndex,
+                std::floor(positionX[i]) - static_cast<float>(hotspot.getX()),
+                std::floor(positionY[i]) - static_cast<float>(hotspot.getY()),
+                static_cast<float>(source.getWidth()),
+                static_cast<float>(source.getHeight()),
+                static_cast<float>(source.getLeft()),
+                static_cast<float>(source.getTop())
+            );
+        }
+    }
+
+} // hikari
+
+#endif // HIKARI_CLIENT_GAME_PARTICLEBUFFER
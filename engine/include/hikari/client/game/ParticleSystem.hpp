@@ -0,0 +1,111 @@
+#ifndef HIKARI_CLIENT_GAME_PARTICLESYSTEM
+#define HIKARI_CLIENT_GAME_PARTICLESYSTEM
+
+#include "hikari/client/game/ParticleBuffer.hpp"
+#include "hikari/client/game/objects/ParticleTemplate.hpp"
+#include "hikari/core/geom/Rectangle2D.hpp"
+#include "hikari/core/math/Vector2.hpp"
+
+#include <SFML/Graphics/VertexArray.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sf {
+    class RenderTarget;
+    class Texture;
+}
+
+namespace hikari {
+
+    class ParticleFactory;
+
+    /**
+     * Simulates and draws all of the particles in a GameWorld. The particles
+     * themselves live in a ParticleBuffer; particles that share a texture are
+     * drawn with a single draw call.
+     *
+     * Templates are looked up by name in a ParticleFactory the first time
+     * they are used and copied, so spawning never touches the factory again.
+     */
+    class ParticleSystem {
+    public:
+        typedef ParticleBuffer::TemplateId TemplateId;
+
+        static const TemplateId INVALID_TEMPLATE;
+
+    private:
+        std::weak_ptr<ParticleFactory> factory;
+        ParticleBuffer particles;
+
+        //
+        // One vertex array per texture; kept around so drawing doesn't allocate.
+        //
+        mutable std::vector<sf::VertexArray> batches;
+
+    public:
+        ParticleSystem();
+
+        void setFactory(const std::weak_ptr<ParticleFactory> & factory);
+
+        /**
+         * Finds the ID of a particle template so that it can be spawned. The
+         * ID stays valid for the lifetime of this ParticleSystem.
+         *
+         * @param name the name of a template registered with the factory
+         * @return the template's ID, or INVALID_TEMPLATE if there's no such template
+         */
+        TemplateId findTemplate(const std::string & name);
+
+        /**
+         * Registers a template directly, bypassing the factory.
+         *
+         * @return the new template's ID
+         */
+        TemplateId addTemplate(const std::string & name, const ParticleTemplate & description);
+
+        /**
+         * Spawns a particle which lives as long as its template says.
+         *
+         * @return true if the particle was spawned, false if the template is invalid
+         */
+        bool spawn(TemplateId id, const Vector2<float> & position,
+            const Vector2<float> & velocity = Vector2<float>(0.0f, 0.0f));
+
+        /**
+         * Spawns a particle with a specific maximum age (in seconds).
+         *
+         * @return true if the particle was spawned, false if the template is invalid
+         */
+        bool spawn(TemplateId id, const Vector2<float> & position,
+            const Vector2<float> & velocity, float maximumAge);
+
+        /**
+         * Moves, ages and animates every particle. Particles which are too
+         * old or whose bounds no longer touch the view are removed.
+         *
+         * @param dt   time elapsed since the last update, in seconds
+         * @param view the visible area, in world coordinates
+         */
+        void update(float dt, const Rectangle2D<float> & view);
+
+        void render(sf::RenderTarget & target) const;
+
+        /**
+         * Removes every particle. Templates are kept.
+         */
+        void clear();
+
+        /**
+         * Reserves room for a number of particles so that spawning up to that
+         * many doesn't allocate.
+         */
+        void reserve(std::size_t count);
+
+        std::size_t size() const;
+    };
+
+} // hikari
+
+#endif // HIKARI_CLIENT_GAME_PARTICLESYSTEM
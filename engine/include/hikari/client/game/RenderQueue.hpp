@@ -0,0 +1,81 @@
+#ifndef HIKARI_CLIENT_GAME_RENDERQUEUE
+#define HIKARI_CLIENT_GAME_RENDERQUEUE
+
+#include <cstddef>
+#include <vector>
+
+namespace hikari {
+
+    class Renderable;
+
+    /**
+     * Keeps a list of Renderables in drawing order: by z-index, then by
+     * layer, then by the order they were added in.
+     *
+     * The order is kept as objects come and go instead of being sorted from
+     * scratch every frame. Objects rarely change their z-index, so update()
+     * usually makes a single pass over the list without moving anything.
+     */
+    class RenderQueue {
+    private:
+        struct Entry {
+            Renderable * renderable;
+            int zIndex;
+            int layer;
+            unsigned long sequence;
+        };
+
+        std::vector<Entry> entries;
+        unsigned long nextSequence;
+
+        static bool isDrawnBefore(const Entry & a, const Entry & b);
+
+    public:
+        RenderQueue();
+
+        /**
+         * Adds a Renderable to the queue. Renderables which have the same
+         * z-index are drawn by layer (lowest first), and then in the order
+         * they were added.
+         *
+         * @param renderable the object to draw; it must stay alive until it
+         *                   is removed
+         * @param layer      tie-breaker for objects with the same z-index
+         */
+        void add(Renderable * renderable, int layer = 0);
+
+        /**
+         * Removes a Renderable from the queue.
+         *
+         * @return true if the Renderable was in the queue
+         */
+        bool remove(const Renderable * renderable);
+
+        bool contains(const Renderable * renderable) const;
+
+        void clear();
+
+        /**
+         * Picks up z-index changes made since the last update and restores
+         * the drawing order.
+         */
+        void update();
+
+        std::size_t size() const;
+        bool empty() const;
+
+        /**
+         * Gets the Renderable at a position in drawing order.
+         */
+        Renderable * at(std::size_t index) const;
+
+        /**
+         * Finds the position of the first Renderable whose z-index is at
+         * least a given value; everything before it is drawn beneath.
+         */
+        std::size_t lowerBound(int zIndex) const;
+    };
+
+} // hikari
+
+#endif // HIKARI_CLIENT_GAME_RENDERQUEUE
@@ -0,0 +1,44 @@
+#ifndef HIKARI_CLIENT_GAME_REPLAYINPUT
+#define HIKARI_CLIENT_GAME_REPLAYINPUT
+
+#include "hikari/core/Platform.hpp"
+#include "hikari/client/game/Input.hpp"
+#include "hikari/client/game/InputRecording.hpp"
+
+#include <cstddef>
+
+namespace hikari {
+
+    /**
+     * ReplayInput plays back an InputRecording, one tick per update(). Once
+     * the recording runs out every button stays up.
+     */
+    class HIKARI_API ReplayInput : public Input {
+    private:
+        InputRecording recording;
+        std::size_t tick;
+        Button currentButtons;
+        Button previousButtons;
+
+    public:
+        explicit ReplayInput(const InputRecording & recording);
+        virtual ~ReplayInput() { }
+
+        virtual const bool isUp(const Button &button) const;
+        virtual const bool isDown(const Button &button) const;
+        virtual const bool isHeld(const Button &button) const;
+        virtual const bool wasPressed(const Button &button) const;
+        virtual const bool wasReleased(const Button &button) const;
+        virtual void update(float dt);
+
+        const InputRecording & getRecording() const;
+
+        /**
+         * Checks if every recorded tick has been played back.
+         */
+        bool isFinished() const;
+    };
+
+} // hikari
+
+#endif // HIKARI_CLIENT_GAME_REPLAYINPUT
@@ -0,0 +1,78 @@
+#ifndef HIKARI_CLIENT_GAME_SCRIPTEDINPUT
+#define HIKARI_CLIENT_GAME_SCRIPTEDINPUT
+
+#include "hikari/core/Platform.hpp"
+#include "hikari/client/game/Input.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Json {
+    class Value;
+}
+
+namespace hikari {
+
+    /**
+     * ScriptedInput is an Input whose buttons are pushed by a script instead
+     * of a person. The script is a list of steps, each saying which buttons
+     * are down from a given frame on:
+     *
+     *     { "steps": [
+     *         { "frame": 0,  "buttons": [ "right" ] },
+     *         { "frame": 30, "buttons": [ "right", "jump" ] },
+     *         { "frame": 45, "buttons": [ ] }
+     *     ] }
+     *
+     * Every call to update() advances one frame, so a script plays back the
+     * same way no matter how fast the game is running.
+     */
+    class HIKARI_API ScriptedInput : public Input {
+    private:
+        struct Step {
+            unsigned int frame;
+            Button buttons;
+        };
+
+        std::vector<Step> steps;
+        std::size_t nextStep;
+        unsigned int frame;
+        Button currentButtons;
+        Button previousButtons;
+
+        void applySteps();
+
+    public:
+        /**
+         * Converts a button name ("up", "right", "down", "left", "shoot",
+         * "jump", "start", "select" or "cancel") to a Button.
+         *
+         * @return the button, or BUTTON_NONE if the name is unknown
+         */
+        static Button parseButton(const std::string & name);
+
+        explicit ScriptedInput(const Json::Value & script);
+        virtual ~ScriptedInput() { }
+
+        virtual const bool isUp(const Button &button) const;
+        virtual const bool isDown(const Button &button) const;
+        virtual const bool isHeld(const Button &button) const;
+        virtual const bool wasPressed(const Button &button) const;
+        virtual const bool wasReleased(const Button &button) const;
+        virtual void update(float dt);
+
+        /**
+         * Gets the number of frames played back so far.
+         */
+        unsigned int getFrame() const;
+
+        /**
+         * Checks if every step of the script has been played back.
+         */
+        bool isFinished() const;
+    };
+
+} // hikari
+
+#endif // HIKARI_CLIENT_GAME_SCRIPTEDINPUT
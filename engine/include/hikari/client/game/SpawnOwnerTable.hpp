@@ -0,0 +1,68 @@
+#ifndef HIKARI_CLIENT_GAME_SPAWNOWNERTABLE
+#define HIKARI_CLIENT_GAME_SPAWNOWNERTABLE
+
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+
+namespace hikari {
+
+    /**
+     * Remembers which owner spawned each object, so the owner alone can be
+     * told when the object goes away. Owners are held weakly; an owner that
+     * has been destroyed is simply not told.
+     *
+     * Owner must have a method onSpawnRemoved(int objectId).
+     *
+     * @see GameWorld::setSpawnOwner
+     */
+    template <typename Owner>
+    class SpawnOwnerTable {
+    private:
+        std::unordered_map<int, std::weak_ptr<Owner>> owners;
+
+    public:
+        SpawnOwnerTable()
+            : owners()
+        {
+        }
+
+        void setOwner(int objectId, const std::weak_ptr<Owner> & owner) {
+            owners[objectId] = owner;
+        }
+
+        /**
+         * Tells the owner of an object that it has been removed, and forgets
+         * about the object. Does nothing if the object has no owner.
+         */
+        void notifyOwner(int objectId) {
+            auto found = owners.find(objectId);
+
+            if(found != owners.end()) {
+                // Erase first; the owner may spawn again (and reuse the ID)
+                // from inside its handler.
+                const std::weak_ptr<Owner> owner = found->second;
+                owners.erase(found);
+
+                if(auto ownerPtr = owner.lock()) {
+                    ownerPtr->onSpawnRemoved(objectId);
+                }
+            }
+        }
+
+        /**
+         * Forgets every owner without telling any of them. Used when the
+         * spawned objects are thrown away together, like on a room change.
+         */
+        void clear() {
+            owners.clear();
+        }
+
+        std::size_t getSize() const {
+            return owners.size();
+        }
+    };
+
+} // hikari
+
+#endif // HIKARI_CLIENT_GAME_SPAWNOWNERTABLE
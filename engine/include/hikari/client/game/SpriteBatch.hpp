@@ -0,0 +1,87 @@
+#ifndef HIKARI_CLIENT_GAME_SPRITEBATCH
+#define HIKARI_CLIENT_GAME_SPRITEBATCH
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <vector>
+
+namespace sf {
+    class RenderTarget;
+    class Shader;
+    class Sprite;
+    class Texture;
+}
+
+namespace hikari {
+
+    /**
+     * Collects sprites into runs which are drawn with one draw call each.
+     *
+     * Sprites are drawn in the order they are given, so z-order is kept; a
+     * run simply grows for as long as consecutive sprites share a texture
+     * and shader state, and is flushed when the next sprite doesn't. With
+     * most sprites packed into a few atlas pages, a busy scene comes down to
+     * a handful of draw calls.
+     *
+     * Anything drawn straight to the target in between must call flush()
+     * first, or it will end up beneath sprites that were given earlier.
+     */
+    class SpriteBatch {
+    private:
+        sf::RenderTarget * target;
+        std::vector<sf::Vertex> vertices;
+        const sf::Texture * texture;
+        sf::Shader * shader;
+        unsigned int drawCallCount;
+        unsigned int spriteCount;
+
+        void append(const sf::Sprite & sprite, sf::Shader * spriteShader, const sf::Color & color);
+
+    public:
+        SpriteBatch();
+
+        /**
+         * Starts a new batch, drawing to a target with its current view.
+         * Resets the draw call and sprite counts.
+         */
+        void begin(sf::RenderTarget & target);
+
+        /**
+         * Adds a sprite which is drawn as is.
+         */
+        void draw(const sf::Sprite & sprite);
+
+        /**
+         * Adds a sprite which is drawn through a shader. Shader parameters
+         * are shared by the whole run, so anything that differs from sprite
+         * to sprite has to travel in the vertices instead.
+         *
+         * @param sprite the sprite to draw
+         * @param shader the shader to draw it with
+         * @param color  used as the vertex color instead of the sprite's own
+         */
+        void draw(const sf::Sprite & sprite, sf::Shader & shader, const sf::Color & color);
+
+        /**
+         * Draws the current run, if any.
+         */
+        void flush();
+
+        /**
+         * Draws whatever is left and ends the batch.
+         */
+        void end();
+
+        /**
+         * Gets the target of the current batch, or nullptr between batches.
+         */
+        sf::RenderTarget * getTarget() const;
+
+        unsigned int getDrawCallCount() const;
+        unsigned int getSpriteCount() const;
+    };
+
+} // hikari
+
+#endif // HIKARI_CLIENT_GAME_SPRITEBATCH
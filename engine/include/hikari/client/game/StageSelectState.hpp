@@ -21,6 +21,7 @@ namespace sf {
 
 namespace gcn {
     class Container;
+    class Image;
     class LabelEx;
     class Icon;
 }
@@ -65,6 +66,8 @@ namespace hikari {
         std::unique_ptr<gui::Icon> guiBackground;
         std::unique_ptr<gui::Icon> guiLeftEye;
         std::unique_ptr<gui::Icon> guiRightEye;
+        std::unique_ptr<gcn::Image> cursorImage;
+        std::unique_ptr<gcn::Image> portraitImage;
         AnimatedIcon guiCursor;
 
         std::shared_ptr<AnimationSet> cursorAnimations;
@@ -11,7 +11,7 @@ namespace hikari {
 
     class AudioEventData : public BaseEventData {
     public:
-        static const EventType Type;
+        static constexpr EventType Type = hashString("AudioEventData");
         static const char * NO_NAME;
 
         enum AudioAction {
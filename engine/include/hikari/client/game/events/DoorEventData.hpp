@@ -11,7 +11,7 @@ namespace hikari {
 
     class DoorEventData : public BaseEventData {
     public:
-        static const EventType Type;
+        static constexpr EventType Type = hashString("DoorEventData");
 
     private:
         std::weak_ptr<Door> door;
@@ -7,7 +7,7 @@ namespace hikari {
 
     class EntityDamageEventData : public BaseEventData {
     public:
-        static const EventType Type;
+        static constexpr EventType Type = hashString("EntityDamageEventData");
 
     private:
         int entityId;
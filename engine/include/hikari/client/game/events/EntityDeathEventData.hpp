@@ -7,7 +7,7 @@ namespace hikari {
 
     class EntityDeathEventData : public BaseEventData {
     public:
-        static const EventType Type;
+        static constexpr EventType Type = hashString("EntityDeathEventData");
 
         enum EntityType {
             Unknown = 1,
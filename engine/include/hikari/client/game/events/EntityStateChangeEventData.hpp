@@ -8,7 +8,7 @@ namespace hikari {
 
     class EntityStateChangeEventData : public BaseEventData {
     public:
-        static const EventType Type;
+        static constexpr EventType Type = hashString("EntityStateChangeEventData");
 
     private:
         int entityId;
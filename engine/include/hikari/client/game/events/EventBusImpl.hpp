@@ -2,25 +2,86 @@
 #define HIKARI_CLIENT_EventBusIMPL
 
 #include "hikari/client/game/events/EventBus.hpp"
-#include <list>
-#include <map>
+#include "hikari/core/util/RingBuffer.hpp"
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace hikari {
 
     /**
      * EventBus implementation.
+     *
+     * Listeners are kept in one flat array per event type and are called in
+     * place, and queued events live in a single ring buffer, so dispatching
+     * doesn't allocate once the bus has warmed up.
+     *
+     * Listeners may add or remove listeners while an event is being
+     * dispatched. Removed listeners stop being called immediately; added
+     * listeners start with the next event.
+     *
+     * processEvents() honors its time budget: once it runs out, the rest of
+     * the queue is left in order for the next call. The time spent in
+     * listeners is recorded per event type; see getStatistics().
      */
     class EventBusImpl : public EventBus {
+    public:
+        /**
+         * Dispatch statistics for one event type.
+         */
+        struct EventTypeStatistics {
+            EventType type;
+            std::string name;
+            unsigned long count;
+            std::uint64_t totalNanoseconds;
+            std::uint64_t maxNanoseconds;
+
+            EventTypeStatistics();
+        };
+
+        typedef std::unordered_map<EventType, EventTypeStatistics> StatisticsMap;
+
     private:
-        typedef std::list<EventListenerDelegate> EventListenerList;
-        typedef std::map<EventType, EventListenerList> EventListenerMap;
-        typedef std::list<EventDataPtr> EventQueue;
+        typedef std::chrono::high_resolution_clock Clock;
+
+        struct Listener {
+            EventListenerDelegate delegate;
+            bool active;
+
+            Listener(const EventListenerDelegate & delegate);
+        };
+
+        typedef std::vector<Listener> EventListenerList;
+        typedef std::unordered_map<EventType, EventListenerList> EventListenerMap;
+        typedef std::vector<std::pair<EventType, EventListenerDelegate>> PendingListenerList;
+        typedef RingBuffer<EventDataPtr> EventQueue;
 
-        EventListenerMap eventListeners;
-        EventQueue eventQueues[2];
+        //
+        // Dispatching happens from triggerEvent() too, which is const, so the
+        // bookkeeping that lets listeners change during dispatch is mutable.
+        //
+        mutable EventListenerMap eventListeners;
+        mutable PendingListenerList pendingListeners;
+        mutable unsigned int dispatchDepth;
+        mutable bool hasInactiveListeners;
+        mutable StatisticsMap statistics;
+
+        EventQueue eventQueue;
+
+        /**
+         * Number of events at the front of the queue which belong to the
+         * current processEvents() call. Events behind them were queued while
+         * processing and wait for the next call.
+         */
+        std::size_t processingCount;
+
+        bool dispatch(const EventDataPtr & event, Clock::time_point & finishedAt) const;
+        void flushListenerChanges() const;
+        void recordDispatch(const EventData & event, Clock::duration elapsed) const;
 
-        int activeQueueIndex;
-        
     public:
         explicit EventBusImpl(const std::string & name, bool setAsGlobal);
         virtual ~EventBusImpl();
@@ -31,8 +92,23 @@ namespace hikari {
         virtual bool queueEvent(const EventDataPtr & event);
         virtual bool cancelEvent(const EventType & type, bool allOfType = false);
         virtual bool processEvents(unsigned long maxMillis = INFINITE);
+
+        /**
+         * Gets the number of events waiting to be processed, including any
+         * that were carried over because processEvents() ran out of time.
+         */
+        std::size_t getQueuedEventCount() const;
+
+        /**
+         * Gets dispatch statistics for every event type that has been
+         * dispatched since the last reset. Handler time covers every
+         * listener called for an event, whether it was queued or triggered.
+         */
+        const StatisticsMap & getStatistics() const;
+
+        void resetStatistics();
     };
 
 } // hikari
 
-#endif // HIKARI_CLIENT_EventBusIMPL
\ No newline at end of file
+#endif // HIKARI_CLIENT_EventBusIMPL
@@ -1,11 +1,29 @@
 #ifndef HIKARI_CLIENT_EVENTDATA
 #define HIKARI_CLIENT_EVENTDATA
 
+#include "hikari/core/util/StringHash.hpp"
+
 #include <memory>
 
+/*
+    Defines an event class's Type constant and remembers the class name, so
+    debug builds can show the type by name from startup. Use it once, in the
+    event's source file, inside namespace hikari:
+
+        HIKARI_DEFINE_EVENT_TYPE(DoorEventData);
+*/
+#define HIKARI_DEFINE_EVENT_TYPE(EventClass) \
+namespace { const ::hikari::StringHash EventClass##Name = ::hikari::rememberHashedString(#EventClass); } \
+static_assert(EventClass::Type == ::hikari::hashString(#EventClass), #EventClass "::Type must be the hash of its class name"); \
+constexpr ::hikari::EventType EventClass::Type
+
 namespace hikari {
 
-    typedef unsigned long EventType;
+    //
+    // Event types are hashes of the event class names, made with hashString so
+    // they are constant expressions and the same on every platform.
+    //
+    typedef StringHash EventType;
     typedef float EventTime;
 
     //
@@ -32,7 +32,7 @@ namespace hikari {
          * 
          * @param eventPtr EventDataPtr object containing event details
          */
-        void operator()(EventDataPtr eventPtr);
+        void operator()(const EventDataPtr & eventPtr) const;
 
         /**
          * Tests if two FunctionDelegateBase objects are the same. They are
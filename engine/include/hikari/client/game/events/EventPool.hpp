@@ -0,0 +1,25 @@
+#ifndef HIKARI_CLIENT_EVENTPOOL
+#define HIKARI_CLIENT_EVENTPOOL
+
+#include "hikari/core/util/BlockPool.hpp"
+
+#include <memory>
+#include <utility>
+
+namespace hikari {
+
+    /**
+     * Creates an event using pooled storage. Use this instead of new or
+     * std::make_shared for anything that is fired often.
+     *
+     * @param args arguments for the event's constructor
+     * @return the new event
+     */
+    template <typename T, typename... Args>
+    std::shared_ptr<T> makeEvent(Args &&... args) {
+        return std::allocate_shared<T>(BlockAllocator<T>(), std::forward<Args>(args)...);
+    }
+
+} // hikari
+
+#endif // HIKARI_CLIENT_EVENTPOOL
@@ -7,7 +7,7 @@ namespace hikari {
 
     class GameQuitEventData : public BaseEventData {
     public:
-        static const EventType Type;
+        static constexpr EventType Type = hashString("GameQuitEventData");
 
         enum QuitType {
             PROMPT_USER,
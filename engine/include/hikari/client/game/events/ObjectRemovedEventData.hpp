@@ -10,7 +10,7 @@ namespace hikari {
      */
     class ObjectRemovedEventData : public BaseEventData {
     public:
-        static const EventType Type;
+        static constexpr EventType Type = hashString("ObjectRemovedEventData");
 
     private:
         int objectId;
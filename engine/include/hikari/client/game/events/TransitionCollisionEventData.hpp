@@ -7,7 +7,7 @@ namespace hikari {
 
     class TransitionCollisionEventData : public BaseEventData {
     public:
-        static const EventType Type;
+        static constexpr EventType Type = hashString("TransitionCollisionEventData");
         
     public:
         TransitionCollisionEventData();
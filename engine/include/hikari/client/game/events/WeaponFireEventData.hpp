@@ -12,7 +12,7 @@ namespace hikari {
 
     class WeaponFireEventData : public BaseEventData {
     public:
-        static const EventType Type;
+        static constexpr EventType Type = hashString("WeaponFireEventData");
 
     private:
         int weaponId;  // id of the weapon to be fired
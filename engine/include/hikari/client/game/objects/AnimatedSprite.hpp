@@ -1,6 +1,7 @@
 #ifndef HIKARI_CLIENT_GAME_OBJECTS_ANIMATEDSPRITE
 #define HIKARI_CLIENT_GAME_OBJECTS_ANIMATEDSPRITE
 
+#include "hikari/core/game/AnimationSet.hpp"
 #include "hikari/core/game/SpriteAnimator.hpp"
 #include "hikari/core/game/Updatable.hpp"
 #include "hikari/core/math/Vector2.hpp"
@@ -16,7 +17,7 @@ namespace sf {
 
 namespace hikari {
     class Animation;
-    class AnimationSet;
+    class SpriteBatch;
 
     class AnimatedSprite {
     protected:
@@ -24,27 +25,47 @@ namespace hikari {
 
     private:
         std::string currentAnimation;
+        AnimationHandle currentHandle;
         std::weak_ptr<AnimationSet> animationSet;
         SpriteAnimator animator;
         bool isXAxisFlipped;
         bool isYAxisFlipped;
 
+        void applyAnimation(const AnimationSet & animSet, AnimationHandle handle);
+
     public:
         AnimatedSprite();
         AnimatedSprite(const AnimatedSprite & proto);
         virtual ~AnimatedSprite();
 
+        /**
+         * Takes on the texture, animation and orientation of another sprite,
+         * as if it had been copy-constructed from it, and starts the
+         * animation from the beginning.
+         *
+         * @param proto a sprite to copy from
+         */
+        void copyFrom(const AnimatedSprite & proto);
+
         //
         // Inherited from hikari::Updatable
         //
         virtual void update(float dt);
 
         virtual void render(sf::RenderTarget &target) const;
+        virtual void render(SpriteBatch &batch) const;
 
         void setAnimation(const std::string & animationName);
+
+        /**
+         * Changes the animation by its handle in the current AnimationSet.
+         * Setting the animation which is already playing costs a comparison.
+         */
+        void setAnimation(AnimationHandle animationHandle);
         void setAnimationSet(const std::weak_ptr<AnimationSet> & animationSetPtr);
 
         const std::string & getAnimation() const;
+        AnimationHandle getAnimationHandle() const;
         const std::weak_ptr<AnimationSet> getAnimationSet() const;
 
         bool isXFlipped() const;
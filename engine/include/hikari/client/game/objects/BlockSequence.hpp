@@ -47,6 +47,7 @@ namespace hikari {
         virtual void reset();
 
         virtual void render(sf::RenderTarget &target);
+        virtual void render(SpriteBatch &batch);
         virtual void setZIndex(int index);
         virtual int getZIndex() const;
 
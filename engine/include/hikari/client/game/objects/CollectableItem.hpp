@@ -33,6 +33,7 @@ namespace hikari {
 
         virtual void update(float dt);
         virtual void render(sf::RenderTarget &target);
+        virtual void render(SpriteBatch &batch);
         virtual void reset();
     };
 
@@ -35,11 +35,22 @@ namespace hikari {
 
         virtual std::unique_ptr<Enemy> clone() const;
 
+        /**
+         * Restores this enemy to the state of a fresh clone of a prototype.
+         * The sprite and the brain are reused; the brain is detached, reset
+         * and attached again, and isn't told about the deactivation that
+         * recycling causes. Used by ObjectPool.
+         *
+         * @param proto the prototype this enemy was cloned from
+         */
+        void recycle(const Enemy & proto);
+
         virtual void onActivated();
         virtual void onDeactivated();
 
         virtual void update(float dt);
         virtual void render(sf::RenderTarget &target);
+        virtual void render(SpriteBatch &batch);
 
         virtual void handleCollision(Movable& body, CollisionInfo& info);
 
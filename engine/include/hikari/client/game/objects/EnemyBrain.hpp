@@ -111,6 +111,22 @@ namespace hikari {
         virtual void update(float dt);
 
         virtual void applyConfig(const Sqrat::Table & instanceConfig);
+
+        /**
+         * Prepares for the brain to be cloned a number of times, so that the
+         * clones are cheap to make when they are needed. Does nothing by
+         * default.
+         *
+         * @param count how many clones to prepare for
+         */
+        virtual void prewarm(std::size_t count);
+
+        /**
+         * Puts the brain back into the state of a fresh clone, so it can be
+         * reused when its host is recycled. Only called while detached. Does
+         * nothing by default.
+         */
+        virtual void reset();
     };
 
 } // hikari
@@ -5,6 +5,7 @@
 #include <string>
 #include <unordered_map>
 
+#include "hikari/client/game/objects/ObjectPool.hpp"
 #include "hikari/core/util/Service.hpp"
 
 namespace hikari {
@@ -22,7 +23,7 @@ namespace hikari {
         std::weak_ptr<AnimationSetCache> animationSetCache;
         std::weak_ptr<ImageCache> imageCache;
         std::weak_ptr<SquirrelService> squirrel;
-        std::unordered_map<std::string, std::shared_ptr<Enemy>> prototypeRegistry;
+        std::unordered_map<std::string, std::shared_ptr<ObjectPool<Enemy>>> prototypeRegistry;
 
     public:
         //
@@ -34,7 +35,26 @@ namespace hikari {
         //
         // Methods
         //
-        std::unique_ptr<Enemy> create(const std::string& enemyType);
+        /**
+         * Creates an enemy from a registered prototype. Enemies which have
+         * been despawned and let go of are reused before any new ones are
+         * cloned; their brain is reset rather than cloned again, so spawners
+         * that keep producing the same enemy stop creating script instances
+         * once the first few have died.
+         *
+         * @param enemyType the name of the prototype
+         * @return an enemy, or nullptr if no such prototype is registered
+         */
+        std::shared_ptr<Enemy> create(const std::string& enemyType);
+
+        /**
+         * Prepares for a number of instances of a prototype to be created, so
+         * that creating them later is cheap. Unknown prototypes are ignored.
+         *
+         * @param enemyType the name of the prototype
+         * @param count     how many instances to prepare for
+         */
+        void prewarm(const std::string & enemyType, std::size_t count);
 
         void registerPrototype(const std::string & prototypeName, const std::shared_ptr<Enemy> & instancee);
     };
@@ -29,8 +29,6 @@ namespace hikari {
         bool wasReawoken;             // True after going to sleep and waking up
         Sqrat::Table instanceConfig;
 
-        void handleObjectRemovedEvent(EventDataPtr event);
-
     public:
         EnemySpawner(const std::string & enemyType, 
             unsigned int spawnLimit = DEFAULT_SPAWN_LIMIT, float spawnRate = DEFAULT_SPAWN_RATE);
@@ -38,8 +36,8 @@ namespace hikari {
         virtual ~EnemySpawner();
 
         virtual void performAction(GameWorld & world);
-        virtual void attachEventListeners(EventBus & EventBus);
-        virtual void detachEventListeners(EventBus & EventBus);
+        virtual void prepare(GameWorld & world);
+        virtual void onSpawnRemoved(int objectId);
 
         /**
          * Sets the limit on the number of Enemies the EnemySpawner can produce.
@@ -5,6 +5,7 @@
 #include "hikari/client/game/objects/HitBox.hpp"
 #include "hikari/client/game/objects/Faction.hpp"
 #include "hikari/client/game/objects/EntityDeathType.hpp"
+#include "hikari/core/game/AnimationSet.hpp"
 #include "hikari/core/game/Movable.hpp"
 #include "hikari/core/game/Renderable.hpp"
 #include "hikari/core/game/Direction.hpp"
@@ -12,6 +13,7 @@
 
 #include <SFML/Graphics/RectangleShape.hpp>
 
+#include <functional>
 #include <list>
 #include <memory>
 
@@ -38,6 +40,9 @@ namespace hikari {
      * subclasses of Entity.
      */
     class Entity : public GameObject, public Renderable {
+    public:
+        typedef std::function<void (Entity&)> ObstacleStatusCallback;
+
     private:
         static bool debug;
         static const float DEFAULT_AGE_IN_M_SECONDS;
@@ -64,6 +69,8 @@ namespace hikari {
         bool shieldFlag;   // Does this object deflect projectiles right now?
         bool agelessFlag;  // Does this object not experience aging?
 
+        ObstacleStatusCallback obstacleStatusCallback;
+
         float age;
         float maximumAge;
 
@@ -80,6 +87,17 @@ namespace hikari {
         std::list<Shot> activeShots;
 
         virtual void renderEntity(sf::RenderTarget &target);
+        virtual void renderEntity(SpriteBatch &batch);
+        void renderDebugBoxes(sf::RenderTarget &target);
+
+        /**
+         * Restores the Entity to the state of a fresh copy of a prototype,
+         * reusing its sprite instead of allocating a new one. Subclasses
+         * which are pooled call this from their own recycle method.
+         *
+         * @param proto the prototype this Entity was copied from
+         */
+        void recycle(const Entity & proto);
 
         /**
          * Removes any non-active shots that are currently being observed by the
@@ -106,9 +124,25 @@ namespace hikari {
         Entity(const Entity& proto);
         virtual ~Entity();
 
-        void setAnimationSet(const std::shared_ptr<AnimationSet> & newAnimationSet);
+        virtual void setAnimationSet(const std::shared_ptr<AnimationSet> & newAnimationSet);
         void changeAnimation(const std::string& animationName);
 
+        /**
+         * Changes the animation by handle. Handles come from
+         * getAnimationHandle() and stay valid for as long as the animation set
+         * doesn't change, so hot paths can resolve names once and skip string
+         * lookups from then on.
+         */
+        void changeAnimation(AnimationHandle animationHandle);
+
+        /**
+         * Gets the handle of a named animation in the current animation set.
+         *
+         * @return the handle, or AnimationSet::INVALID_HANDLE if there is no
+         *         such animation
+         */
+        AnimationHandle getAnimationHandle(const std::string& animationName) const;
+
         bool isUsingSharedPalette() const;
         void setUseSharedPalette(bool flag);
 
@@ -205,6 +239,16 @@ namespace hikari {
          */
         bool isObstacle() const;
 
+        /**
+         * Sets a function to call whenever this Entity's obstacle status
+         * changes. Only one can be set; GameWorld uses it to keep its index of
+         * obstacles up to date.
+         *
+         * @param callback the function to call, or an empty one for none
+         * @see Entity::setObstacle
+         */
+        void setObstacleStatusCallback(const ObstacleStatusCallback & callback);
+
         /**
          * Sets whether this Entity deflects projectiles or not.
          *
@@ -357,6 +401,14 @@ namespace hikari {
          */
         virtual void render(sf::RenderTarget &target);
 
+        /**
+         * Renders the entity into a sprite batch. Debug information is drawn
+         * straight to the batch's target, so the batch is flushed around it.
+         *
+         * @param batch a SpriteBatch to draw into
+         */
+        virtual void render(SpriteBatch &batch);
+
         virtual int getZIndex() const;
 
         virtual void setZIndex(int index);
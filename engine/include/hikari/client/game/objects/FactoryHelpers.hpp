@@ -54,12 +54,12 @@ namespace FactoryHelpers {
     );
 
     /**
-     * Populates an ParticleFactory with prototype instances loaded from a 
+     * Populates an ParticleFactory with particle templates loaded from a 
      * descriptor file.
      *
-     * This function loads a descriptor file and creates instances of 
-     * particles to be used as prototypes. These prototypes are then injected
-     * into a specified factory.
+     * This function loads a descriptor file and creates a template for each
+     * kind of particle. These templates are then injected into a specified
+     * factory.
      *
      * @param descriptorFilePath the path to the descriptor file
      * @param factory            the factory to populate
@@ -26,6 +26,12 @@ namespace hikari {
         virtual void onActivated();
         virtual void onDeactivated();
 
+        /**
+         * Gives this object a new ID. Pooled objects call this when they are
+         * handed out again so they can't be mistaken for their previous life.
+         */
+        void renewId();
+
     public:
         explicit GameObject(int id = generateObjectId());
         virtual ~GameObject();
@@ -5,6 +5,7 @@
 #include "hikari/client/game/objects/controllers/HeroActionController.hpp"
 #include "hikari/core/math/Vector2.hpp"
 #include <memory>
+#include <vector>
 
 namespace hikari {
 
@@ -76,6 +77,36 @@ namespace hikari {
         std::unique_ptr<ShootingState> shootingState;
         std::unique_ptr<ShootingState> nextShootingState;
 
+        /**
+         * The animations chooseAnimation() picks from. Their handles are looked
+         * up whenever the animation set changes, so picking one every tick
+         * doesn't involve any strings.
+         */
+        enum AnimationId {
+            ANIMATION_DAMAGED_STANDING = 0,
+            ANIMATION_MORPHING,
+            ANIMATION_TELEPORTING,
+            ANIMATION_CLIMBING_SHOOTING,
+            ANIMATION_CLIMBING_TOP,
+            ANIMATION_CLIMBING,
+            ANIMATION_RUNNING_STOPPING,
+            ANIMATION_STANDING_SHOOTING,
+            ANIMATION_STANDING,
+            ANIMATION_RUNNING_ACCELERATING,
+            ANIMATION_RUNNING_SHOOTING,
+            ANIMATION_RUNNING,
+            ANIMATION_SLIDING,
+            ANIMATION_JUMPING_SHOOTING,
+            ANIMATION_JUMPING,
+            ANIMATION_COUNT
+        };
+
+        static const char * ANIMATION_NAMES[ANIMATION_COUNT];
+
+        std::vector<AnimationHandle> animationHandles;
+
+        void useAnimation(AnimationId animation);
+
         /**
          * Determines whether the Hero can jump right now or not.
          */
@@ -230,8 +261,10 @@ namespace hikari {
         const Vector2<float>& getAmbientVelocity() const;
         void setAmbientVelocity(const Vector2<float> & velocity);
 
+        virtual void setAnimationSet(const std::shared_ptr<AnimationSet> & newAnimationSet);
         virtual void update(float dt);
         virtual void render(sf::RenderTarget &target);
+        virtual void render(SpriteBatch &batch);
         virtual void handleCollision(Movable& body, CollisionInfo& info);
         virtual void fireWeapon();
     };
@@ -0,0 +1,98 @@
+#ifndef HIKARI_CLIENT_GAME_OBJECTS_OBJECTPOOL
+#define HIKARI_CLIENT_GAME_OBJECTS_OBJECTPOOL
+
+#include "hikari/core/util/BlockPool.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace hikari {
+
+    /**
+     * A free list of instances of a single prototype. Instances are cloned
+     * from the prototype only when the free list runs dry; otherwise a
+     * returned instance is restored to the prototype's state and handed out
+     * again, which keeps spawning from cloning once a scene has warmed up.
+     *
+     * Each acquire() hands out a new shared_ptr whose deleter puts the
+     * instance back on the free list once the last reference is dropped.
+     * Because every lease has its own control block, weak_ptrs to an instance
+     * from a previous lease expire when it is returned and never see it come
+     * back to life. Instances returned after the pool is gone are deleted.
+     * The control blocks come from a BlockPool, so once a scene has warmed
+     * up leasing an instance doesn't touch the heap at all.
+     *
+     * Pools give their instances a weak reference to themselves, so they
+     * must be created with std::make_shared.
+     *
+     * T must provide clone() and recycle(const T &). recycle() must leave an
+     * instance in the same state as a fresh clone, reusing whatever it
+     * already owns.
+     */
+    template <typename T>
+    class ObjectPool : public std::enable_shared_from_this<ObjectPool<T>> {
+    private:
+        struct ReturnToPool {
+            std::weak_ptr<ObjectPool<T>> pool;
+
+            void operator()(T * instance) const {
+                if(auto owner = pool.lock()) {
+                    owner->available.emplace_back(instance);
+                } else {
+                    delete instance;
+                }
+            }
+        };
+
+        std::shared_ptr<T> prototype;
+        std::vector<std::unique_ptr<T>> available;
+        std::size_t createdCount;
+
+    public:
+        explicit ObjectPool(const std::shared_ptr<T> & prototype)
+            : prototype(prototype)
+            , available()
+            , createdCount(0)
+        {
+        }
+
+        const std::shared_ptr<T> & getPrototype() const {
+            return prototype;
+        }
+
+        /**
+         * Gets an instance which nothing else refers to, recycling a returned
+         * one when possible.
+         *
+         * @return an instance in the prototype's state
+         */
+        std::shared_ptr<T> acquire() {
+            std::unique_ptr<T> instance;
+
+            if(!available.empty()) {
+                instance = std::move(available.back());
+                available.pop_back();
+                instance->recycle(*prototype);
+            } else {
+                instance = prototype->clone();
+                ++createdCount;
+            }
+
+            ReturnToPool returnToPool;
+            returnToPool.pool = this->shared_from_this();
+
+            return std::shared_ptr<T>(instance.release(), returnToPool, BlockAllocator<T>());
+        }
+
+        std::size_t getAvailableCount() const {
+            return available.size();
+        }
+
+        std::size_t getCreatedCount() const {
+            return createdCount;
+        }
+    };
+
+} // hikari
+
+#endif // HIKARI_CLIENT_GAME_OBJECTS_OBJECTPOOL
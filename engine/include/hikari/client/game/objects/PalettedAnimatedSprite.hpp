@@ -31,6 +31,8 @@ namespace hikari {
         bool usePalette;
         bool useSharedPalette;
 
+        int getCurrentPaletteIndex() const;
+
     public:
         static void setShaderFile(const std::string & file);
         static void createColorTable(const std::vector<std::vector<sf::Color>> & colors);
@@ -43,12 +45,20 @@ namespace hikari {
         PalettedAnimatedSprite(const PalettedAnimatedSprite & proto);
         virtual ~PalettedAnimatedSprite();
 
+        /**
+         * Takes on the animation and palette settings of another sprite.
+         *
+         * @see AnimatedSprite::copyFrom
+         */
+        void copyFrom(const PalettedAnimatedSprite & proto);
+
         //
         // Inherited from hikari::Updatable
         //
         virtual void update(float dt);
 
         virtual void render(sf::RenderTarget &target) const;
+        virtual void render(SpriteBatch &batch) const;
 
         int getPaletteIndex() const;
         void setPaletteIndex(int index);
@@ -5,13 +5,13 @@
 #include <string>
 #include <unordered_map>
 
+#include "hikari/client/game/objects/ParticleTemplate.hpp"
 #include "hikari/core/util/Service.hpp"
 
 namespace hikari {
 
     class AnimationSetCache;
     class ImageCache;
-    class Particle;
 
     class ParticleFactory : public Service {
     private:
@@ -20,7 +20,7 @@ namespace hikari {
         //
         std::weak_ptr<AnimationSetCache> animationSetCache;
         std::weak_ptr<ImageCache> imageCache;
-        std::unordered_map<std::string, std::shared_ptr<Particle>> prototypeRegistry;
+        std::unordered_map<std::string, ParticleTemplate> templateRegistry;
 
     public:
         //
@@ -33,11 +33,17 @@ namespace hikari {
         //
         // Methods
         //
-        std::unique_ptr<Particle> create(const std::string& enemyType);
-
-        void registerPrototype(const std::string & prototypeName, const std::shared_ptr<Particle> & instancee);
+        /**
+         * Looks up a registered particle template.
+         *
+         * @param templateName the name of the template
+         * @return the template, or nullptr if no such template is registered
+         */
+        const ParticleTemplate * findTemplate(const std::string & templateName) const;
+
+        void registerTemplate(const std::string & templateName, const ParticleTemplate & particleTemplate);
     };
 
 } // hikari
 
-#endif // HIKARI_CLIENT_GAME_OBJECT_PARTICLEFACTORY
\ No newline at end of file
+#endif // HIKARI_CLIENT_GAME_OBJECT_PARTICLEFACTORY
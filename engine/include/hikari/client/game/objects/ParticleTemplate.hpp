@@ -0,0 +1,50 @@
+#ifndef HIKARI_CLIENT_GAME_OBJECTS_PARTICLETEMPLATE
+#define HIKARI_CLIENT_GAME_OBJECTS_PARTICLETEMPLATE
+
+#include "hikari/core/geom/BoundingBox.hpp"
+
+#include <memory>
+
+namespace sf {
+    class Texture;
+}
+
+namespace hikari {
+
+    class Animation;
+
+    /**
+     * Describes one kind of particle: what it looks like, how big it is and
+     * how long it lives. Templates are loaded from the particle descriptor
+     * file and spawned through a ParticleSystem.
+     *
+     * @see ParticleFactory
+     * @see ParticleSystem
+     */
+    struct ParticleTemplate {
+        std::shared_ptr<sf::Texture> texture;
+        std::shared_ptr<Animation> animation;
+
+        /**
+         * Size and origin of a particle. The position is ignored.
+         */
+        BoundingBox<float> boundingBox;
+
+        /**
+         * How long a particle lives, in seconds. Particles with a maximum age
+         * of zero or less live until they leave the screen.
+         */
+        float maximumAge;
+
+        ParticleTemplate()
+            : texture()
+            , animation()
+            , boundingBox(0.0f, 0.0f, 0.0f, 0.0f)
+            , maximumAge(0.0f)
+        {
+        }
+    };
+
+} // hikari
+
+#endif // HIKARI_CLIENT_GAME_OBJECTS_PARTICLETEMPLATE
@@ -32,8 +32,17 @@ namespace hikari {
 
         virtual std::unique_ptr<Projectile> clone() const;
 
+        /**
+         * Restores this projectile to the state of a fresh clone of a
+         * prototype, reusing its sprite. Used by ObjectPool.
+         *
+         * @param proto the prototype this projectile was cloned from
+         */
+        void recycle(const Projectile & proto);
+
         virtual void update(float dt);
         virtual void render(sf::RenderTarget &target);
+        virtual void render(SpriteBatch &batch);
 
         virtual void handleCollision(Movable& body, CollisionInfo& info);
 
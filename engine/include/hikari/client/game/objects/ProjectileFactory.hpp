@@ -5,6 +5,7 @@
 #include <string>
 #include <unordered_map>
 
+#include "hikari/client/game/objects/ObjectPool.hpp"
 #include "hikari/core/util/Service.hpp"
 
 namespace hikari {
@@ -22,7 +23,7 @@ namespace hikari {
         std::weak_ptr<AnimationSetCache> animationSetCache;
         std::weak_ptr<ImageCache> imageCache;
         std::weak_ptr<SquirrelService> squirrel;
-        std::unordered_map<std::string, std::shared_ptr<Projectile>> prototypeRegistry;
+        std::unordered_map<std::string, std::shared_ptr<ObjectPool<Projectile>>> prototypeRegistry;
 
     public:
         //
@@ -35,7 +36,18 @@ namespace hikari {
         //
         // Methods
         //
-        std::unique_ptr<Projectile> create(const std::string& enemyType);
+        /**
+         * Creates a projectile from a registered prototype. Weapons fire the
+         * same few projectile types over and over, so a projectile goes back
+         * to its prototype's pool as soon as the last reference to it is
+         * dropped, and the next shot of that type reuses it and its sprite.
+         * Owners tracking their shots by weak_ptr see a reused projectile as
+         * expired, not as their own shot coming back.
+         *
+         * @param projectileType the name of the prototype
+         * @return a projectile, or nullptr if no such prototype is registered
+         */
+        std::shared_ptr<Projectile> create(const std::string& projectileType);
 
         void registerPrototype(const std::string & prototypeName, const std::shared_ptr<Projectile> & instancee);
     };
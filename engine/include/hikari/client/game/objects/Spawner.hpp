@@ -18,7 +18,7 @@ namespace hikari {
      * A Spawner is responsible for spawning one or more objects in the game
      * world. It keeps track of whether its spawn should be alive or not.
     */
-    class Spawner : public GameObject {
+    class Spawner : public GameObject, public std::enable_shared_from_this<Spawner> {
     private:
         Direction direction;
         Vector2<float> position;
@@ -70,6 +70,25 @@ namespace hikari {
          */
         virtual void performAction(GameWorld & world);
 
+        /**
+         * Prepares anything the Spawner will need to spawn its offspring, so
+         * that performAction() is cheap. Called at times when nothing is being
+         * spawned: when the Spawner's room is entered and when it goes back to
+         * sleep. Does nothing by default.
+         *
+         * @param world the World that will be used for spawning
+         */
+        virtual void prepare(GameWorld & world);
+
+        /**
+         * Called when an object this Spawner owns is removed from the world.
+         * Spawners take ownership of what they spawn with
+         * GameWorld::setSpawnOwner. Does nothing by default.
+         *
+         * @param objectId the ID of the object that was removed
+         */
+        virtual void onSpawnRemoved(int objectId);
+
         /**
          * Attaches event listeners for the spawner to use.
          * 
@@ -0,0 +1,81 @@
+#ifndef HIKARI_CLIENT_GAME_OBJECTS_WARMPOOL
+#define HIKARI_CLIENT_GAME_OBJECTS_WARMPOOL
+
+#include <cstddef>
+#include <vector>
+
+namespace hikari {
+
+    /**
+     * A small stack of spare instances, so that whoever needs one can take
+     * it instead of paying to create it. Instances are handed back when
+     * their user is done with them, and the pool keeps at most a fixed
+     * number; anything beyond that is left to its owner to throw away.
+     *
+     * Unlike ObjectPool, a WarmPool doesn't create, lease or restore
+     * anything itself; if returned instances need restoring, that's up to
+     * whoever takes them. It's meant for handles to things living elsewhere
+     * (like instances in a scripting VM) which are cheap to copy but costly
+     * to make.
+     */
+    template <typename T>
+    class WarmPool {
+    private:
+        std::size_t capacity;
+        std::vector<T> instances;
+
+    public:
+        explicit WarmPool(std::size_t capacity)
+            : capacity(capacity)
+            , instances()
+        {
+        }
+
+        /**
+         * Takes the most recently returned instance.
+         *
+         * @param instance set to the taken instance, if there was one
+         * @return true if an instance was taken, false if the pool is empty
+         */
+        bool take(T & instance) {
+            if(instances.empty()) {
+                return false;
+            }
+
+            instance = instances.back();
+            instances.pop_back();
+
+            return true;
+        }
+
+        /**
+         * Adds an instance to the pool.
+         *
+         * @return true if the pool kept the instance, false if it was full
+         */
+        bool give(const T & instance) {
+            if(isFull()) {
+                return false;
+            }
+
+            instances.push_back(instance);
+
+            return true;
+        }
+
+        bool isFull() const {
+            return instances.size() >= capacity;
+        }
+
+        std::size_t getSize() const {
+            return instances.size();
+        }
+
+        std::size_t getCapacity() const {
+            return capacity;
+        }
+    };
+
+} // hikari
+
+#endif // HIKARI_CLIENT_GAME_OBJECTS_WARMPOOL
@@ -5,8 +5,12 @@
 #include <squirrel.h>
 #include <sqrat.h>
 
+#include <memory>
+#include <string>
+
 namespace hikari {
 
+    class BehaviorUpdateBatch;
     class SquirrelService;
 
     /**
@@ -16,6 +20,9 @@ namespace hikari {
      */
     class ScriptedEnemyBrain : public EnemyBrain {
     private:
+        struct ScriptClass;
+
+        static const char * FUNCTION_NAME_CONSTRUCTOR;
         static const char * FUNCTION_NAME_ATTACH;
         static const char * FUNCTION_NAME_DETACH;
         static const char * FUNCTION_NAME_APPLYCONFIG;
@@ -26,12 +33,21 @@ namespace hikari {
         static const char * FUNCTION_NAME_ONDEACTIVATED;
         static const char * BASE_CLASS_NAME;
 
+        /** The most instances kept ready to bind for one prototype */
+        static const std::size_t MAX_WARM_INSTANCES;
+
         /** A handle to the Squirrel VM */
         HSQUIRRELVM vm;
 
+        /** Where update() queues the instance while a batch is open */
+        BehaviorUpdateBatch * updateBatch;
+
         /** The name of the class in the scripting enviornment to bind to */
         std::string scriptClassName;
 
+        /** The resolved class, shared by a prototype and all of its clones */
+        std::shared_ptr<ScriptClass> scriptClass;
+
         /** A handle to the instance object we create in the VM */
         Sqrat::Object instance;
 
@@ -48,8 +64,33 @@ namespace hikari {
         Sqrat::Function proxyHandleObjectTouch;
 
         /**
-         * Creates an instance of the behavior in the VM and binds it to this
-         * object.
+         * Looks up the script class and its methods by name.
+         *
+         * @return the resolved class, or nullptr if there is no such class
+         */
+        std::shared_ptr<ScriptClass> resolveScriptClass() const;
+
+        /**
+         * Creates an instance of the script class in the VM and runs its
+         * constructor with the class-level configuration.
+         */
+        Sqrat::Object createInstance() const;
+
+        /**
+         * Runs the script class' constructor on an instance with the
+         * class-level configuration.
+         */
+        void construct(const Sqrat::Object & target) const;
+
+        /**
+         * Puts an instance's variables back to the class defaults and runs its
+         * constructor again, leaving it as good as a newly created one.
+         */
+        void resetInstance(const Sqrat::Object & target) const;
+
+        /**
+         * Takes a warm instance of the behavior, or creates one, and binds it
+         * to this object.
          *
          * @return true if binding was successful, false if anything went wrong
          */
@@ -69,7 +110,9 @@ namespace hikari {
         ScriptedEnemyBrain(const ScriptedEnemyBrain & proto);
 
         /**
-         * Destructor.
+         * Destructor. The bound instance is kept for the next clone to bind,
+         * unless enough are kept already. It's reset when it's bound, not
+         * here, so that destroying a brain never calls into the VM.
          */
         virtual ~ScriptedEnemyBrain();
 
@@ -88,6 +131,18 @@ namespace hikari {
         virtual void handleObjectTouch(int otherId);
         virtual void update(float dt);
         virtual void applyConfig(const Sqrat::Table & instanceConfig);
+
+        /**
+         * Constructs instances of the script class ahead of time, so that
+         * cloning the brain only has to bind one. The instances are shared by
+         * all clones of the same prototype.
+         */
+        virtual void prewarm(std::size_t count);
+
+        /**
+         * Resets the bound instance in place instead of creating another one.
+         */
+        virtual void reset();
     };
 
 } // hikari
@@ -5,9 +5,11 @@
 
 #include <SFML/Graphics.hpp>
 
+#include <functional>
 #include <memory>
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace hikari {
@@ -17,7 +19,22 @@ namespace hikari {
 namespace gui {
 
     class CommandConsole : public Widget {
+    public:
+        typedef std::vector<std::string> CommandArguments;
+
+        /**
+         * Called when a command is committed. Receives the words which
+         * followed the command's name and the console, for printing output.
+         */
+        typedef std::function<void(const CommandArguments &, CommandConsole &)> CommandHandler;
+
     private:
+        /**
+         * How many lines of commands and output are kept. Older lines are
+         * dropped as new ones come in.
+         */
+        static const unsigned int MAX_HISTORY_LENGTH;
+
         enum ConsoleState {
             StateOpen = 0,
             StateOpening = 1,
@@ -29,9 +46,12 @@ namespace gui {
         ConsoleState state;
         std::string commandBuffer;
         std::vector<std::string> commandHistory;
+        std::unordered_map<std::string, CommandHandler> commands;
         std::shared_ptr<hikari::ImageFont> font;
         sf::RectangleShape background;
 
+        void appendToHistory(const std::string & line);
+
     public:
         CommandConsole(const std::shared_ptr<hikari::ImageFont> &font);
         virtual ~CommandConsole() {}
@@ -42,9 +62,25 @@ namespace gui {
         void setCommandBuffer(const std::string& buffer);
         void commitCommand();
 
+        /**
+         * Registers a command, replacing any existing command with that name.
+         */
+        void addCommand(const std::string & name, const CommandHandler & handler);
+        void removeCommand(const std::string & name);
+
+        /**
+         * Adds a line of output below the commands that have been entered.
+         */
+        void print(const std::string & line);
+
         const bool isOpen() const;
         void toggle();
 
+        /**
+         * Closes the console right away, without sliding it out of view.
+         */
+        void close();
+
         const bool isVisible() const;
         void setVisible(bool visibility);
 
@@ -0,0 +1,32 @@
+#ifndef HIKARI_CLIENT_GUI_CONSOLECOMMANDS
+#define HIKARI_CLIENT_GUI_CONSOLECOMMANDS
+
+#include <memory>
+#include <string>
+
+namespace hikari {
+
+    class EventBusImpl;
+
+namespace gui {
+
+    class CommandConsole;
+
+    /**
+     * Registers a command which prints an EventBusImpl's per-type dispatch
+     * statistics, most expensive first:
+     *
+     *   <name>        shows the top event types by total handler time
+     *   <name> all    shows every event type
+     *   <name> reset  clears the statistics
+     *
+     * @param console  the console to register the command with
+     * @param name     the name of the command
+     * @param eventBus the bus to report on
+     */
+    void registerEventBusCommands(CommandConsole & console, const std::string & name, const std::weak_ptr<EventBusImpl> & eventBus);
+
+} // hikari::gui
+} // hikari
+
+#endif // HIKARI_CLIENT_GUI_CONSOLECOMMANDS
@@ -0,0 +1,38 @@
+#ifndef HIKARI_CLIENT_GUI_PROFILEROVERLAY
+#define HIKARI_CLIENT_GUI_PROFILEROVERLAY
+
+#include <guichan/widget.hpp>
+
+namespace hikari {
+
+    class Profiler;
+
+namespace gui {
+
+    /**
+     * Shows the frame rate and the most expensive profiler zones, averaged
+     * over the last second or so. Meant to sit in the HUD container.
+     */
+    class ProfilerOverlay : public gcn::Widget {
+    private:
+        static const unsigned int DEFAULT_WIDTH;
+        static const unsigned int DEFAULT_BACKGROUND_COLOR;
+        static const unsigned int DEFAULT_FOREGROUND_COLOR;
+        static const int DEFAULT_BACKGROUND_ALPHA;
+        static const unsigned int SAMPLE_FRAME_COUNT;
+        static const unsigned int MAX_ZONE_LINES;
+
+        const Profiler & profiler;
+
+    public:
+        explicit ProfilerOverlay(const Profiler & profiler);
+        virtual ~ProfilerOverlay();
+
+        //Inherited from Widget
+        virtual void draw(gcn::Graphics* graphics);
+    };
+
+} // hikari::gui
+} // hikari
+
+#endif // HIKARI_CLIENT_GUI_PROFILEROVERLAY
@@ -0,0 +1,59 @@
+#ifndef HIKARI_CLIENT_SCRIPTING_BEHAVIORUPDATEBATCH
+#define HIKARI_CLIENT_SCRIPTING_BEHAVIORUPDATEBATCH
+
+#include <squirrel.h>
+#include <sqrat.h>
+
+namespace hikari {
+
+    /**
+     * Collects scripted behavior instances which need updating and updates
+     * them all with a single call into the VM.
+     *
+     * Calling into the VM once per behavior costs more than most behaviors'
+     * update methods do, so while a batch is open, ScriptedEnemyBrain adds
+     * its instance here instead. dispatch() then hands the whole batch to
+     * ::hikari.internal.updateBehaviors, which loops over it in script.
+     *
+     * The array the instances travel in is kept between frames so it only
+     * has to grow when more behaviors are active than ever before.
+     */
+    class BehaviorUpdateBatch {
+    private:
+        static const char * DISPATCH_FUNCTION_NAME;
+
+        HSQUIRRELVM vm;
+        Sqrat::Array instances;
+        Sqrat::Function dispatchFunction;
+        SQInteger capacity;
+        SQInteger count;
+        bool open;
+
+        bool bindDispatchFunction();
+
+    public:
+        explicit BehaviorUpdateBatch(HSQUIRRELVM vm);
+
+        /**
+         * Opens the batch. Behaviors updated from now until dispatch() are
+         * queued instead of being updated right away.
+         */
+        void begin();
+
+        bool isOpen() const;
+
+        /**
+         * Queues a behavior instance to be updated on dispatch().
+         */
+        void add(const Sqrat::Object & instance);
+
+        /**
+         * Updates every queued behavior, in the order they were added, and
+         * closes the batch.
+         */
+        void dispatch(float dt);
+    };
+
+} // hikari
+
+#endif // HIKARI_CLIENT_SCRIPTING_BEHAVIORUPDATEBATCH
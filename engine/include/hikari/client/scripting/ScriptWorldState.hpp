@@ -0,0 +1,56 @@
+#ifndef HIKARI_CLIENT_SCRIPTING_SCRIPTWORLDSTATE
+#define HIKARI_CLIENT_SCRIPTING_SCRIPTWORLDSTATE
+
+#include <squirrel.h>
+#include <sqrat.h>
+
+namespace hikari {
+
+    /**
+     * Publishes per-frame world state (where the hero is, etc.) to scripts
+     * through the ::world table.
+     *
+     * The table and its key strings are created once, so publishing only
+     * writes values into slots that already exist instead of interning key
+     * names and creating root table slots every frame.
+     */
+    class ScriptWorldState {
+    private:
+        static const char * TABLE_NAME;
+        static const char * KEY_HERO_ID;
+        static const char * KEY_HERO_X;
+        static const char * KEY_HERO_Y;
+        static const char * KEY_HERO_BOTTOM_Y;
+        static const char * KEY_IS_HERO_SHOOTING;
+
+        HSQUIRRELVM vm;
+        Sqrat::Table table;
+        Sqrat::Object keyHeroId;
+        Sqrat::Object keyHeroX;
+        Sqrat::Object keyHeroY;
+        Sqrat::Object keyHeroBottomY;
+        Sqrat::Object keyIsHeroShooting;
+
+        Sqrat::Object makeKey(const char * name) const;
+
+        template <typename T>
+        void setSlot(const Sqrat::Object & key, const T & value) {
+            sq_pushobject(vm, table.GetObject());
+            sq_pushobject(vm, key.GetObject());
+            Sqrat::PushVar(vm, value);
+            sq_rawset(vm, -3);
+            sq_pop(vm, 1);
+        }
+
+    public:
+        /**
+         * Binds to the ::world table, creating it if scripts haven't already.
+         */
+        explicit ScriptWorldState(HSQUIRRELVM vm);
+
+        void publish(int heroId, float heroX, float heroY, float heroBottomY, bool isHeroShooting);
+    };
+
+} // hikari
+
+#endif // HIKARI_CLIENT_SCRIPTING_SCRIPTWORLDSTATE
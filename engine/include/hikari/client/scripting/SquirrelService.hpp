@@ -6,10 +6,13 @@
 #include <squirrel.h>
 #include <sqstdmath.h>
 
+#include <memory>
 #include <string>
 
 namespace hikari {
 
+    class BehaviorUpdateBatch;
+
     class SquirrelService : public Service {
     private:
         static void squirrelPrintFunction(HSQUIRRELVM vm, const SQChar *s, ...);
@@ -20,6 +23,7 @@ namespace hikari {
 
         SQInteger initialStackSize;
         HSQUIRRELVM vm;
+        std::unique_ptr<BehaviorUpdateBatch> behaviorUpdateBatch;
 
         void initVirtualMachine();
         void initStandardLibraries();
@@ -33,6 +37,11 @@ namespace hikari {
 
         const HSQUIRRELVM getVmInstance();
 
+        /**
+         * Gets the batch which scripted behaviors are updated through.
+         */
+        BehaviorUpdateBatch & getBehaviorUpdateBatch();
+
         void runScriptFile(const std::string & fileName);
         void runScriptString(const std::string & scriptString);
         void collectGarbage();
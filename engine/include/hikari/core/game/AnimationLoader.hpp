@@ -2,6 +2,7 @@
 #define HIKARI_CORE_GAME_ANIMATIONLOADER
 
 #include "hikari/core/Platform.hpp"
+#include "hikari/core/geom/Point2D.hpp"
 #include <memory>
 #include <string>
 
@@ -21,7 +22,15 @@ namespace hikari {
         std::shared_ptr<AnimationSet> loadSet(const std::string &fileName);
         AnimationLoader(const std::weak_ptr<ImageCache> & imageCache);
         static void setImageCache(const std::weak_ptr<ImageCache> & imageCache);
-        std::shared_ptr<Animation> loadFromJsonObject(const Json::Value &json);
+
+        /**
+         * Loads an animation from JSON.
+         *
+         * @param json         the animation's JSON
+         * @param sourceOffset added to every frame's source rectangle; use
+         *                     the position of the image in its atlas page
+         */
+        std::shared_ptr<Animation> loadFromJsonObject(const Json::Value &json, const Point2D<int> &sourceOffset = Point2D<int>(0, 0));
     private:
         static const char* PROPERTY_NAME;
         static const char* PROPERTY_ALIASES;
@@ -39,7 +48,7 @@ namespace hikari {
         static const char* PROPERTY_FRAME_HOTSPOT_X;
         static const char* PROPERTY_FRAME_HOTSPOT_Y;
         static std::weak_ptr<ImageCache> imageCache;
-        static std::shared_ptr<Animation> loadFromJson(const Json::Value &json);
+        static std::shared_ptr<Animation> loadFromJson(const Json::Value &json, const Point2D<int> &sourceOffset = Point2D<int>(0, 0));
     };
     
 } // hikari
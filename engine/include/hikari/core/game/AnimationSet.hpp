@@ -7,6 +7,7 @@
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace sf {
     class Texture;
@@ -16,6 +17,13 @@ namespace hikari {
 
     typedef std::shared_ptr<Animation> AnimationPtr;
 
+    /**
+        Identifies an animation within one AnimationSet. Handles are given out
+        as animations are added, so looking one up is an index instead of a
+        string hash. A handle from one AnimationSet means nothing to another.
+    */
+    typedef int AnimationHandle;
+
     /**
         A set of Animation objects. Associates a name with an animation object.
     */
@@ -24,10 +32,13 @@ namespace hikari {
         std::string name;
         std::string imageFileName;
         std::shared_ptr<sf::Texture> texture;
-        std::unordered_map<std::string, AnimationPtr> animationMap;
+        std::vector<AnimationPtr> animations;
+        std::vector<std::string> animationNames;
+        std::unordered_map<std::string, AnimationHandle> handleMap;
 
     public:
         static const AnimationPtr NULL_ANIMATION;
+        static const AnimationHandle INVALID_HANDLE;
 
         AnimationSet(const std::string& name, const std::string& imageFileName, const std::shared_ptr<sf::Texture> & texture);
 
@@ -39,8 +50,30 @@ namespace hikari {
         bool has(const std::string& name) const;
         bool remove(const std::string& name);
         const AnimationPtr& get(const std::string& name);
+
+        /**
+            Gets the handle of a named animation. Handles stay the same for as
+            long as the animation is in the set.
+
+            @return the handle, or INVALID_HANDLE if there is no such animation
+        */
+        AnimationHandle getHandle(const std::string& name) const;
+
+        /**
+            Gets an animation by its handle.
+
+            @return the animation, or NULL_ANIMATION if the handle is not valid
+        */
+        const AnimationPtr& get(AnimationHandle handle) const;
+
+        /**
+            Gets the name of an animation by its handle.
+
+            @return the name, or an empty string if the handle is not valid
+        */
+        const std::string& getName(AnimationHandle handle) const;
     };
 
 } // hikari
 
-#endif // HIKARI_CORE_GAME_ANIMATIONSET
\ No newline at end of file
+#endif // HIKARI_CORE_GAME_ANIMATIONSET
@@ -72,6 +72,15 @@ namespace hikari {
         Movable(const Movable& proto);
         virtual ~Movable();
 
+        /**
+         * Copies the physical state (flags, velocities, bounds) of another
+         * Movable. Unlike the copy constructor this leaves the callbacks
+         * alone, so an owner can reset its body without rebinding them.
+         *
+         * @param proto a Movable to copy the state of
+         */
+        void copyState(const Movable & proto);
+
         /**
          * Indicates whether the Movable is on the ground right now or not.
          *
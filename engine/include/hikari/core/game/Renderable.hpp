@@ -7,6 +7,8 @@ namespace sf {
 
 namespace hikari {
 
+    class SpriteBatch;
+
     /**
      * Interface for all things that can be rendered to the screen.
      */
@@ -25,6 +27,13 @@ namespace hikari {
          */
         virtual void render(sf::RenderTarget & target) = 0;
 
+        /**
+         * Renders an object into a sprite batch, so that it can share draw
+         * calls with the objects drawn around it.
+         * @param batch the sprite batch
+         */
+        virtual void render(SpriteBatch & batch) = 0;
+
         /**
          * Sets the z-index of this Renderable. The z-index affects rendering order.
          * @param index a new value for this object's z-index
@@ -4,9 +4,11 @@
 #include "hikari/core/game/CollisionResolver.hpp"
 #include "hikari/core/geom/BoundingBox.hpp"
 #include <memory>
+#include <vector>
 
 namespace hikari {
 
+    class Entity;
     class GameWorld;
 
     /**
@@ -18,6 +20,7 @@ namespace hikari {
     private:
         GameWorld * world; // Non-owning pointer
         BoundingBox<int> tileBounds;
+        std::vector<Entity*> nearbyObstacles; // Reused between sweeps to avoid allocating
 
         void sweepHorizontalEdge(const int& x, const int& yMin, const int& yMax, const Direction& directionX, CollisionInfo& collisionInfo);
         void sweepVerticalEdge(const int& y, const int& xMin, const int& xMax, const Direction& directionY, CollisionInfo& collisionInfo);
@@ -4,8 +4,10 @@
 #include "hikari/core/Platform.hpp"
 #include "hikari/core/geom/Rectangle2D.hpp"
 
+#include <functional>
 #include <memory>
-
+#include <mutex>
+#include <string>
 #include <vector>
 
 #if (_WIN32 && _MSC_VER)
@@ -25,6 +27,18 @@ namespace hikari {
      * 
      */
     class HIKARI_API Map {
+    public:
+        /**
+         * Constructs the room with a given index when it is first requested.
+         */
+        typedef std::function<RoomPtr (unsigned int)> RoomProvider;
+
+        /**
+         * Blocks until the rooms a RoomProvider is preparing in the
+         * background are ready.
+         */
+        typedef std::function<void ()> RoomPreloader;
+
     private:
         int gridSize;
         std::string musicName;
@@ -34,8 +48,11 @@ namespace hikari {
         unsigned int bossCorridorRoomIndex; // Index of the room where the hero spawns from if he reached the boss chamber
         unsigned int bossChamberRoomIndex;  // Index of the room where the hero fights the boss
         TileDataPtr tileset;
-        std::vector<RoomPtr> rooms;
+        std::vector<RoomPtr> rooms;                     // rooms which haven't been provided yet are empty
+        mutable std::mutex roomsMutex;                  // guards rooms while they are being provided
         std::vector< Rectangle2D<int> > roomRectangles; // stores room locations and dimensions in pixels
+        RoomProvider roomProvider;
+        RoomPreloader roomPreloader;
 
         /**
          * Constructs rectangles that represent the size and location of each
@@ -50,6 +67,19 @@ namespace hikari {
         Map(const TileDataPtr &tileset, const int &gridSize, const std::string & musicName, const std::string & bossEntity, const std::vector<RoomPtr> &rooms, 
             unsigned int startRoomIndex = 0, unsigned int midpointRoomIndex = 0, unsigned int bossCorridorRoomIndex = 0, unsigned int bossChamberRoomIndex = 0);
 
+        /**
+         * Creates a map whose rooms are constructed on demand by a
+         * RoomProvider. Only the location and size of each room is needed up
+         * front.
+         *
+         * @param roomRectangles the location and size of each room, in pixels
+         * @param roomProvider   called to construct a room the first time it is requested
+         * @param roomPreloader  called to wait for rooms the provider prepares ahead of time
+         */
+        Map(const TileDataPtr &tileset, const int &gridSize, const std::string & musicName, const std::string & bossEntity,
+            const std::vector< Rectangle2D<int> > &roomRectangles, const RoomProvider &roomProvider, const RoomPreloader &roomPreloader,
+            unsigned int startRoomIndex = 0, unsigned int midpointRoomIndex = 0, unsigned int bossCorridorRoomIndex = 0, unsigned int bossChamberRoomIndex = 0);
+
         /**
          * Gets a pointer to the Tileset used by this Map.
          *
@@ -84,24 +114,24 @@ namespace hikari {
         /**
          * Gets a pointer to the Room specified as the "starting" room.
          */
-        RoomPtr getStartingRoom() const;
+        RoomPtr getStartingRoom();
 
         /**
          * Gets a pointer to the Room specified as the "midpoint" room.
          */
-        RoomPtr getMidpointRoom() const;
+        RoomPtr getMidpointRoom();
 
         /**
          * Gets a pointer to the Room specified as the "boss corridor" room,
          * which is the room before the boss chamber.
          */
-        RoomPtr getBossCorridorRoom() const;
+        RoomPtr getBossCorridorRoom();
 
         /**
          * Gets a pointer to the Room specified as the "boss chamber" room,
          * which is the room where the hero fights the boss.
          */
-        RoomPtr getBossChamberRoom() const;
+        RoomPtr getBossChamberRoom();
 
         /**
          * Gets the number of rooms that exist in the map.
@@ -112,11 +142,30 @@ namespace hikari {
         * Gets a pointer to the map data of the room with a specific index.
         * If no room can be found and the specified index, an empty pointer
         * is returned.
+        *
+        * Rooms of maps created with a RoomProvider are constructed here the
+        * first time they are requested, which is why this isn't const.
         * 
         * @param  index index of the room to get
         * @return       pointer to room at (index) or nullptr if not found
         */
-        const RoomPtr getRoom(unsigned int index) const;
+        RoomPtr getRoom(unsigned int index);
+
+        /**
+            Checks whether the room with a given index has been constructed
+            yet. Rooms of maps created with a RoomProvider are constructed the
+            first time getRoom is called for them.
+
+            @param index the index of the room
+        */
+        bool isRoomLoaded(unsigned int index) const;
+
+        /**
+            Waits until rooms which are being prepared ahead of time are
+            ready, so that entering them later doesn't stall. Call it while
+            nothing is being shown, such as before fading in.
+        */
+        void waitForRooms();
 
         /**
             Gets the rectangle which represents a given room in pixels in world
@@ -2,6 +2,9 @@
 #define HIKARI_CORE_GAME_MAP_MAPLOADER
 
 #include "hikari/core/Platform.hpp"
+#include "hikari/core/game/map/RoomStreamer.hpp"
+#include "hikari/core/game/map/StageCompiler.hpp"
+#include "hikari/core/game/map/StageFormat.hpp"
 #include "hikari/core/geom/Rectangle2D.hpp"
 #include "hikari/core/util/Service.hpp"
 #include "hikari/core/util/TilesetCache.hpp"
@@ -9,6 +12,7 @@
 #include <memory>
 #include <json/value.h>
 #include <string>
+#include <vector>
 
 namespace hikari {
 
@@ -18,77 +22,18 @@ namespace hikari {
     class Map;
     class Door;
     class Room;
-    class RoomTransition;
-    class BlockSequenceDescriptor;
     class Spawner;
     class Force;
+    class StageReader;
+    class RoomStreamWorker;
 
     typedef std::shared_ptr<Map> MapPtr;
     typedef std::shared_ptr<Room> RoomPtr;
     typedef std::shared_ptr<Spawner> SpawnerPtr;
     typedef std::shared_ptr<Force> ForcePtr;
 
-    class HIKARI_API MapLoader : public Service {
+    class HIKARI_API MapLoader : public Service, public std::enable_shared_from_this<MapLoader> {
     private:
-        static const char* PROP_TILESET;
-        static const char* PROP_ROOMS;
-        static const char* PROP_GRIDSIZE;
-        static const char* PROP_MUSICID;
-        static const char* PROP_MUSICNAME;
-        static const char* PROP_SPECIAL_ROOMS;
-        static const char* PROP_SPECIAL_ROOM_STARTING;
-        static const char* PROP_SPECIAL_ROOM_MIDPOINT;
-        static const char* PROP_SPECIAL_ROOM_BOSS_CORRIDOR;
-        static const char* PROP_SPECIAL_ROOM_BOSS_CHAMBER;
-        static const char* PROP_BOSS_ENTITY;
-        static const char* PROP_ROOM_ID;
-        static const char* PROP_ROOM_X;
-        static const char* PROP_ROOM_Y;
-        static const char* PROP_ROOM_HERO_SPAWN_X;
-        static const char* PROP_ROOM_HERO_SPAWN_Y;
-        static const char* PROP_ROOM_WIDTH;
-        static const char* PROP_ROOM_HEIGHT;
-        static const char* PROP_ROOM_BG_COLOR;
-        static const char* PROP_ROOM_CAMERABOUNDS;
-        static const char* PROP_ROOM_CAMERABOUNDS_X;
-        static const char* PROP_ROOM_CAMERABOUNDS_Y;
-        static const char* PROP_ROOM_CAMERABOUNDS_WIDTH;
-        static const char* PROP_ROOM_CAMERABOUNDS_HEIGHT;
-        static const char* PROP_ROOM_TILE;
-        static const char* PROP_ROOM_TILEATTRIBUTES;
-        static const char* PROP_ROOM_ENEMIES;
-        static const char* PROP_ROOM_ENEMIES_TYPE;
-        static const char* PROP_ROOM_ENEMIES_POSITION;
-        static const char* PROP_ROOM_ENEMIES_POSITION_X;
-        static const char* PROP_ROOM_ENEMIES_POSITION_Y;
-        static const char* PROP_ROOM_ENEMIES_DIRECTION;
-        static const char* PROP_ROOM_ITEMS;
-        static const char* PROP_ROOM_ITEMS_TYPE;
-        static const char* PROP_ROOM_ITEMS_X;
-        static const char* PROP_ROOM_ITEMS_Y;
-        static const char* PROP_ROOM_TRANSITIONS;
-        static const char* PROP_ROOM_DOORS;
-        static const char* PROP_ROOM_DOORS_X;
-        static const char* PROP_ROOM_DOORS_Y;
-        static const char* PROP_ROOM_DOORS_WIDTH;
-        static const char* PROP_ROOM_DOORS_HEIGHT;
-        static const char* PROP_ROOM_DOORS_ENTRANCE;
-        static const char* PROP_ROOM_DOORS_EXIT;
-        static const char* PROP_ROOM_BLOCKSEQUENCES;
-        static const char* PROP_ROOM_BLOCKSEQUENCES_X;
-        static const char* PROP_ROOM_BLOCKSEQUENCES_Y;
-        static const char* PROP_ROOM_BLOCKSEQUENCES_WIDTH;
-        static const char* PROP_ROOM_BLOCKSEQUENCES_HEIGHT;
-        static const char* PROP_ROOM_BLOCKSEQUENCES_BLOCKS;
-        static const char* PROP_ROOM_BLOCKSEQUENCES_SEQUENCE;
-        static const char* PROP_ROOM_BLOCKSEQUENCES_INTERVAL;
-        static const char* PROP_ROOM_BLOCKSEQUENCES_MAXIMUM_BLOCK_AGE;
-        static const char* PROP_ROOM_BLOCKSEQUENCES_ENTITY;
-        static const char* PROP_ROOM_BLOCKSEQUENCES_SPAWN_SOUND;
-
-        static const int DEFAULT_HERO_SPAWN_X;
-        static const int DEFAULT_HERO_SPAWN_Y;
-
         enum SpawnType {
             SPAWN_ENEMY = 1,
             SPAWN_ITEM  = 2
@@ -97,19 +42,21 @@ namespace hikari {
         std::shared_ptr<AnimationSetCache> animationSetCache;
         std::shared_ptr<ImageCache> imageCache;
         std::shared_ptr<TilesetCache> tilesetCache;
+        StageCompiler compiler;
+        std::shared_ptr<RoomStreamWorker> roomStreamWorker; // shared by the streamers of every map loaded
 
         MapPtr constructMap(const Json::Value &json) const;
-        RoomPtr constructRoom(const Json::Value &json, int gridSize) const;
-        SpawnerPtr constructSpawner(const Json::Value &json, SpawnType type, int offsetX = 0, int offsetY = 0) const;
-        ForcePtr constructForce(const Json::Value &json, int offsetX = 0, int offsetY = 0) const;
-        std::unique_ptr<Door> constructDoor(const Json::Value & json, int offsetX = 0, int offsetY = 0) const;
-        RoomTransition constructTransition(const Json::Value &json) const;
-        BlockSequenceDescriptor constructBlockSequence(const Json::Value &json,
-            int roomX, int roomY, int gridSize) const;
-        Rectangle2D<int> constructCameraBounds(const Json::Value &json,
-            int roomX, int roomY, int gridSize) const;
-        bool validateMapStructure(const Json::Value &json) const;
-        bool validateRoomStructure(const Json::Value &json) const;
+        MapPtr constructStreamedMap(const StageInfo &info, const std::vector<Rectangle2D<int>> &roomRectangles,
+            const RoomStreamer::RoomSource &source) const;
+        TileDataPtr loadTileset(const std::string &tilesetName) const;
+
+        /**
+         * Builds spawners and doors and turns a blueprint into a Room. Must be
+         * called from the main thread. The blueprint is moved from.
+         */
+        RoomPtr finishRoom(RoomBlueprint &blueprint) const;
+        SpawnerPtr constructSpawner(const SpawnerBlueprint &blueprint, SpawnType type, int offsetX = 0, int offsetY = 0) const;
+        std::unique_ptr<Door> constructDoor(const DoorBlueprint & door, int offsetX = 0, int offsetY = 0) const;
 
     public:
         MapLoader(const std::shared_ptr<AnimationSetCache> & animationSetCache,
@@ -118,6 +65,28 @@ namespace hikari {
         );
         virtual ~MapLoader();
         MapPtr loadFromJson(const Json::Value &json) const;
+
+        /**
+         * Creates a map out of a compiled stage. Rooms are only constructed
+         * when they are first requested, and rooms reachable through a
+         * RoomTransition from a constructed room are prepared ahead of time on
+         * a background thread.
+         *
+         * The MapLoader must be owned by a std::shared_ptr.
+         *
+         * @param stage the compiled stage, which is kept alive by the map
+         */
+        MapPtr loadFromStage(const std::shared_ptr<const StageReader> &stage) const;
+
+        /**
+         * Loads a compiled stage (StageFormat::FILE_EXTENSION) from a file with
+         * a single read. JSON maps are compiled ahead of time by the
+         * stage-compiler tool.
+         *
+         * @param fileName path to a compiled stage
+         * @throws std::runtime_error if the file can't be read or isn't a compiled stage
+         */
+        MapPtr loadFromFile(const std::string &fileName) const;
     };
 
 } // hikari
@@ -4,8 +4,9 @@
 #include "hikari/core/Platform.hpp"
 #include "hikari/core/geom/Rectangle2D.hpp"
 #include <memory>
+#include <vector>
 #include <SFML/Graphics/RectangleShape.hpp>
-#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
 
 #if (_WIN32 && _MSC_VER)
     #pragma warning(push)
@@ -14,6 +15,7 @@
 
 namespace sf {
     class RenderTarget;
+    class Vertex;
     class View;
 }
 
@@ -27,23 +29,60 @@ namespace hikari {
 
     class HIKARI_API MapRenderer {
     private:
+        /**
+            A quad whose texture coordinates follow an animated tile.
+        */
+        struct AnimatedQuad {
+            int tileIndex;
+            int attributes;
+            unsigned int firstVertex;
+        };
+
+        /**
+            The tiles of a room around the visible area, baked into a single
+            vertex array so they can be drawn with one draw call. The layer
+            covers TILE_LAYER_MARGIN extra tiles on every side and is only
+            rebuilt once the visible area leaves it; animated tiles are
+            patched in place when the tileset's revision changes.
+        */
+        struct TileLayer {
+            std::weak_ptr<Room> room;
+            sf::VertexArray vertices;
+            Rectangle2D<int> tileArea;
+            unsigned int tilesetRevision;
+            std::vector<AnimatedQuad> animatedQuads;
+
+            explicit TileLayer(const RoomPtr &room);
+        };
+
         static bool isDebugLadderRenderingEnabled;
         static bool isDebugForceRenderingEnabled;
         static bool isDebugDoorRenderingEnabled;
         static const int TILE_OVERDRAW;
+        static const int TILE_LAYER_MARGIN;
         RoomPtr room;
         TileDataPtr tileData;
-        sf::Sprite tileSprite;
         sf::RectangleShape backgroundShape;
         sf::RectangleShape debugLadderShape;
         sf::RectangleShape debugForceShape;
         Rectangle2D<int> visibleScreenArea;
         Rectangle2D<int> visibleTileArea;
 
+        //
+        // Tile layers are kept per room because transitions render two
+        // rooms in the same frame; a single layer would be rebuilt twice
+        // per frame while scrolling between them. Only the layers of the
+        // current and the previous room are kept.
+        //
+        std::vector<TileLayer> tileLayers;
+
         inline void buildBackgroundRectangle();
         inline void cullTiles();
-        inline void applyTileToSprite(const int &tileIndex, const int &x, const int &y);
-        inline void applyTileAttributes(const int &attributes);
+        TileLayer & getTileLayer();
+        void rebuildTileLayer(TileLayer &layer);
+        void refreshAnimatedTiles(TileLayer &layer);
+        inline void applyTileToQuad(sf::Vertex *quad, const int &x, const int &y);
+        inline void applyTileAttributes(sf::Vertex *quad, const int &tileIndex, const int &attributes);
 
     public:
         MapRenderer(const RoomPtr &room, const TileDataPtr &tileData);
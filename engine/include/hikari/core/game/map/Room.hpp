@@ -6,8 +6,8 @@
 #include "hikari/core/geom/BoundingBox.hpp"
 #include "hikari/core/geom/Point2D.hpp"
 #include "hikari/core/geom/Rectangle2D.hpp"
+#include "hikari/core/geom/SpatialHash.hpp"
 #include "hikari/client/game/objects/BlockSequenceDescriptor.hpp"
-#include <list>
 #include <memory>
 #include <vector>
 
@@ -24,6 +24,8 @@ namespace hikari {
 
     class HIKARI_API Room {
     private:
+        static const float FEATURE_INDEX_CELL_SIZE;
+
         int id;
         int x;
         int y;
@@ -40,7 +42,12 @@ namespace hikari {
         std::vector<std::shared_ptr<Spawner>> spawners;
         std::vector<std::shared_ptr<Force>> forces;
         std::vector<BlockSequenceDescriptor> blockSequences;
-        std::list<BoundingBox<float>> ladders;
+        std::vector<BoundingBox<float>> ladders;
+        std::vector<BoundingBox<float>> forceBounds;
+        std::vector<BoundingBox<float>> transitionBounds;
+        SpatialHash<int> ladderIndex;
+        SpatialHash<int> forceIndex;
+        SpatialHash<int> transitionIndex;
         std::shared_ptr<Door> entranceDoor;
         std::shared_ptr<Door> exitDoor;
         std::string bossEntityName;
@@ -53,6 +60,13 @@ namespace hikari {
          */
         void traceLadders();
 
+        /**
+         * Works out the world-space bounds of the ladders, forces and
+         * transitions and puts them into grids, so that checking the hero
+         * against them doesn't depend on how many the room has.
+         */
+        void indexFeatures();
+
     public:
         const static int NO_TILE = -1;
         const static int DEFAULT_BG_COLOR = 0;
@@ -144,6 +158,14 @@ namespace hikari {
          */
         const std::vector<RoomTransition>& getTransitions() const;
 
+        /**
+         * Gets the area covered by each of the room's transitions, in world
+         * coordinates. Bounds are in the same order as getTransitions().
+         *
+         * @return list of transition bounds
+         */
+        const std::vector<BoundingBox<float>> & getTransitionBounds() const;
+
         /**
          * Gets a reference to the list of shared pointers to the Spawners in
          * this room.
@@ -159,7 +181,7 @@ namespace hikari {
          *
          * @return list of ladder rectangles
          */
-        const std::list<BoundingBox<float>> & getLadders() const;
+        const std::vector<BoundingBox<float>> & getLadders() const;
 
         /**
          * Gets a reference to the list of Forces in the room.
@@ -175,6 +197,34 @@ namespace hikari {
          */
         const std::vector<BlockSequenceDescriptor> & getBlockSequences() const;
 
+        /**
+         * Finds the ladders that overlap a region. Only ladders near the
+         * region are tested.
+         *
+         * @param bounds  the region to test, in world coordinates
+         * @param results receives indices into getLadders(), in ascending
+         *                order (cleared first)
+         */
+        void queryLadders(const BoundingBox<float> & bounds, std::vector<int> & results) const;
+
+        /**
+         * Finds the Forces whose bounds overlap a region.
+         *
+         * @param bounds  the region to test, in world coordinates
+         * @param results receives indices into getForces(), in ascending
+         *                order (cleared first)
+         */
+        void queryForces(const BoundingBox<float> & bounds, std::vector<int> & results) const;
+
+        /**
+         * Finds the transitions whose bounds overlap a region.
+         *
+         * @param bounds  the region to test, in world coordinates
+         * @param results receives indices into getTransitions(), in
+         *                ascending order (cleared first)
+         */
+        void queryTransitions(const BoundingBox<float> & bounds, std::vector<int> & results) const;
+
         /**
          * Gets a list of weak pointers to the Spawner objects in this Room.
          *
@@ -0,0 +1,107 @@
+#ifndef HIKARI_CORE_GAME_MAP_ROOMBLUEPRINT
+#define HIKARI_CORE_GAME_MAP_ROOMBLUEPRINT
+
+#include "hikari/core/game/Direction.hpp"
+#include "hikari/core/game/map/RoomTransition.hpp"
+#include "hikari/core/geom/Point2D.hpp"
+#include "hikari/core/geom/Rectangle2D.hpp"
+#include "hikari/client/game/objects/BlockSequenceDescriptor.hpp"
+
+#include <json/value.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace hikari {
+
+    class Force;
+
+    /**
+     * Describes an enemy or item spawner, relative to the room it's in.
+     */
+    struct SpawnerBlueprint {
+        std::string type;
+        Point2D<int> position;
+        Direction direction;
+        unsigned int spawnLimit;
+        float spawnRate;
+        bool hasContinuous;
+        bool continuous;
+        bool hasConfig;
+        Json::Value config;
+
+        SpawnerBlueprint()
+            : type()
+            , position()
+            , direction(Directions::None)
+            , spawnLimit(1)
+            , spawnRate(1.0f)
+            , hasContinuous(false)
+            , continuous(false)
+            , hasConfig(false)
+            , config()
+        {
+        }
+    };
+
+    /**
+     * Describes a door, in tiles. Rooms without the door leave present unset.
+     */
+    struct DoorBlueprint {
+        bool present;
+        int x;
+        int y;
+        int width;
+        int height;
+
+        DoorBlueprint()
+            : present(false)
+            , x(0)
+            , y(0)
+            , width(1)
+            , height(3)
+        {
+        }
+    };
+
+    /**
+     * Everything needed to build a Room which can be prepared away from the
+     * main thread: tile planes, transitions, forces, block sequences and
+     * room metadata.
+     *
+     * Spawners and doors touch shared state (object ids, the scripting VM and
+     * the animation cache), so only their descriptions are kept here; they
+     * are built when the blueprint is turned into a Room on the main thread.
+     *
+     * Blueprints are produced from either a map's JSON or a compiled stage
+     * file, and are what compiled stage files are written from.
+     *
+     * @see MapLoader
+     * @see RoomStreamer
+     * @see StageReader
+     */
+    struct RoomBlueprint {
+        int id;
+        int x;
+        int y;
+        int width;
+        int height;
+        int gridSize;
+        int backgroundColor;
+        Point2D<int> heroSpawnPosition;
+        Rectangle2D<int> cameraBounds;
+        std::vector<int> tile;
+        std::vector<int> attr;
+        std::vector<RoomTransition> transitions;
+        std::vector<std::shared_ptr<Force>> forces;
+        std::vector<BlockSequenceDescriptor> blockSequences;
+        std::string bossEntity;
+        std::vector<SpawnerBlueprint> enemies;
+        std::vector<SpawnerBlueprint> items;
+        DoorBlueprint entranceDoor;
+        DoorBlueprint exitDoor;
+    };
+
+} // hikari
+
+#endif // HIKARI_CORE_GAME_MAP_ROOMBLUEPRINT
@@ -0,0 +1,61 @@
+#ifndef HIKARI_CORE_GAME_MAP_ROOMSTREAMWORKER
+#define HIKARI_CORE_GAME_MAP_ROOMSTREAMWORKER
+
+#include "hikari/core/Platform.hpp"
+#include "hikari/core/util/NonCopyable.hpp"
+
+#include <memory>
+#include <thread>
+
+#if (_WIN32 && _MSC_VER)
+    #pragma warning(push)
+    #pragma warning(disable:4251)
+#endif
+
+namespace hikari {
+
+    class RoomStreamer;
+
+    /**
+     * The one background thread that prepares rooms for every RoomStreamer.
+     *
+     * Streamers keep their own queue of rooms; each prefetch schedules the
+     * streamer here once, and the thread asks it to prepare its next room.
+     * Streamers are only referred to weakly, so a map which is thrown away
+     * with rooms still queued simply drops them.
+     *
+     * @see RoomStreamer
+     */
+    class HIKARI_API RoomStreamWorker : public NonCopyable {
+    private:
+        struct Jobs;
+
+        std::shared_ptr<Jobs> jobs;
+        std::thread thread;
+
+        static void work(std::shared_ptr<Jobs> jobs);
+
+    public:
+        RoomStreamWorker();
+
+        /**
+         * Stops the thread; jobs which haven't been started are dropped. Safe
+         * to run on the worker thread itself, which happens when it was
+         * holding the last reference to a streamer that owned this worker.
+         */
+        ~RoomStreamWorker();
+
+        /**
+         * Asks a streamer to prepare its next queued room on the worker
+         * thread. Schedule once per queued room.
+         */
+        void schedule(const std::weak_ptr<RoomStreamer> & streamer);
+    };
+
+} // hikari
+
+#if (_WIN32 && _MSC_VER)
+    #pragma warning(pop)
+#endif
+
+#endif // HIKARI_CORE_GAME_MAP_ROOMSTREAMWORKER
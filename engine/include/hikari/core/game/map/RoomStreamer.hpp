@@ -0,0 +1,113 @@
+#ifndef HIKARI_CORE_GAME_MAP_ROOMSTREAMER
+#define HIKARI_CORE_GAME_MAP_ROOMSTREAMER
+
+#include "hikari/core/Platform.hpp"
+#include "hikari/core/util/NonCopyable.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+
+#if (_WIN32 && _MSC_VER)
+    #pragma warning(push)
+    #pragma warning(disable:4251)
+#endif
+
+namespace hikari {
+
+    class Room;
+    class RoomStreamWorker;
+    struct RoomBlueprint;
+
+    typedef std::shared_ptr<Room> RoomPtr;
+
+    /**
+     * Builds the rooms of a single map on demand.
+     *
+     * The expensive, self-contained part of building a room (reading its
+     * RoomBlueprint from the map's JSON or compiled stage) is done on a
+     * RoomStreamWorker's thread for rooms which are likely to be visited
+     * next: every time a room is handed out, the rooms its RoomTransitions
+     * lead to are queued. Spawners and doors are always created on the
+     * thread calling getRoom().
+     *
+     * If a requested room hasn't been prepared yet it is built on the calling
+     * thread, or waited on if the worker is already preparing it.
+     *
+     * Must be created with std::make_shared, since the worker refers back to
+     * the streamer while rooms are queued.
+     */
+    class HIKARI_API RoomStreamer : public NonCopyable, public std::enable_shared_from_this<RoomStreamer> {
+    public:
+        /**
+         * Produces the blueprint of the room with a given index. Called from
+         * the worker thread as well as the main thread, so it must not touch
+         * shared state.
+         */
+        typedef std::function<std::unique_ptr<RoomBlueprint> (unsigned int)> RoomSource;
+
+        /**
+         * Turns a blueprint into a Room. Only ever called from getRoom(), on
+         * the main thread. The blueprint may be moved from.
+         */
+        typedef std::function<RoomPtr (RoomBlueprint &)> RoomFinisher;
+
+    private:
+        RoomSource source;
+        RoomFinisher finisher;
+        unsigned int roomCount;
+        std::shared_ptr<RoomStreamWorker> worker;
+
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::deque<unsigned int> queue;                                   ///< rooms waiting to be prepared
+        std::set<unsigned int> requested;                                 ///< rooms queued, prepared or already handed out
+        std::map<unsigned int, std::unique_ptr<RoomBlueprint>> prepared;  ///< rooms prepared but not yet handed out
+        bool working;
+        unsigned int workingIndex;
+
+        std::unique_ptr<RoomBlueprint> prepare(unsigned int index) const;
+
+        /**
+         * Prepares the room at the front of the queue, if there still is one.
+         * Called by the worker, once for every room that was queued.
+         */
+        void prepareNext();
+
+        friend class RoomStreamWorker;
+
+    public:
+        RoomStreamer(const RoomSource & source, const RoomFinisher & finisher,
+            unsigned int roomCount, const std::shared_ptr<RoomStreamWorker> & worker);
+
+        /**
+         * Queues a room to be prepared in the background. Rooms which have
+         * already been requested are ignored.
+         */
+        void prefetch(unsigned int index);
+
+        /**
+         * Blocks until every queued room has been prepared. Useful when a
+         * stall now is better than one later, such as behind a loading
+         * screen.
+         */
+        void waitForPrefetches();
+
+        /**
+         * Builds a room, using its prepared blueprint if there is one, and
+         * queues the rooms it links to. Must be called from the main thread.
+         */
+        RoomPtr getRoom(unsigned int index);
+    };
+
+} // hikari
+
+#if (_WIN32 && _MSC_VER)
+    #pragma warning(pop)
+#endif
+
+#endif // HIKARI_CORE_GAME_MAP_ROOMSTREAMER
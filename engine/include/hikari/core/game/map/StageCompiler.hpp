@@ -0,0 +1,135 @@
+#ifndef HIKARI_CORE_GAME_MAP_STAGECOMPILER
+#define HIKARI_CORE_GAME_MAP_STAGECOMPILER
+
+#include "hikari/core/Platform.hpp"
+#include "hikari/core/game/map/StageFormat.hpp"
+#include "hikari/core/geom/Rectangle2D.hpp"
+
+#include <memory>
+#include <json/value.h>
+#include <vector>
+
+namespace hikari {
+
+    class RoomTransition;
+    class BlockSequenceDescriptor;
+    class Force;
+    struct RoomBlueprint;
+    struct SpawnerBlueprint;
+    struct DoorBlueprint;
+
+    /**
+     * Reads JSON maps into room blueprints and compiled stages.
+     *
+     * Nothing here touches the scripting VM, the renderer or any other
+     * shared state, so it's used both by MapLoader and by the offline
+     * stage-compiler tool which turns JSON maps into stage files.
+     *
+     * @see StageFormat
+     * @see StageWriter
+     */
+    class HIKARI_API StageCompiler {
+    private:
+        static const char* PROP_TILESET;
+        static const char* PROP_ROOMS;
+        static const char* PROP_GRIDSIZE;
+        static const char* PROP_MUSICID;
+        static const char* PROP_MUSICNAME;
+        static const char* PROP_SPECIAL_ROOMS;
+        static const char* PROP_SPECIAL_ROOM_STARTING;
+        static const char* PROP_SPECIAL_ROOM_MIDPOINT;
+        static const char* PROP_SPECIAL_ROOM_BOSS_CORRIDOR;
+        static const char* PROP_SPECIAL_ROOM_BOSS_CHAMBER;
+        static const char* PROP_BOSS_ENTITY;
+        static const char* PROP_ROOM_ID;
+        static const char* PROP_ROOM_X;
+        static const char* PROP_ROOM_Y;
+        static const char* PROP_ROOM_HERO_SPAWN_X;
+        static const char* PROP_ROOM_HERO_SPAWN_Y;
+        static const char* PROP_ROOM_WIDTH;
+        static const char* PROP_ROOM_HEIGHT;
+        static const char* PROP_ROOM_BG_COLOR;
+        static const char* PROP_ROOM_CAMERABOUNDS;
+        static const char* PROP_ROOM_CAMERABOUNDS_X;
+        static const char* PROP_ROOM_CAMERABOUNDS_Y;
+        static const char* PROP_ROOM_CAMERABOUNDS_WIDTH;
+        static const char* PROP_ROOM_CAMERABOUNDS_HEIGHT;
+        static const char* PROP_ROOM_TILE;
+        static const char* PROP_ROOM_TILEATTRIBUTES;
+        static const char* PROP_ROOM_ENEMIES;
+        static const char* PROP_ROOM_ENEMIES_TYPE;
+        static const char* PROP_ROOM_ENEMIES_POSITION;
+        static const char* PROP_ROOM_ENEMIES_POSITION_X;
+        static const char* PROP_ROOM_ENEMIES_POSITION_Y;
+        static const char* PROP_ROOM_ENEMIES_DIRECTION;
+        static const char* PROP_ROOM_ITEMS;
+        static const char* PROP_ROOM_ITEMS_TYPE;
+        static const char* PROP_ROOM_ITEMS_X;
+        static const char* PROP_ROOM_ITEMS_Y;
+        static const char* PROP_ROOM_TRANSITIONS;
+        static const char* PROP_ROOM_DOORS;
+        static const char* PROP_ROOM_DOORS_X;
+        static const char* PROP_ROOM_DOORS_Y;
+        static const char* PROP_ROOM_DOORS_WIDTH;
+        static const char* PROP_ROOM_DOORS_HEIGHT;
+        static const char* PROP_ROOM_DOORS_ENTRANCE;
+        static const char* PROP_ROOM_DOORS_EXIT;
+        static const char* PROP_ROOM_BLOCKSEQUENCES;
+        static const char* PROP_ROOM_BLOCKSEQUENCES_X;
+        static const char* PROP_ROOM_BLOCKSEQUENCES_Y;
+        static const char* PROP_ROOM_BLOCKSEQUENCES_WIDTH;
+        static const char* PROP_ROOM_BLOCKSEQUENCES_HEIGHT;
+        static const char* PROP_ROOM_BLOCKSEQUENCES_BLOCKS;
+        static const char* PROP_ROOM_BLOCKSEQUENCES_SEQUENCE;
+        static const char* PROP_ROOM_BLOCKSEQUENCES_INTERVAL;
+        static const char* PROP_ROOM_BLOCKSEQUENCES_MAXIMUM_BLOCK_AGE;
+        static const char* PROP_ROOM_BLOCKSEQUENCES_ENTITY;
+        static const char* PROP_ROOM_BLOCKSEQUENCES_SPAWN_SOUND;
+
+        static const int DEFAULT_HERO_SPAWN_X;
+        static const int DEFAULT_HERO_SPAWN_Y;
+
+        SpawnerBlueprint readSpawner(const Json::Value &json) const;
+        std::shared_ptr<Force> constructForce(const Json::Value &json, int offsetX = 0, int offsetY = 0) const;
+        DoorBlueprint readDoor(const Json::Value & json) const;
+        RoomTransition constructTransition(const Json::Value &json) const;
+        BlockSequenceDescriptor constructBlockSequence(const Json::Value &json,
+            int roomX, int roomY, int gridSize) const;
+        Rectangle2D<int> constructCameraBounds(const Json::Value &json,
+            int roomX, int roomY, int gridSize) const;
+        bool validateRoomStructure(const Json::Value &json) const;
+
+    public:
+        StageCompiler();
+
+        /**
+         * Converts a JSON map into a compiled stage.
+         *
+         * @param json the map's JSON
+         * @return the contents of a stage file
+         * @throws std::runtime_error if the JSON isn't a valid map
+         */
+        std::vector<char> compile(const Json::Value &json) const;
+
+        StageInfo readStageInfo(const Json::Value &json) const;
+
+        /**
+         * Builds the parts of a room which don't touch shared state. Safe to
+         * call from a background thread.
+         */
+        std::unique_ptr<RoomBlueprint> prepareRoom(const Json::Value &json, int gridSize) const;
+
+        /**
+         * Prepares every room of a map, in the order they're declared.
+         */
+        std::vector<std::unique_ptr<RoomBlueprint>> prepareRooms(const Json::Value &json) const;
+
+        /**
+         * @throws std::runtime_error if the JSON isn't a valid map
+         */
+        bool validateMapStructure(const Json::Value &json) const;
+    };
+
+} // hikari
+
+#endif // HIKARI_CORE_GAME_MAP_STAGECOMPILER
@@ -0,0 +1,184 @@
+#ifndef HIKARI_CORE_GAME_MAP_STAGEFORMAT
+#define HIKARI_CORE_GAME_MAP_STAGEFORMAT
+
+#include "hikari/core/Platform.hpp"
+
+#include <cstdint>
+#include <string>
+
+namespace hikari {
+
+    /**
+     * Map-wide properties of a stage, shared by its JSON and binary forms.
+     */
+    struct StageInfo {
+        std::string tilesetName;
+        int gridSize;
+        std::string musicName;
+        std::string bossEntity;
+        int startingRoomIndex;
+        int midpointRoomIndex;
+        int bossCorridorRoomIndex;
+        int bossChamberRoomIndex;
+
+        StageInfo();
+    };
+
+    /**
+     * Layout of compiled (binary) stage files.
+     *
+     * A stage file is a Header followed by a number of sections. Each
+     * section is a flat table of fixed-size records, so a whole stage can be
+     * read with a single file read and decoded without any parsing. Rooms
+     * refer to their tiles and entities by index ranges into the tables,
+     * and all strings live in one blob referred to by StringRef.
+     *
+     * Values are stored in native byte order; files are meant to be built
+     * as part of the build that uses them (see tools/stage-compiler). Bump
+     * VERSION whenever any record changes so stale files are rejected.
+     *
+     * @see StageWriter
+     * @see StageReader
+     */
+    class HIKARI_API StageFormat {
+    public:
+        static const char MAGIC[4];
+        static const std::uint32_t VERSION;
+        static const char * FILE_EXTENSION;
+
+        enum Section {
+            SECTION_STRINGS = 0,        ///< char
+            SECTION_ROOMS,              ///< RoomRecord
+            SECTION_TILES,              ///< std::int16_t, one per cell
+            SECTION_ATTRIBUTES,         ///< std::int16_t, one per cell
+            SECTION_TRANSITIONS,        ///< TransitionRecord
+            SECTION_FORCES,             ///< ForceRecord
+            SECTION_SPAWNERS,           ///< SpawnerRecord
+            SECTION_BLOCK_SEQUENCES,    ///< BlockSequenceRecord
+            SECTION_BLOCKS,             ///< PointRecord
+            SECTION_BLOCK_STEPS,        ///< Range into SECTION_BLOCK_INDICES
+            SECTION_BLOCK_INDICES,      ///< std::int32_t
+            SECTION_COUNT
+        };
+
+        enum SpawnerFlags {
+            SPAWNER_HAS_CONTINUOUS = 1,
+            SPAWNER_CONTINUOUS     = 2,
+            SPAWNER_HAS_CONFIG     = 4
+        };
+
+        enum TransitionFlags {
+            TRANSITION_DOOR        = 1,
+            TRANSITION_LADDER_ONLY = 2
+        };
+
+        struct StringRef {
+            std::uint32_t offset;
+            std::uint32_t length;
+        };
+
+        struct Range {
+            std::uint32_t first;
+            std::uint32_t count;
+        };
+
+        struct SectionEntry {
+            std::uint32_t offset;       ///< in bytes from the start of the file
+            std::uint32_t count;        ///< number of records
+            std::uint32_t recordSize;   ///< size of one record, in bytes
+        };
+
+        struct Header {
+            char magic[4];
+            std::uint32_t version;
+            std::int32_t gridSize;
+            std::int32_t startingRoomIndex;
+            std::int32_t midpointRoomIndex;
+            std::int32_t bossCorridorRoomIndex;
+            std::int32_t bossChamberRoomIndex;
+            StringRef tilesetName;
+            StringRef musicName;
+            StringRef bossEntity;
+            SectionEntry sections[SECTION_COUNT];
+        };
+
+        struct RectRecord {
+            std::int32_t x;
+            std::int32_t y;
+            std::int32_t width;
+            std::int32_t height;
+        };
+
+        struct PointRecord {
+            std::int32_t x;
+            std::int32_t y;
+        };
+
+        struct DoorRecord {
+            std::int32_t present;
+            RectRecord bounds;          ///< in tiles, relative to the room
+        };
+
+        struct RoomRecord {
+            std::int32_t id;
+            std::int32_t x;
+            std::int32_t y;
+            std::int32_t width;
+            std::int32_t height;
+            std::int32_t backgroundColor;
+            PointRecord heroSpawnPosition;
+            RectRecord cameraBounds;    ///< in pixels
+            StringRef bossEntity;
+            std::uint32_t firstCell;    ///< index into the tile and attribute planes
+            Range transitions;
+            Range forces;
+            Range enemies;
+            Range items;
+            Range blockSequences;
+            DoorRecord entranceDoor;
+            DoorRecord exitDoor;
+        };
+
+        struct TransitionRecord {
+            std::int32_t to;
+            RectRecord bounds;
+            std::int32_t direction;     ///< RoomTransition::Direction
+            std::uint32_t flags;        ///< TransitionFlags
+        };
+
+        struct ForceRecord {
+            float x;
+            float y;
+            float width;
+            float height;
+            float velocityX;
+            float velocityY;
+        };
+
+        struct SpawnerRecord {
+            StringRef type;
+            PointRecord position;       ///< relative to the room
+            std::int32_t direction;     ///< hikari::Direction
+            std::uint32_t spawnLimit;
+            float spawnRate;
+            std::uint32_t flags;        ///< SpawnerFlags
+            StringRef config;           ///< JSON text; empty if there is no config
+        };
+
+        struct BlockSequenceRecord {
+            RectRecord bounds;          ///< in pixels
+            float spawnInterval;
+            float maximumBlockAge;
+            StringRef entityName;
+            StringRef soundName;
+            Range blocks;
+            Range steps;
+        };
+
+    private:
+        StageFormat();
+    };
+
+} // hikari
+
+#endif // HIKARI_CORE_GAME_MAP_STAGEFORMAT
@@ -0,0 +1,80 @@
+#ifndef HIKARI_CORE_GAME_MAP_STAGEREADER
+#define HIKARI_CORE_GAME_MAP_STAGEREADER
+
+#include "hikari/core/Platform.hpp"
+#include "hikari/core/game/map/StageFormat.hpp"
+#include "hikari/core/geom/Rectangle2D.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if (_WIN32 && _MSC_VER)
+    #pragma warning(push)
+    #pragma warning(disable:4251)
+#endif
+
+namespace hikari {
+
+    struct RoomBlueprint;
+    struct SpawnerBlueprint;
+    struct DoorBlueprint;
+
+    /**
+     * Decodes a compiled stage file held in memory.
+     *
+     * The file is validated once when the reader is created; afterwards
+     * rooms are decoded straight out of the buffer, one at a time. A reader
+     * is never modified after construction, so rooms can be read from
+     * several threads at once.
+     *
+     * @see StageFormat
+     * @see StageWriter
+     */
+    class HIKARI_API StageReader {
+    private:
+        std::vector<char> data;
+        StageFormat::Header header;
+        StageInfo info;
+
+        template <typename T>
+        T readRecord(StageFormat::Section section, std::uint32_t index) const;
+
+        std::string readString(const StageFormat::StringRef & ref) const;
+        void readSpawners(const StageFormat::Range & range, std::vector<SpawnerBlueprint> & blueprints) const;
+        void readDoor(const StageFormat::DoorRecord & record, DoorBlueprint & blueprint) const;
+        void checkRange(StageFormat::Section section, std::uint32_t first, std::uint32_t count) const;
+
+    public:
+        /**
+         * Takes ownership of a stage file's contents.
+         *
+         * @throws std::runtime_error if the contents aren't a stage file of
+         *         the current version or are truncated
+         */
+        explicit StageReader(std::vector<char> && data);
+
+        const StageInfo & getInfo() const;
+        unsigned int getRoomCount() const;
+
+        /**
+         * Gets the location and size of a room, in pixels.
+         */
+        Rectangle2D<int> getRoomRect(unsigned int index) const;
+
+        /**
+         * Decodes a room.
+         *
+         * @throws std::runtime_error if the room refers to data outside of the file
+         */
+        std::unique_ptr<RoomBlueprint> readRoom(unsigned int index) const;
+    };
+
+} // hikari
+
+#if (_WIN32 && _MSC_VER)
+    #pragma warning(pop)
+#endif
+
+#endif // HIKARI_CORE_GAME_MAP_STAGEREADER
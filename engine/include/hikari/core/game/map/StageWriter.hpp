@@ -0,0 +1,74 @@
+#ifndef HIKARI_CORE_GAME_MAP_STAGEWRITER
+#define HIKARI_CORE_GAME_MAP_STAGEWRITER
+
+#include "hikari/core/Platform.hpp"
+#include "hikari/core/game/map/StageFormat.hpp"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#if (_WIN32 && _MSC_VER)
+    #pragma warning(push)
+    #pragma warning(disable:4251)
+#endif
+
+namespace hikari {
+
+    struct RoomBlueprint;
+    struct SpawnerBlueprint;
+    struct DoorBlueprint;
+
+    /**
+     * Builds a compiled stage file out of room blueprints.
+     *
+     * @see StageFormat
+     * @see StageCompiler
+     */
+    class HIKARI_API StageWriter {
+    private:
+        StageInfo info;
+        std::vector<char> strings;
+        std::map<std::string, StageFormat::StringRef> stringIndex;
+        std::vector<StageFormat::RoomRecord> rooms;
+        std::vector<std::int16_t> tiles;
+        std::vector<std::int16_t> attributes;
+        std::vector<StageFormat::TransitionRecord> transitions;
+        std::vector<StageFormat::ForceRecord> forces;
+        std::vector<StageFormat::SpawnerRecord> spawners;
+        std::vector<StageFormat::BlockSequenceRecord> blockSequences;
+        std::vector<StageFormat::PointRecord> blocks;
+        std::vector<StageFormat::Range> blockSteps;
+        std::vector<std::int32_t> blockIndices;
+        StageFormat::StringRef tilesetName;
+        StageFormat::StringRef musicName;
+        StageFormat::StringRef bossEntity;
+
+        StageFormat::StringRef addString(const std::string & value);
+        StageFormat::Range addSpawners(const std::vector<SpawnerBlueprint> & blueprints);
+        StageFormat::DoorRecord makeDoor(const DoorBlueprint & blueprint) const;
+
+    public:
+        explicit StageWriter(const StageInfo & info);
+
+        /**
+         * Appends a room. Rooms are stored in the order they are added.
+         *
+         * @throws std::runtime_error if a tile or attribute doesn't fit in 16 bits
+         */
+        void addRoom(const RoomBlueprint & room);
+
+        /**
+         * Lays out everything added so far as a stage file.
+         */
+        std::vector<char> write() const;
+    };
+
+} // hikari
+
+#if (_WIN32 && _MSC_VER)
+    #pragma warning(pop)
+#endif
+
+#endif // HIKARI_CORE_GAME_MAP_STAGEWRITER
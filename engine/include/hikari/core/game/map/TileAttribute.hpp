@@ -0,0 +1,27 @@
+#ifndef HIKARI_CORE_GAME_MAP_TILEATTRIBUTE
+#define HIKARI_CORE_GAME_MAP_TILEATTRIBUTE
+
+#include "hikari/core/Platform.hpp"
+
+namespace hikari {
+
+    namespace TileAttribute {
+        enum TileAttribute {
+            NO_ATTRIBUTES = 0,
+            SOLID = (1 << 0),
+            LADDER = (1 << 1),
+            PLATFORM = (1 << 2),
+            SPIKE = (1 << 3),
+            ABYSS = (1 << 4),
+            FLIP_HORIZONTAL = (1 << 5),
+            FLIP_VERTICAL = (1 << 6),
+            ROTATE_BY_90 = (1 << 7),
+            WATER = (1 << 8)
+        };
+
+        bool hasAttribute(const int &tile, const TileAttribute &attr);
+    }
+
+} // hikari
+
+#endif // HIKARI_CORE_GAME_MAP_TILEATTRIBUTE
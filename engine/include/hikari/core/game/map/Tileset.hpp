@@ -3,6 +3,7 @@
 
 #include "hikari/core/Platform.hpp"
 #include "hikari/core/game/TileAnimator.hpp"
+#include "hikari/core/game/map/TileAttribute.hpp"
 
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/Texture.hpp>
@@ -20,29 +21,14 @@
 
 namespace hikari {
 
-    namespace TileAttribute {
-        enum TileAttribute {
-            NO_ATTRIBUTES = 0,
-            SOLID = (1 << 0),
-            LADDER = (1 << 1),
-            PLATFORM = (1 << 2),
-            SPIKE = (1 << 3),
-            ABYSS = (1 << 4),
-            FLIP_HORIZONTAL = (1 << 5),
-            FLIP_VERTICAL = (1 << 6),
-            ROTATE_BY_90 = (1 << 7),
-            WATER = (1 << 8)
-        };
-
-        bool hasAttribute(const int &tile, const TileAttribute &attr);
-    }
-
     class HIKARI_API Tileset {
     private:
         size_t tileSize;
         std::vector<sf::IntRect> tiles;
         std::vector<TileAnimator> tileAnimators;
         std::shared_ptr<sf::Texture> texture;
+        std::vector<bool> animatedTiles;
+        unsigned int revision;
     public:
         Tileset(
             const std::shared_ptr<sf::Texture> &texture,
@@ -53,6 +39,20 @@ namespace hikari {
         const size_t& getTileSize() const;
         const sf::IntRect& getTileRect(const unsigned int &index) const;
         const std::shared_ptr<sf::Texture> getTexture() const;
+
+        /**
+            Checks whether a tile's texture rectangle is driven by one of the
+            tileset's TileAnimators.
+        */
+        bool isTileAnimated(const unsigned int &index) const;
+
+        /**
+            Gets a counter which is incremented every time an animated tile
+            changes its texture rectangle. Renderers can compare it against a
+            previously seen value to know when animated tiles need refreshing.
+        */
+        unsigned int getRevision() const;
+
         void update(float delta);
     };
 
@@ -0,0 +1,197 @@
+#ifndef HIKARI_CORE_GEOM_SPATIALHASH
+#define HIKARI_CORE_GEOM_SPATIALHASH
+
+#include "hikari/core/geom/BoundingBox.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace hikari {
+
+    /**
+        A uniform-grid spatial hash used as a broadphase for overlap queries.
+
+        Items are registered with a bounding box and stored in every grid cell
+        that the box touches. Only the occupied cells are allocated, so the
+        grid is unbounded and cheap for sparse scenes.
+
+        Updating an item whose box still covers the same cells is a no-op,
+        which keeps per-frame maintenance proportional to the number of
+        objects that actually crossed a cell boundary.
+
+        Items must be small, hashable values (ids or raw pointers).
+    */
+    template <typename T>
+    class SpatialHash {
+    private:
+        struct CellRange {
+            int left;
+            int top;
+            int right;
+            int bottom;
+
+            bool operator == (const CellRange & other) const {
+                return left == other.left && top == other.top
+                    && right == other.right && bottom == other.bottom;
+            }
+        };
+
+        float cellSize;
+        std::unordered_map<std::uint64_t, std::vector<T>> cells;
+        std::unordered_map<T, CellRange> itemRanges;
+
+        static std::uint64_t makeKey(int x, int y) {
+            return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32)
+                | static_cast<std::uint32_t>(y);
+        }
+
+        int toCell(float coordinate) const {
+            return static_cast<int>(std::floor(coordinate / cellSize));
+        }
+
+        CellRange rangeFor(const BoundingBox<float> & bounds) const {
+            CellRange range;
+            range.left = toCell(bounds.getLeft());
+            range.top = toCell(bounds.getTop());
+            range.right = toCell(bounds.getRight());
+            range.bottom = toCell(bounds.getBottom());
+            return range;
+        }
+
+        void addToCells(const T & item, const CellRange & range) {
+            for(int y = range.top; y <= range.bottom; ++y) {
+                for(int x = range.left; x <= range.right; ++x) {
+                    cells[makeKey(x, y)].push_back(item);
+                }
+            }
+        }
+
+        void removeFromCells(const T & item, const CellRange & range) {
+            for(int y = range.top; y <= range.bottom; ++y) {
+                for(int x = range.left; x <= range.right; ++x) {
+                    auto cell = cells.find(makeKey(x, y));
+
+                    if(cell != std::end(cells)) {
+                        auto & bucket = cell->second;
+                        auto found = std::find(std::begin(bucket), std::end(bucket), item);
+
+                        if(found != std::end(bucket)) {
+                            // Order within a cell doesn't matter; swap-and-pop.
+                            *found = bucket.back();
+                            bucket.pop_back();
+                        }
+
+                        if(bucket.empty()) {
+                            cells.erase(cell);
+                        }
+                    }
+                }
+            }
+        }
+
+    public:
+        explicit SpatialHash(float cellSize = 64.0f)
+            : cellSize(cellSize > 0.0f ? cellSize : 64.0f)
+            , cells()
+            , itemRanges()
+        {
+
+        }
+
+        float getCellSize() const {
+            return cellSize;
+        }
+
+        /**
+            Gets the number of items currently stored in the hash.
+        */
+        std::size_t size() const {
+            return itemRanges.size();
+        }
+
+        bool contains(const T & item) const {
+            return itemRanges.find(item) != std::end(itemRanges);
+        }
+
+        /**
+            Inserts an item or, if it is already present, moves it to the cells
+            covered by bounds.
+
+            @param item   the item to store
+            @param bounds the area covered by the item in world space
+        */
+        void update(const T & item, const BoundingBox<float> & bounds) {
+            const CellRange newRange = rangeFor(bounds);
+            auto existing = itemRanges.find(item);
+
+            if(existing != std::end(itemRanges)) {
+                if(existing->second == newRange) {
+                    return;
+                }
+
+                removeFromCells(item, existing->second);
+                existing->second = newRange;
+            } else {
+                itemRanges.emplace(item, newRange);
+            }
+
+            addToCells(item, newRange);
+        }
+
+        /**
+            Removes an item from the hash. Removing an item that isn't present
+            does nothing.
+        */
+        void remove(const T & item) {
+            auto existing = itemRanges.find(item);
+
+            if(existing != std::end(itemRanges)) {
+                removeFromCells(item, existing->second);
+                itemRanges.erase(existing);
+            }
+        }
+
+        void clear() {
+            cells.clear();
+            itemRanges.clear();
+        }
+
+        /**
+            Collects every item whose cells overlap the cells covered by
+            bounds. This is a broadphase test: callers still need to perform
+            an exact intersection test on the results. Each item is reported
+            at most once. The results vector is cleared before being filled so
+            it can be reused between queries without reallocating.
+
+            @param bounds  the area to query
+            @param results receives the candidate items
+        */
+        void query(const BoundingBox<float> & bounds, std::vector<T> & results) const {
+            results.clear();
+
+            const CellRange range = rangeFor(bounds);
+
+            for(int y = range.top; y <= range.bottom; ++y) {
+                for(int x = range.left; x <= range.right; ++x) {
+                    auto cell = cells.find(makeKey(x, y));
+
+                    if(cell != std::end(cells)) {
+                        results.insert(std::end(results), std::begin(cell->second), std::end(cell->second));
+                    }
+                }
+            }
+
+            // Items spanning several cells show up more than once.
+            if(range.left != range.right || range.top != range.bottom) {
+                std::sort(std::begin(results), std::end(results));
+                results.erase(std::unique(std::begin(results), std::end(results)), std::end(results));
+            }
+        }
+    };
+
+} // hikari
+
+#endif // HIKARI_CORE_GEOM_SPATIALHASH
@@ -0,0 +1,124 @@
+#ifndef HIKARI_CORE_UTIL_ASYNCLOGWRITER
+#define HIKARI_CORE_UTIL_ASYNCLOGWRITER
+
+#include "hikari/core/Platform.hpp"
+#include "hikari/core/util/NonCopyable.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if (_WIN32 && _MSC_VER)
+    #pragma warning(push)
+    #pragma warning(disable:4251)
+#endif
+
+namespace hikari {
+
+    /**
+        Writes log messages to a stream from a background thread.
+
+        Messages are pushed into a fixed-size, lock-free ring buffer which may
+        be written to from any thread. Pushing never blocks: if the buffer is
+        full the message is discarded and counted, and the drain thread
+        reports how many messages were lost the next time it writes.
+
+        The drain thread collects every pending message into one batch and
+        writes (and flushes) it with a single call, so the cost of stream I/O
+        is paid off the game thread and once per batch instead of per line.
+    */
+    class HIKARI_API AsyncLogWriter : public NonCopyable {
+    private:
+        struct Slot {
+            std::atomic<std::size_t> sequence;
+            std::string message;
+        };
+
+        static const std::size_t DEFAULT_CAPACITY;
+        static const unsigned int IDLE_SLEEP_MILLISECONDS;
+
+        std::ostream & outputStream;
+        std::vector<Slot> slots;
+        std::size_t mask;
+        std::atomic<std::size_t> enqueuePosition;
+        std::size_t dequeuePosition;
+        std::atomic<bool> running;
+        std::atomic<unsigned int> activeProducers;
+        std::atomic<std::size_t> droppedCount;
+        std::size_t reportedDropCount;
+        std::string batch;
+        std::thread drainThread;
+
+        bool pop(std::string & message);
+        bool writePending();
+        void drainLoop();
+
+    public:
+        /**
+            Creates a writer. The capacity is rounded up to the next power of
+            two. Messages are only written once start() or flush() is called.
+
+            @param outputStream the stream to write batches to
+            @param capacity     maximum number of messages waiting to be written
+        */
+        explicit AsyncLogWriter(std::ostream & outputStream, std::size_t capacity = DEFAULT_CAPACITY);
+        ~AsyncLogWriter();
+
+        /**
+            Starts the drain thread. Does nothing if already started.
+        */
+        void start();
+
+        /**
+            Stops the drain thread after writing every pending message. Waits
+            for any pushIfRunning() call that is already under way, so nothing
+            it queues is left behind.
+        */
+        void stop();
+
+        bool isRunning() const;
+
+        /**
+            Queues a message for writing. Never blocks.
+
+            @param message the message to write; moved from on success
+            @return true if the message was queued, false if it was dropped
+        */
+        bool push(std::string && message);
+
+        /**
+            Queues a message only if the drain thread is running. Unlike
+            checking isRunning() before push(), this can't race with stop():
+            either the message is queued before the final flush, or it is
+            refused and left for the caller to write.
+
+            @param message the message to write; moved from only if accepted
+            @return true if the writer took the message (even if it had to drop
+                    it), false if it isn't running
+        */
+        bool pushIfRunning(std::string && message);
+
+        /**
+            Writes every pending message on the calling thread. Only safe to
+            call while the drain thread is not running.
+        */
+        void flush();
+
+        std::size_t getCapacity() const;
+
+        /**
+            Gets the total number of messages dropped because the buffer was full.
+        */
+        std::size_t getDroppedCount() const;
+    };
+
+} // hikari
+
+#if (_WIN32 && _MSC_VER)
+    #pragma warning(pop)
+#endif
+
+#endif // HIKARI_CORE_UTIL_ASYNCLOGWRITER
@@ -0,0 +1,121 @@
+#ifndef HIKARI_CORE_UTIL_BLOCKPOOL
+#define HIKARI_CORE_UTIL_BLOCKPOOL
+
+#include <cstddef>
+#include <new>
+
+namespace hikari {
+
+    /**
+     * A per-thread free list of fixed-size memory blocks. Objects of the same
+     * type all have the same size, so once a few of them have come and gone
+     * making another one just pops a block off of this list.
+     *
+     * At most MAX_FREE_BLOCKS blocks are kept; anything past that goes back
+     * to the heap so that a one-off burst of allocations doesn't pin memory.
+     */
+    template <std::size_t BlockSize>
+    class BlockPool {
+    private:
+        static const std::size_t MAX_FREE_BLOCKS = 256;
+        static const std::size_t ACTUAL_BLOCK_SIZE = BlockSize < sizeof(void*) ? sizeof(void*) : BlockSize;
+
+        struct FreeList {
+            void * head;
+            std::size_t count;
+
+            FreeList()
+                : head(nullptr)
+                , count(0)
+            {
+            }
+
+            ~FreeList() {
+                while(head) {
+                    void * next = *static_cast<void**>(head);
+                    ::operator delete(head);
+                    head = next;
+                }
+            }
+        };
+
+        static FreeList & getFreeList() {
+            static thread_local FreeList freeList;
+            return freeList;
+        }
+
+    public:
+        static void * allocate() {
+            FreeList & freeList = getFreeList();
+
+            if(freeList.head) {
+                void * block = freeList.head;
+                freeList.head = *static_cast<void**>(block);
+                --freeList.count;
+                return block;
+            }
+
+            return ::operator new(ACTUAL_BLOCK_SIZE);
+        }
+
+        static void deallocate(void * block) {
+            FreeList & freeList = getFreeList();
+
+            if(freeList.count >= MAX_FREE_BLOCKS) {
+                ::operator delete(block);
+                return;
+            }
+
+            *static_cast<void**>(block) = freeList.head;
+            freeList.head = block;
+            ++freeList.count;
+        }
+    };
+
+    /**
+     * Allocator which draws single objects from a BlockPool. Meant for
+     * std::allocate_shared and for shared_ptr's allocator-aware
+     * constructors, which allocate one reference count block at a time.
+     */
+    template <typename T>
+    class BlockAllocator {
+    public:
+        typedef T value_type;
+
+        BlockAllocator() {
+        }
+
+        template <typename U>
+        BlockAllocator(const BlockAllocator<U> & other) {
+        }
+
+        T * allocate(std::size_t n) {
+            if(n == 1) {
+                return static_cast<T*>(BlockPool<sizeof(T)>::allocate());
+            }
+
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+
+        void deallocate(T * pointer, std::size_t n) {
+            if(n == 1) {
+                BlockPool<sizeof(T)>::deallocate(pointer);
+            } else {
+                ::operator delete(pointer);
+            }
+        }
+    };
+
+    template <typename T, typename U>
+    bool operator == (const BlockAllocator<T> & lhs, const BlockAllocator<U> & rhs) {
+        return true;
+    }
+
+    template <typename T, typename U>
+    bool operator != (const BlockAllocator<T> & lhs, const BlockAllocator<U> & rhs) {
+        return false;
+    }
+
+} // hikari
+
+#endif // HIKARI_CORE_UTIL_BLOCKPOOL
@@ -0,0 +1,27 @@
+#ifndef HIKARI_CORE_UTIL_CONTENTHASH
+#define HIKARI_CORE_UTIL_CONTENTHASH
+
+#include <cstdint>
+#include <vector>
+
+namespace hikari {
+
+    /**
+     * 64-bit FNV-1a hash of a file's contents. Used to key files derived
+     * from assets (rendered samples, compiled stages) so that editing the
+     * asset invalidates them.
+     */
+    inline std::uint64_t hashContents(const std::vector<char> & contents) {
+        std::uint64_t hash = 14695981039346656037ULL;
+
+        for(auto it = std::begin(contents); it != std::end(contents); ++it) {
+            hash ^= static_cast<unsigned char>(*it);
+            hash *= 1099511628211ULL;
+        }
+
+        return hash;
+    }
+
+} // hikari
+
+#endif // HIKARI_CORE_UTIL_CONTENTHASH
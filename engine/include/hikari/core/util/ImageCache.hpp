@@ -4,10 +4,19 @@
 #include "hikari/core/Platform.hpp"
 #include "hikari/core/util/ResourceCache.hpp"
 #include "hikari/core/util/Service.hpp"
+#include "hikari/core/util/TextureAtlas.hpp"
 
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace sf {
+    class Image;
+}
+
 namespace hikari {
 
     class HIKARI_API ImageCache : public Service, public ResourceCache<sf::Texture> {
@@ -21,6 +30,10 @@ namespace hikari {
         bool enableSmoothing;
         bool enableMask;
         sf::Color maskColor;
+        std::unique_ptr<TextureAtlas> atlas;
+        std::unordered_map<std::string, TextureRegion> regions;
+
+        void loadImage(const std::string &fileName, sf::Image &imageData) const;
 
     protected:
         virtual ImageCache::Resource loadResource(const std::string &fileName);
@@ -28,6 +41,30 @@ namespace hikari {
     public:
         ImageCache(bool smoothing, bool masking, const sf::Color &mask = sf::Color(255, 0, 255));
 
+        /**
+         * Makes getRegion() pack images into shared texture pages. Images
+         * which have already been handed out aren't moved.
+         *
+         * @param pageSize width and height of each atlas page
+         */
+        void enableAtlas(unsigned int pageSize = TextureAtlas::DEFAULT_PAGE_SIZE);
+
+        /**
+         * Gets an image as a region of a texture. When the atlas is enabled
+         * small images share pages with other images, so anything drawn
+         * from the region has to offset its texture rectangles by the
+         * region's position. Otherwise the region covers a texture of its
+         * own, the same one get() returns.
+         *
+         * Use get() for images that are drawn whole, like GUI images.
+         */
+        TextureRegion getRegion(const std::string &fileName);
+
+        /**
+         * Gets the atlas, or nullptr if it isn't enabled.
+         */
+        const TextureAtlas * getAtlas() const;
+
         virtual ~ImageCache() { }
     };
 
@@ -2,8 +2,11 @@
 #define HIKARI_CORE_UTIL_LOG
 
 #include "hikari/core/Platform.hpp"
+#include <cstddef>
 #include <iostream>
+#include <memory>
 #include <sstream>
+#include <string>
 
 #ifndef HIKARI_LOG_MAX_LEVEL
 #define HIKARI_LOG_MAX_LEVEL 9
@@ -32,6 +35,8 @@ else ::hikari::Log().get(level)
         debug4
     };
 
+    class AsyncLogWriter;
+
     /*
         Originally adapted from:
 
@@ -45,6 +50,7 @@ else ::hikari::Log().get(level)
     private:
         static LogLevel reportingLevel;
         static std::ostream & outputStream;
+        static std::unique_ptr<AsyncLogWriter> asyncWriter;
         Log(const Log&);
         Log& operator =(const Log&);
 
@@ -60,6 +66,37 @@ else ::hikari::Log().get(level)
         std::ostringstream& get(LogLevel level = info);
         static LogLevel& getReportingLevel();
         static void setReportingLevel(const LogLevel& level);
+
+        /**
+            Converts a level name ("error", "info", "debug2", etc.) into a
+            LogLevel. Names are case-sensitive and match toString's output in
+            lower case, with "debug" standing in for "D0".
+
+            @param name  the name of the level
+            @param level receives the parsed level
+            @return true if name was a known level, false otherwise
+        */
+        static bool parseLevel(const std::string & name, LogLevel & level);
+
+        /**
+            Routes messages through an AsyncLogWriter so that logging doesn't
+            block the calling thread. Until this is called (and after
+            stopAsync()), messages are written synchronously.
+
+            @param capacity maximum number of messages waiting to be written
+        */
+        static void startAsync(std::size_t capacity);
+
+        /**
+            Writes any pending messages and goes back to synchronous logging.
+        */
+        static void stopAsync();
+
+        /**
+            Gets the number of messages dropped because the asynchronous
+            buffer was full.
+        */
+        static std::size_t getDroppedCount();
     };
 
 }
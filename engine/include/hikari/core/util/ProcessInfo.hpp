@@ -0,0 +1,26 @@
+#ifndef HIKARI_CORE_UTIL_PROCESSINFO
+#define HIKARI_CORE_UTIL_PROCESSINFO
+
+#include "hikari/core/Platform.hpp"
+
+#include <cstddef>
+
+namespace hikari {
+
+    /**
+     * Queries the operating system about the running process.
+     */
+    class HIKARI_API ProcessInfo {
+    public:
+        /**
+         * Gets the most physical memory this process has used at once so far.
+         *
+         * @return peak resident set size in bytes, or 0 if the platform
+         *         doesn't report it
+         */
+        static std::size_t getPeakMemoryUsage();
+    };
+
+} // hikari
+
+#endif // HIKARI_CORE_UTIL_PROCESSINFO
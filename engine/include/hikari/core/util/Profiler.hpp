@@ -0,0 +1,187 @@
+#ifndef HIKARI_CORE_UTIL_PROFILER
+#define HIKARI_CORE_UTIL_PROFILER
+
+#include "hikari/core/Platform.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+/*
+    Profiling convenience macro. Times the rest of the enclosing scope as a
+    zone of the global profiler. The name must outlive the profiler; use a
+    string literal.
+*/
+#define HIKARI_PROFILE_CONCAT_INNER(a, b) a##b
+#define HIKARI_PROFILE_CONCAT(a, b) HIKARI_PROFILE_CONCAT_INNER(a, b)
+#define HIKARI_PROFILE_ZONE(name) \
+::hikari::ProfileZone HIKARI_PROFILE_CONCAT(hikariProfileZone, __LINE__)(::hikari::Profiler::getInstance(), name)
+
+namespace hikari {
+
+    /**
+     * Records how long named zones of code take, frame by frame.
+     *
+     * Completed zones go into a fixed-size ring buffer, so the profiler
+     * only ever remembers the last few seconds and never allocates while
+     * recording. Zones are only recorded between beginFrame() and
+     * endFrame(), and only while the profiler is enabled; otherwise a zone
+     * costs a single branch.
+     *
+     * A Profiler is not thread safe. The global instance belongs to the
+     * main thread.
+     */
+    class HIKARI_API Profiler {
+    public:
+        static const std::size_t DEFAULT_FRAME_CAPACITY;
+        static const std::size_t DEFAULT_ZONE_CAPACITY;
+
+        /**
+         * A completed zone. Times are in nanoseconds since the profiler was
+         * created.
+         */
+        struct Zone {
+            const char * name;
+            std::uint64_t start;
+            std::uint64_t duration;
+            unsigned int depth;
+        };
+
+        /**
+         * A completed frame and the range of zones recorded during it.
+         */
+        struct Frame {
+            std::uint64_t start;
+            std::uint64_t duration;
+            std::uint64_t firstZone;
+            std::size_t zoneCount;
+        };
+
+        /**
+         * Time spent in all zones of one name, over a number of frames.
+         */
+        struct ZoneSummary {
+            const char * name;
+            unsigned int depth;
+            unsigned long calls;
+            std::uint64_t totalDuration;
+            std::uint64_t maxFrameDuration;
+        };
+
+    private:
+        typedef std::chrono::steady_clock Clock;
+
+        struct OpenZone {
+            const char * name;
+            std::uint64_t start;
+        };
+
+        Clock::time_point epoch;
+        bool enabled;
+        bool inFrame;
+
+        std::vector<Frame> frames;
+        std::uint64_t framesWritten;
+        Frame currentFrame;
+
+        std::vector<Zone> zones;
+        std::uint64_t zonesWritten;
+
+        std::vector<OpenZone> openZones;
+
+        std::uint64_t now() const;
+        bool isZoneRetained(std::uint64_t zoneIndex) const;
+
+    public:
+        explicit Profiler(std::size_t frameCapacity = DEFAULT_FRAME_CAPACITY,
+            std::size_t zoneCapacity = DEFAULT_ZONE_CAPACITY);
+
+        /**
+         * Gets the profiler used by HIKARI_PROFILE_ZONE.
+         */
+        static Profiler & getInstance();
+
+        bool isEnabled() const {
+            return enabled;
+        }
+
+        /**
+         * Turns recording on or off. Turning it off doesn't forget frames
+         * which have already been recorded.
+         */
+        void setEnabled(bool enabled);
+
+        void beginFrame();
+        void endFrame();
+
+        /**
+         * Opens a zone. Zones nest and must be closed in reverse order;
+         * prefer ProfileZone over calling this directly.
+         *
+         * @return true if the zone is being recorded and must be closed
+         */
+        bool beginZone(const char * name);
+        void endZone();
+
+        /**
+         * Gets the number of completed frames which are still in memory.
+         */
+        std::size_t getFrameCount() const;
+
+        /**
+         * Gets a completed frame.
+         *
+         * @param age how many frames ago, 0 being the most recent one
+         */
+        const Frame & getFrame(std::size_t age) const;
+
+        /**
+         * Adds up each zone over the most recent completed frames. Zones with
+         * the same name are merged; the most expensive come first.
+         *
+         * @param frameCount how many frames to look at
+         */
+        std::vector<ZoneSummary> summarize(std::size_t frameCount) const;
+
+        /**
+         * Writes every frame still in memory as Chrome trace event JSON, which
+         * can be loaded with chrome://tracing or Perfetto.
+         */
+        void writeChromeTrace(std::ostream & output) const;
+
+        /**
+         * Forgets all recorded frames.
+         */
+        void clear();
+    };
+
+    /**
+     * Times a zone for as long as it lives.
+     */
+    class HIKARI_API ProfileZone {
+    private:
+        Profiler & profiler;
+        bool recording;
+
+        ProfileZone(const ProfileZone &);
+        ProfileZone & operator =(const ProfileZone &);
+
+    public:
+        ProfileZone(Profiler & profiler, const char * name)
+            : profiler(profiler)
+            , recording(profiler.isEnabled() && profiler.beginZone(name))
+        {
+        }
+
+        ~ProfileZone() {
+            if(recording) {
+                profiler.endZone();
+            }
+        }
+    };
+
+} // hikari
+
+#endif // HIKARI_CORE_UTIL_PROFILER
@@ -0,0 +1,45 @@
+#ifndef HIKARI_CORE_UTIL_RANDOM
+#define HIKARI_CORE_UTIL_RANDOM
+
+#include "hikari/core/Platform.hpp"
+
+#include <cstdint>
+#include <random>
+
+namespace hikari {
+
+    /**
+     * A seedable random number generator. Unlike rand(), every generator has
+     * its own state, and the same seed gives the same numbers on every
+     * platform, so gameplay which only uses a Random can be replayed exactly.
+     */
+    class HIKARI_API Random {
+    private:
+        std::mt19937 engine;
+        std::uint32_t seedValue;
+
+    public:
+        explicit Random(std::uint32_t seed = 0);
+
+        /**
+         * Restarts the sequence of numbers from a seed.
+         */
+        void seed(std::uint32_t seed);
+        std::uint32_t getSeed() const;
+
+        std::uint32_t next();
+
+        /**
+         * Gets a number in [0, bound). Returns 0 if bound isn't positive.
+         */
+        int nextInt(int bound);
+
+        /**
+         * Gets a number in [0, 1).
+         */
+        float nextFloat();
+    };
+
+} // hikari
+
+#endif // HIKARI_CORE_UTIL_RANDOM
@@ -0,0 +1,119 @@
+#ifndef HIKARI_CORE_UTIL_RINGBUFFER
+#define HIKARI_CORE_UTIL_RINGBUFFER
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace hikari {
+
+    /**
+     * A FIFO queue stored in one contiguous, power-of-two sized block. The
+     * block only grows, so once a queue has seen its peak size pushing and
+     * popping never allocate.
+     *
+     * Popped slots are reset to a default-constructed T so that they don't
+     * keep resources (like shared_ptr targets) alive.
+     */
+    template <typename T>
+    class RingBuffer {
+    private:
+        std::vector<T> slots;
+        std::size_t head;
+        std::size_t count;
+
+        std::size_t wrap(std::size_t index) const {
+            return index & (slots.size() - 1);
+        }
+
+        void grow() {
+            const std::size_t newCapacity = slots.empty() ? 16 : slots.size() * 2;
+            std::vector<T> newSlots(newCapacity);
+
+            for(std::size_t i = 0; i < count; ++i) {
+                newSlots[i] = std::move(slots[wrap(head + i)]);
+            }
+
+            slots.swap(newSlots);
+            head = 0;
+        }
+
+    public:
+        RingBuffer()
+            : slots()
+            , head(0)
+            , count(0)
+        {
+        }
+
+        bool empty() const {
+            return count == 0;
+        }
+
+        std::size_t size() const {
+            return count;
+        }
+
+        std::size_t capacity() const {
+            return slots.size();
+        }
+
+        T & front() {
+            return slots[head];
+        }
+
+        const T & front() const {
+            return slots[head];
+        }
+
+        /**
+         * Gets the element at a position counted from the front of the queue.
+         */
+        T & operator[](std::size_t index) {
+            return slots[wrap(head + index)];
+        }
+
+        const T & operator[](std::size_t index) const {
+            return slots[wrap(head + index)];
+        }
+
+        void push_back(const T & value) {
+            if(count == slots.size()) {
+                grow();
+            }
+
+            slots[wrap(head + count)] = value;
+            ++count;
+        }
+
+        void pop_front() {
+            slots[head] = T();
+            head = wrap(head + 1);
+            --count;
+        }
+
+        /**
+         * Removes the element at a position counted from the front of the
+         * queue, shifting the ones behind it forward. Order is preserved.
+         */
+        void erase(std::size_t index) {
+            for(std::size_t i = index; i + 1 < count; ++i) {
+                (*this)[i] = std::move((*this)[i + 1]);
+            }
+
+            (*this)[count - 1] = T();
+            --count;
+        }
+
+        void clear() {
+            while(!empty()) {
+                pop_front();
+            }
+
+            head = 0;
+        }
+    };
+
+} // hikari
+
+#endif // HIKARI_CORE_UTIL_RINGBUFFER
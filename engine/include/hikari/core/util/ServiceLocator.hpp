@@ -3,37 +3,51 @@
 
 #include "hikari/core/Platform.hpp"
 #include "hikari/core/util/Log.hpp"
+#include "hikari/core/util/StringHash.hpp"
 #include "hikari/core/util/exception/HikariException.hpp"
+#include "hikari/core/util/exception/ServiceNameCollisionException.hpp"
 #include "hikari/core/util/exception/ServiceNotRegisteredException.hpp"
-#include <map>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
+#include <utility>
 
 namespace hikari {
 
     class Service;
 
+    /**
+     * Keeps track of services by name. Names are stored by their hash, and
+     * registering two names that hash the same is an error, so a hash alone
+     * is enough to identify a service.
+     */
     class HIKARI_API ServiceLocator {
     private:
         typedef std::shared_ptr<Service> ServicePtr;
-        typedef std::map<std::string, ServicePtr> ServicePtrMap;
+        typedef std::pair<std::string, ServicePtr> NamedService;
+        typedef std::unordered_map<StringHash, NamedService> ServicePtrMap;
         ServicePtrMap services;
 
     public:
         void registerService(const std::string &name, const ServicePtr &pointer) {
-            auto found = services.find(name);
+            const StringHash key = rememberHashedString(name);
+            auto found = services.find(key);
 
             if(found != services.end()) {
+                if(found->second.first != name) {
+                    throw ServiceNameCollisionException("Service name: " + name + " has the same hash as " + found->second.first);
+                }
+
                 throw ServiceNotRegisteredException("Service name: " + name + " is already registered");
             }
 
             HIKARI_LOG(info) << "Registering service \"" << name << "\".";
-            services.insert(std::make_pair(name, pointer));
+            services.insert(std::make_pair(key, std::make_pair(name, pointer)));
         }
 
         void unregisterService(const std::string &name) {
-            auto found = services.find(name);
+            auto found = services.find(hashString(name));
 
             if(found != services.end()) {
                 HIKARI_LOG(info) << "Unregistering service \"" << name << "\".";
@@ -43,10 +57,10 @@ namespace hikari {
 
         template<class T>
         std::weak_ptr<T> locateService(const std::string &name) const {
-            auto found = services.find(name);
+            auto found = services.find(hashString(name));
 
             if(found != services.end()) {
-                std::shared_ptr<T> ptr = std::dynamic_pointer_cast<T>(found->second);
+                std::shared_ptr<T> ptr = std::dynamic_pointer_cast<T>(found->second.second);
 
                 if(ptr) {
                     return ptr;
@@ -61,4 +75,4 @@ namespace hikari {
 
 } // hikari
 
-#endif // HIKARI_CORE_UTIL_SERVICELOCATOR
\ No newline at end of file
+#endif // HIKARI_CORE_UTIL_SERVICELOCATOR
@@ -0,0 +1,62 @@
+#ifndef HIKARI_CORE_UTIL_SHELFPACKER
+#define HIKARI_CORE_UTIL_SHELFPACKER
+
+#include "hikari/core/Platform.hpp"
+#include "hikari/core/geom/Rectangle2D.hpp"
+
+#include <vector>
+
+namespace hikari {
+
+    /**
+     * Packs rectangles into a fixed-size area, one at a time, by stacking
+     * them in rows ("shelves"). It isn't the tightest packing there is, but
+     * it's quick, it never moves anything that was already packed, and it
+     * does well when most rectangles are about the same height, which is
+     * typical of sprite sheets and tilesets.
+     */
+    class HIKARI_API ShelfPacker {
+    private:
+        struct Shelf {
+            int y;
+            int height;
+            int usedWidth;
+        };
+
+        int width;
+        int height;
+        int padding;
+        int usedHeight;
+        std::vector<Shelf> shelves;
+
+    public:
+        /**
+         * @param width   width of the area to pack into
+         * @param height  height of the area to pack into
+         * @param padding empty space to keep to the right of and below every
+         *                rectangle, so neighbors never bleed into each other
+         */
+        ShelfPacker(int width, int height, int padding = 0);
+
+        /**
+         * Finds room for a rectangle.
+         *
+         * @param rectWidth  width of the rectangle to place
+         * @param rectHeight height of the rectangle to place
+         * @param placement  where the rectangle went, if it fit
+         * @return true if the rectangle fit
+         */
+        bool insert(int rectWidth, int rectHeight, Rectangle2D<int> & placement);
+
+        int getWidth() const;
+        int getHeight() const;
+
+        /**
+         * Gets the fraction of the area that is taken up by shelves.
+         */
+        float getOccupancy() const;
+    };
+
+} // hikari
+
+#endif // HIKARI_CORE_UTIL_SHELFPACKER
@@ -0,0 +1,221 @@
+#ifndef HIKARI_CORE_UTIL_SLOTMAP
+#define HIKARI_CORE_UTIL_SLOTMAP
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace hikari {
+
+    /**
+     * Refers to a value in a SlotMap. A handle goes stale when its value is
+     * removed; the slot's generation is bumped at that point, so a stale
+     * handle never finds whatever is stored in the slot afterwards.
+     */
+    struct SlotHandle {
+        std::uint32_t index;
+        std::uint32_t generation;
+
+        SlotHandle()
+            : index(0)
+            , generation(0)
+        {
+        }
+
+        SlotHandle(std::uint32_t index, std::uint32_t generation)
+            : index(index)
+            , generation(generation)
+        {
+        }
+
+        /**
+         * Default-constructed handles never refer to anything, since
+         * generations start at 1.
+         */
+        bool isNull() const {
+            return generation == 0;
+        }
+
+        bool operator==(const SlotHandle & other) const {
+            return index == other.index && generation == other.generation;
+        }
+
+        bool operator!=(const SlotHandle & other) const {
+            return !(*this == other);
+        }
+    };
+
+    /**
+     * Stores values densely in one vector and hands out SlotHandles to them.
+     *
+     * Insertion and removal are O(1): removing a value moves the last one
+     * into its place ("swap and pop"), and the slot table keeps handles
+     * pointing at the right position. Iteration order is therefore not
+     * insertion order. Slots of removed values are reused.
+     */
+    template <typename T>
+    class SlotMap {
+    private:
+        struct Slot {
+            std::uint32_t denseIndex;   // Next free slot while unused
+            std::uint32_t generation;
+        };
+
+        std::vector<T> values;
+        std::vector<std::uint32_t> valueSlots;
+        std::vector<Slot> slots;
+        std::uint32_t freeHead;
+
+        static const std::uint32_t NO_SLOT = 0xffffffffu;
+
+        const Slot * findSlot(const SlotHandle & handle) const {
+            if(handle.index < slots.size()) {
+                const Slot & slot = slots[handle.index];
+
+                if(slot.generation == handle.generation) {
+                    return &slot;
+                }
+            }
+
+            return nullptr;
+        }
+
+    public:
+        typedef typename std::vector<T>::iterator iterator;
+        typedef typename std::vector<T>::const_iterator const_iterator;
+
+        SlotMap()
+            : values()
+            , valueSlots()
+            , slots()
+            , freeHead(NO_SLOT)
+        {
+        }
+
+        SlotHandle insert(const T & value) {
+            std::uint32_t index = freeHead;
+
+            if(index == NO_SLOT) {
+                index = static_cast<std::uint32_t>(slots.size());
+
+                Slot slot;
+                slot.denseIndex = NO_SLOT;
+                slot.generation = 1;
+                slots.push_back(slot);
+            } else {
+                freeHead = slots[index].denseIndex;
+            }
+
+            Slot & slot = slots[index];
+            slot.denseIndex = static_cast<std::uint32_t>(values.size());
+
+            values.push_back(value);
+            valueSlots.push_back(index);
+
+            return SlotHandle(index, slot.generation);
+        }
+
+        /**
+         * Removes a value. Does nothing if the handle is stale.
+         *
+         * @return true if a value was removed
+         */
+        bool remove(const SlotHandle & handle) {
+            if(!findSlot(handle)) {
+                return false;
+            }
+
+            Slot & slot = slots[handle.index];
+            const std::uint32_t denseIndex = slot.denseIndex;
+            const std::uint32_t lastIndex = static_cast<std::uint32_t>(values.size() - 1);
+
+            if(denseIndex != lastIndex) {
+                values[denseIndex] = std::move(values[lastIndex]);
+                valueSlots[denseIndex] = valueSlots[lastIndex];
+                slots[valueSlots[denseIndex]].denseIndex = denseIndex;
+            }
+
+            values.pop_back();
+            valueSlots.pop_back();
+
+            // Skip 0 when wrapping so null handles stay null.
+            slot.generation = (slot.generation + 1 == 0) ? 1 : slot.generation + 1;
+            slot.denseIndex = freeHead;
+            freeHead = handle.index;
+
+            return true;
+        }
+
+        bool contains(const SlotHandle & handle) const {
+            return findSlot(handle) != nullptr;
+        }
+
+        /**
+         * Gets the value a handle refers to, or nullptr if it's stale. The
+         * pointer is only good until the next insert or remove.
+         */
+        T * get(const SlotHandle & handle) {
+            const Slot * slot = findSlot(handle);
+            return slot ? &values[slot->denseIndex] : nullptr;
+        }
+
+        const T * get(const SlotHandle & handle) const {
+            const Slot * slot = findSlot(handle);
+            return slot ? &values[slot->denseIndex] : nullptr;
+        }
+
+        /**
+         * Removes all values. Outstanding handles all go stale.
+         */
+        void clear() {
+            for(auto it = std::begin(valueSlots), end = std::end(valueSlots); it != end; it++) {
+                Slot & slot = slots[*it];
+                slot.generation = (slot.generation + 1 == 0) ? 1 : slot.generation + 1;
+                slot.denseIndex = freeHead;
+                freeHead = *it;
+            }
+
+            values.clear();
+            valueSlots.clear();
+        }
+
+        std::size_t size() const {
+            return values.size();
+        }
+
+        bool empty() const {
+            return values.empty();
+        }
+
+        /**
+         * Gets the values as one contiguous array, in no particular order.
+         */
+        const std::vector<T> & getValues() const {
+            return values;
+        }
+
+        iterator begin() {
+            return values.begin();
+        }
+
+        iterator end() {
+            return values.end();
+        }
+
+        const_iterator begin() const {
+            return values.begin();
+        }
+
+        const_iterator end() const {
+            return values.end();
+        }
+    };
+
+    template <typename T>
+    const std::uint32_t SlotMap<T>::NO_SLOT;
+
+} // hikari
+
+#endif // HIKARI_CORE_UTIL_SLOTMAP
@@ -0,0 +1,77 @@
+#ifndef HIKARI_CORE_UTIL_STRINGHASH
+#define HIKARI_CORE_UTIL_STRINGHASH
+
+#include "hikari/core/Platform.hpp"
+
+#include <cstdint>
+#include <string>
+
+/*
+    Debug builds remember which string produced each hash they see, so
+    hashes can be turned back into names in logs and consoles.
+*/
+#ifndef NDEBUG
+#define HIKARI_DEBUG_STRING_HASHES
+#endif
+
+namespace hikari {
+
+    /**
+     * A 32-bit FNV-1a hash of a string. Unlike std::hash, the value is the
+     * same with every compiler and standard library, so it can be written
+     * to replays and traces, and it can be computed at compile time.
+     */
+    typedef std::uint32_t StringHash;
+
+    namespace detail {
+
+        const StringHash STRING_HASH_OFFSET = 2166136261u;
+        const StringHash STRING_HASH_PRIME = 16777619u;
+
+        constexpr StringHash hashStringFrom(const char * string, StringHash hash) {
+            return *string == '\0'
+                ? hash
+                : hashStringFrom(string + 1, static_cast<StringHash>((hash ^ static_cast<unsigned char>(*string)) * STRING_HASH_PRIME));
+        }
+
+    } // hikari::detail
+
+    /**
+     * Hashes a string. Usable in constant expressions, so it can be used
+     * for case labels and static constants:
+     *
+     *     static constexpr EventType Type = hashString("DoorEventData");
+     *
+     * Constant expressions can't remember anything, so also pass the string
+     * to rememberHashedString if it should show up by name in debug builds.
+     * Event types do this with HIKARI_DEFINE_EVENT_TYPE.
+     */
+    constexpr StringHash hashString(const char * string) {
+        return detail::hashStringFrom(string, detail::STRING_HASH_OFFSET);
+    }
+
+    /**
+     * Hashes a string at runtime. Gives the same value as the constexpr
+     * overload.
+     */
+    HIKARI_API StringHash hashString(const std::string & string);
+
+    /**
+     * Hashes a string and, in debug builds, remembers it so the hash can be
+     * looked up with findHashedString later. Logs an error if two different
+     * strings are found to have the same hash.
+     *
+     * @return the hash of the string
+     */
+    HIKARI_API StringHash rememberHashedString(const std::string & string);
+
+    /**
+     * Finds the string a hash was made from. Only strings passed to
+     * rememberHashedString in a debug build can be found; for anything else
+     * the hash is formatted as hexadecimal instead.
+     */
+    HIKARI_API std::string findHashedString(StringHash hash);
+
+} // hikari
+
+#endif // HIKARI_CORE_UTIL_STRINGHASH
@@ -0,0 +1,89 @@
+#ifndef HIKARI_CORE_UTIL_TEXTUREATLAS
+#define HIKARI_CORE_UTIL_TEXTUREATLAS
+
+#include "hikari/core/Platform.hpp"
+#include "hikari/core/util/ShelfPacker.hpp"
+
+#include <SFML/Graphics/Rect.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace sf {
+    class Image;
+    class Texture;
+}
+
+namespace hikari {
+
+    /**
+     * A rectangular part of a texture.
+     */
+    struct HIKARI_API TextureRegion {
+        std::shared_ptr<sf::Texture> texture;
+        sf::IntRect bounds;
+    };
+
+    /**
+     * Packs many small images into a few large textures ("pages"). Sprites
+     * whose images share a page can be drawn without switching textures,
+     * and a few big textures fragment video memory less than many small
+     * ones.
+     *
+     * Images are packed as they are added, so no offline step is needed.
+     * Images too big to share a page are refused; keep those in their own
+     * textures.
+     */
+    class HIKARI_API TextureAtlas {
+    public:
+        static const unsigned int DEFAULT_PAGE_SIZE;
+
+    private:
+        static const int PADDING;   // border of repeated edge pixels around every image
+
+        struct Page {
+            std::shared_ptr<sf::Texture> texture;
+            ShelfPacker packer;
+
+            Page(const std::shared_ptr<sf::Texture> & texture, int size);
+        };
+
+        unsigned int pageSize;
+        bool smoothing;
+        std::vector<Page> pages;
+
+        bool addPage();
+        bool place(Page & page, const sf::Image & image, TextureRegion & region);
+
+    public:
+        /**
+         * @param pageSize  width and height of each page; clamped to what the
+         *                  graphics card supports
+         * @param smoothing whether pages are drawn with smoothing
+         */
+        explicit TextureAtlas(unsigned int pageSize = DEFAULT_PAGE_SIZE, bool smoothing = false);
+
+        /**
+         * Checks if an image of the given size would be packed at all. Only
+         * images up to half a page in each direction are; anything larger
+         * would leave most of its page empty.
+         */
+        bool accepts(unsigned int width, unsigned int height) const;
+
+        /**
+         * Copies an image into one of the pages.
+         *
+         * @param image  the image to pack
+         * @param region where the image ended up
+         * @return true if the image was packed, false if it is too big
+         */
+        bool add(const sf::Image & image, TextureRegion & region);
+
+        unsigned int getPageSize() const;
+        std::size_t getPageCount() const;
+    };
+
+} // hikari
+
+#endif // HIKARI_CORE_UTIL_TEXTUREATLAS
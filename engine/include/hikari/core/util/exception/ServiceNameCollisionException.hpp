@@ -0,0 +1,21 @@
+#ifndef HIKARI_CORE_UTIL_EXCEPTION_SERVICENAMECOLLISIONEXCEPTION
+#define HIKARI_CORE_UTIL_EXCEPTION_SERVICENAMECOLLISIONEXCEPTION
+
+#include "hikari/core/util/exception/HikariException.hpp"
+#include <string>
+
+namespace hikari {
+
+    /**
+     * Thrown when a service is registered under a name which has the same
+     * hash as the name of a service that's already registered.
+     */
+    class HIKARI_API ServiceNameCollisionException : public HikariException {
+    public:
+        explicit ServiceNameCollisionException(const std::string& messages);
+        virtual ~ServiceNameCollisionException() throw() { }
+    };
+
+} // hikari
+
+#endif // HIKARI_CORE_UTIL_EXCEPTION_SERVICENAMECOLLISIONEXCEPTION
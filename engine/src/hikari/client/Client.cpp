@@ -7,7 +7,11 @@
 #include "hikari/client/game/GamePlayState.hpp"
 #include "hikari/client/game/GameOverState.hpp"
 #include "hikari/client/game/KeyboardInput.hpp"
+#include "hikari/client/game/InputRecorder.hpp"
 #include "hikari/client/game/InputService.hpp"
+#include "hikari/client/game/RealTimeInput.hpp"
+#include "hikari/client/game/ReplayInput.hpp"
+#include "hikari/client/game/ScriptedInput.hpp"
 #include "hikari/client/game/ScreenEffectsService.hpp"
 #include "hikari/client/game/EventBusService.hpp"
 #include "hikari/client/game/events/EventBusImpl.hpp"
@@ -28,6 +32,7 @@
 #include "hikari/client/game/objects/ParticleFactory.hpp"
 #include "hikari/client/game/objects/PalettedAnimatedSprite.hpp"
 #include "hikari/client/gui/GuiService.hpp"
+#include "hikari/client/gui/ProfilerOverlay.hpp"
 #include "hikari/client/scripting/SquirrelService.hpp"
 #include "hikari/client/scripting/AudioServiceScriptProxy.hpp"
 #include "hikari/client/scripting/GameProgressScriptProxy.hpp"
@@ -44,6 +49,9 @@
 #include "hikari/core/util/ImageCache.hpp"
 #include "hikari/core/util/Log.hpp"
 #include "hikari/core/util/PhysFS.hpp"
+#include "hikari/core/util/ProcessInfo.hpp"
+#include "hikari/core/util/Profiler.hpp"
+#include "hikari/core/util/StringUtils.hpp"
 #include "hikari/core/util/TilesetCache.hpp"
 
 #include <squirrel.h>
@@ -53,9 +61,16 @@
 
 #include <guichan/gui.hpp>
 #include <guichan/exception.hpp>
+#include <guichan/widgets/container.hpp>
 
 #include <json/reader.h>
 
+#include <chrono>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+
 namespace hikari {
 
     const std::string Client::APP_TITLE             = "hikari";
@@ -68,6 +83,20 @@ namespace hikari {
     const unsigned int Client::SCREEN_WIDTH          = 256;
     const unsigned int Client::SCREEN_HEIGHT         = 240;
     const unsigned int Client::SCREEN_BITS_PER_PIXEL = 32;
+    const unsigned int Client::DEFAULT_HEADLESS_FRAMES = 60 * 60;
+
+    Client::LaunchOptions::LaunchOptions()
+        : headless(false)
+        , frameCount(DEFAULT_HEADLESS_FRAMES)
+        , mapFileName()
+        , inputScriptPath()
+        , recordPath()
+        , replayPath()
+        , hasRandomSeed(false)
+        , randomSeed(0)
+    {
+
+    }
 
     Client::Client(int argc, char** argv)
         : gameConfigJson()
@@ -80,8 +109,12 @@ namespace hikari {
         , window()
         , screenBuffer()
         , quitGame(false)
+        , speedMultiplier(1.0f)
+        , launchOptions()
+        , inputRecorder()
     {
         initLogging(argc, argv);
+        parseArguments(argc, argv);
         initFileSystem(argc, argv);
         initConfig();
         initEventBus();
@@ -89,6 +122,7 @@ namespace hikari {
 
     Client::~Client() {
         deinitFileSystem();
+        ::hikari::Log::stopAsync();
     }
 
     void Client::initConfig() {
@@ -110,6 +144,19 @@ namespace hikari {
             HIKARI_LOG(fatal) << "Couldn't find configuration file '" << PATH_CONFIG_FILE << "'";
         }
 
+        // Logging settings come from the client config
+        LogLevel logLevel = ::hikari::Log::getReportingLevel();
+
+        if(::hikari::Log::parseLevel(clientConfig.getLogLevel(), logLevel)) {
+            ::hikari::Log::setReportingLevel(logLevel);
+        } else {
+            HIKARI_LOG(warning) << "Unknown log level '" << clientConfig.getLogLevel() << "', ignoring.";
+        }
+
+        if(clientConfig.isAsyncLoggingEnabled()) {
+            ::hikari::Log::startAsync(clientConfig.getLogBufferSize());
+        }
+
         // Then load the game config
         if(FileSystem::exists(PATH_GAME_CONFIG_FILE)) {
             auto fs = FileSystem::openFileRead(PATH_GAME_CONFIG_FILE);
@@ -169,6 +216,7 @@ namespace hikari {
 
         auto gamePlayState = std::make_shared<GamePlayState>("gameplay", controller, gameConfigJson, gameConfig, services);
         GamePlayStateScriptProxy::setWrappedService(gamePlayState);
+        this->gamePlayState = gamePlayState;
 
         // Create controller and game states
         StageSelectStateConfig stageSelectConfig(gameConfigJson["states"]["select"]);
@@ -188,10 +236,19 @@ namespace hikari {
         controller.addState(titleState->getName(), titleState);
         controller.addState(optionsState->getName(), optionsState);
 
-        controller.setState(gameConfig->getInitialState());
+        initGamePlayInput(*gamePlayState);
+
+        if(launchOptions.headless || !launchOptions.mapFileName.empty()) {
+            // Skip the menus and go straight to the action.
+            gamePlayState->setMapOverride(launchOptions.mapFileName);
+            controller.setState(gamePlayState->getName());
+        } else {
+            controller.setState(gameConfig->getInitialState());
+        }
     }
 
     void Client::initLogging(int argc, char** argv) {
+        // Verbose until the client config is loaded; see initConfig().
         // #ifdef DEBUG
         ::hikari::Log::setReportingLevel(debug4);
         // #else
@@ -199,15 +256,52 @@ namespace hikari {
         // #endif
     }
 
+    void Client::parseArguments(int argc, char** argv) {
+        for(int i = 1; i < argc; ++i) {
+            const bool hasValue = i + 1 < argc;
+
+            if(std::strcmp(argv[i], "--headless") == 0) {
+                launchOptions.headless = true;
+            } else if(std::strcmp(argv[i], "--stage") == 0 && hasValue) {
+                launchOptions.mapFileName = argv[++i];
+            } else if(std::strcmp(argv[i], "--frames") == 0 && hasValue) {
+                try {
+                    launchOptions.frameCount = StringUtils::fromString<unsigned int>(argv[++i]);
+                } catch(std::exception & ex) {
+                    HIKARI_LOG(warning) << "Ignoring bad frame count: " << ex.what();
+                }
+            } else if(std::strcmp(argv[i], "--input") == 0 && hasValue) {
+                launchOptions.inputScriptPath = argv[++i];
+            } else if(std::strcmp(argv[i], "--record") == 0 && hasValue) {
+                launchOptions.recordPath = argv[++i];
+            } else if(std::strcmp(argv[i], "--replay") == 0 && hasValue) {
+                launchOptions.replayPath = argv[++i];
+            } else if(std::strcmp(argv[i], "--seed") == 0 && hasValue) {
+                try {
+                    launchOptions.randomSeed = StringUtils::fromString<std::uint32_t>(argv[++i]);
+                    launchOptions.hasRandomSeed = true;
+                } catch(std::exception & ex) {
+                    HIKARI_LOG(warning) << "Ignoring bad random seed: " << ex.what();
+                }
+            } else {
+                HIKARI_LOG(warning) << "Ignoring unknown argument '" << argv[i] << "'";
+            }
+        }
+    }
+
     void Client::initServices() {
         auto imageCache        = std::make_shared<ImageCache>(ImageCache::NO_SMOOTHING, ImageCache::USE_MASKING);
+        imageCache->enableAtlas();
+
         auto animationLoader   = std::make_shared<AnimationLoader>(std::weak_ptr<ImageCache>(imageCache));
         auto animationSetCache = std::make_shared<AnimationSetCache>(animationLoader);
         auto tilesetLoader     = std::make_shared<TilesetLoader>(imageCache, animationLoader);
         auto tilesetCache      = std::make_shared<TilesetCache>(tilesetLoader);
         auto mapLoader         = std::make_shared<MapLoader>(animationSetCache, imageCache, tilesetCache);
         auto gameProgress      = std::make_shared<GameProgress>();
-        auto audioService      = std::make_shared<AudioService>(gameConfigJson["assets"]["audio"]);
+        auto audioService      = launchOptions.headless
+                               ? std::make_shared<AudioService>()
+                               : std::make_shared<AudioService>(gameConfigJson["assets"]["audio"]);
         auto squirrelService   = std::make_shared<SquirrelService>(clientConfig.getScriptingStackSize());
         auto guiService        = std::make_shared<GuiService>(gameConfigJson, imageCache, screenBuffer);
         auto itemFactory       = std::make_shared<ItemFactory>(animationSetCache, imageCache, squirrelService);
@@ -218,7 +312,7 @@ namespace hikari {
         auto damageTable       = std::make_shared<DamageTable>();
         auto inputService      = std::make_shared<InputService>(globalInput);
         auto eventBusService   = std::make_shared<EventBusService>(globalEventBus);
-        auto screenEffectsService = std::make_shared<ScreenEffectsService>(eventBusService, screenBuffer.getSize().x, screenBuffer.getSize().y);
+        auto screenEffectsService = std::make_shared<ScreenEffectsService>(eventBusService, SCREEN_WIDTH, SCREEN_HEIGHT);
 
         gameProgress->setEventBus(globalEventBus);
 
@@ -299,7 +393,11 @@ namespace hikari {
     }
 
     void Client::loadPalettes() {
-        PalettedAnimatedSprite::setShaderFile("assets/shaders/palette.frag");
+        // Nothing is drawn in headless mode, so don't bother compiling shaders.
+        if(!launchOptions.headless) {
+            PalettedAnimatedSprite::setShaderFile("assets/shaders/palette.frag");
+        }
+
         PalettedAnimatedSprite::createColorTable(
             PaletteHelpers::loadPaletteFile("assets/palettes.json"));
     }
@@ -398,7 +496,6 @@ namespace hikari {
 
         const float dt = 1.0f/60.0f;
         float totalRuntime = 0.0f;
-        float speedMultiplier = 1.0f;
 
         sf::Time currentTime = clock.getElapsedTime();
         float accumulator = 0.0f;
@@ -409,7 +506,13 @@ namespace hikari {
 
         gcn::Gui & gui = guiService->getGui();
 
+        Profiler & profiler = Profiler::getInstance();
+        gui::ProfilerOverlay profilerOverlay(profiler);
+        profilerOverlay.setVisible(false);
+        guiService->getHudContainer().add(&profilerOverlay);
+
         while(!quitGame) {
+            profiler.beginFrame();
 
             //
             // Logic
@@ -428,21 +531,45 @@ namespace hikari {
                     }
 
                     if(event.type == sf::Event::KeyPressed || event.type == sf::Event::KeyReleased) {
+                        auto gamePlay = gamePlayState.lock();
+                        const bool consoleOpen = gamePlay && gamePlay->isConsoleOpen();
+
                         // Audio tweaking code
-                        if(event.key.code == sf::Keyboard::Y) {
-                            audioService->setMusicVolume(audioService->getMusicVolume() + 10.0f);
+                        if(!consoleOpen) {
+                            if(event.key.code == sf::Keyboard::Y) {
+                                audioService->setMusicVolume(audioService->getMusicVolume() + 10.0f);
+                            }
+                            if(event.key.code == sf::Keyboard::U) {
+                                audioService->setMusicVolume(audioService->getMusicVolume() - 10.0f);
+                            }
+                            if(event.key.code == sf::Keyboard::H) {
+                                audioService->mute();
+                            }
+                            if(event.key.code == sf::Keyboard::J) {
+                                audioService->unmute();
+                            }
                         }
-                        if(event.key.code == sf::Keyboard::U) {
-                            audioService->setMusicVolume(audioService->getMusicVolume() - 10.0f);
+
+                        // Profiler controls
+                        if(event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F3) {
+                            profiler.setEnabled(!profiler.isEnabled());
+                            profilerOverlay.setVisible(profiler.isEnabled());
                         }
-                        if(event.key.code == sf::Keyboard::H) {
-                            audioService->mute();
+                        if(event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F4) {
+                            exportProfile();
                         }
-                        if(event.key.code == sf::Keyboard::J) {
-                            audioService->unmute();
+
+                        // Key presses typed into the console don't reach the game's
+                        // input. Releases still do so no key is left held down.
+                        if(!consoleOpen || event.type == sf::Event::KeyReleased) {
+                            globalInput->processEvent(event);
                         }
 
-                        globalInput->processEvent(event);
+                        controller.handleEvent(event);
+                    }
+
+                    // Typed characters, for the command console
+                    if(event.type == sf::Event::TextEntered) {
                         controller.handleEvent(event);
                     }
 
@@ -462,8 +589,15 @@ namespace hikari {
                     }
                 }
 
-                controller.update(dt * speedMultiplier);
-                screenEffectsService->update(dt * speedMultiplier);
+                {
+                    HIKARI_PROFILE_ZONE("GameController::update");
+                    controller.update(dt * speedMultiplier);
+                }
+
+                {
+                    HIKARI_PROFILE_ZONE("ScreenEffectsService::update");
+                    screenEffectsService->update(dt * speedMultiplier);
+                }
 
                 // Update input after the game controller so you don't accidentally
                 // skip an event that took place.
@@ -479,27 +613,47 @@ namespace hikari {
 
             window.clear(sf::Color::Blue);
             screenBuffer.clear(sf::Color::Magenta);
-            controller.render(screenBuffer);
+
+            {
+                HIKARI_PROFILE_ZONE("GameController::render");
+                controller.render(screenBuffer);
+            }
 
             // This is weird because we call display() twice on screenBuffer.
             // We need to do this in order to render it to a buffer, and then
             // that buffer gets rendered back to screenBuffer, hence the need
             // to call display() again.
             screenBuffer.display();
-            screenEffectsService->setInputTexture(screenBuffer);
-            screenEffectsService->render(screenBuffer);
+
+            {
+                HIKARI_PROFILE_ZONE("ScreenEffectsService::render");
+                screenEffectsService->setInputTexture(screenBuffer);
+                screenEffectsService->render(screenBuffer);
+            }
 
             window.setView(screenBufferView);
-            guiService->renderHudContainer();
+
+            {
+                HIKARI_PROFILE_ZONE("GuiService::renderHudContainer");
+                guiService->renderHudContainer();
+            }
 
             screenBuffer.display();
 
             sf::Sprite renderSprite(screenBuffer.getTexture());
 
             window.draw(renderSprite);
-            window.display();
+
+            {
+                HIKARI_PROFILE_ZONE("RenderWindow::display");
+                window.display();
+            }
+
+            profiler.endFrame();
         }
 
+        guiService->getHudContainer().remove(&profilerOverlay);
+
         PalettedAnimatedSprite::destroySharedResources();
         SliceStateTransition::destroySharedTextures();
         ScreenEffectsService::destroyShaders();
@@ -507,12 +661,154 @@ namespace hikari {
         HIKARI_LOG(debug) << "Quitting; total run time = " << totalRuntime << " seconds.";
     }
 
+    void Client::exportProfile() {
+        char timestamp[32];
+        const std::time_t now = std::time(nullptr);
+        std::strftime(timestamp, sizeof(timestamp), "%Y%m%d-%H%M%S", std::localtime(&now));
+
+        const std::string fileName = std::string("profile-") + timestamp + ".json";
+
+        try {
+            auto out = FileSystem::openFileWrite(fileName);
+            Profiler::getInstance().writeChromeTrace(*out);
+
+            HIKARI_LOG(info) << "Wrote " << Profiler::getInstance().getFrameCount() << " profiled frame(s) to " << fileName;
+        } catch(std::exception & ex) {
+            HIKARI_LOG(warning) << "Couldn't write profile \"" << fileName << "\": " << ex.what();
+        }
+    }
+
+    void Client::initGamePlayInput(GamePlayState & gamePlayState) {
+        std::shared_ptr<Input> input;
+        std::uint32_t randomSeed = launchOptions.hasRandomSeed
+            ? launchOptions.randomSeed
+            : static_cast<std::uint32_t>(std::time(nullptr));
+
+        if(!launchOptions.replayPath.empty()) {
+            std::ifstream file(launchOptions.replayPath.c_str(), std::ios::binary);
+            InputRecording recording;
+
+            if(file && recording.read(file)) {
+                HIKARI_LOG(info) << "Replaying " << recording.getTickCount() << " tick(s) from '" << launchOptions.replayPath << "'";
+
+                // The recording's seed and speed win; anything else wouldn't
+                // replay the same.
+                randomSeed = recording.getRandomSeed();
+                speedMultiplier = recording.getSpeedMultiplier();
+                input = std::make_shared<ReplayInput>(recording);
+            } else {
+                HIKARI_LOG(error) << "Couldn't read replay '" << launchOptions.replayPath << "'";
+            }
+        }
+
+        if(!input && !launchOptions.inputScriptPath.empty()) {
+            std::ifstream file(launchOptions.inputScriptPath.c_str());
+            Json::Reader reader;
+            Json::Value script;
+
+            if(file && reader.parse(file, script, false)) {
+                input = std::make_shared<ScriptedInput>(script);
+            } else {
+                HIKARI_LOG(error) << "Couldn't read input script '" << launchOptions.inputScriptPath << "'";
+            }
+        }
+
+        if(!input && launchOptions.headless) {
+            // There's no keyboard to poll, so stand still. That's still a
+            // useful workload.
+            input = std::make_shared<ScriptedInput>(Json::Value());
+        }
+
+        if(!launchOptions.recordPath.empty()) {
+            inputRecorder = std::make_shared<InputRecorder>(
+                input ? input : std::make_shared<RealTimeInput>(),
+                randomSeed,
+                speedMultiplier
+            );
+            input = inputRecorder;
+        }
+
+        if(input) {
+            gamePlayState.setUserInput(input);
+        }
+
+        gamePlayState.setRandomSeed(randomSeed);
+
+        if(launchOptions.headless || !launchOptions.recordPath.empty() || !launchOptions.replayPath.empty()) {
+            gamePlayState.setEventProcessingBudget(EventBus::INFINITE);
+        }
+    }
+
+    void Client::saveRecording() const {
+        if(!inputRecorder) {
+            return;
+        }
+
+        std::ofstream file(launchOptions.recordPath.c_str(), std::ios::binary);
+
+        if(file) {
+            inputRecorder->getRecording().write(file);
+        }
+
+        if(file) {
+            HIKARI_LOG(info) << "Recorded " << inputRecorder->getRecording().getTickCount() << " tick(s) to '" << launchOptions.recordPath << "'";
+        } else {
+            HIKARI_LOG(error) << "Couldn't write recording '" << launchOptions.recordPath << "'";
+        }
+    }
+
+    int Client::runHeadless() {
+        typedef std::chrono::steady_clock Clock;
+
+        initServices();
+        initGame();
+
+        auto screenEffectsService = services.locateService<ScreenEffectsService>(Services::SCREENEFFECTS).lock();
+
+        const float dt = 1.0f/60.0f;
+        unsigned int frame = 0;
+
+        quitGame = false;
+
+        HIKARI_LOG(info) << "Simulating " << launchOptions.frameCount << " frame(s) without a window.";
+
+        const Clock::time_point start = Clock::now();
+
+        for(; frame < launchOptions.frameCount && !quitGame; ++frame) {
+            controller.update(dt * speedMultiplier);
+
+            if(screenEffectsService) {
+                screenEffectsService->update(dt * speedMultiplier);
+            }
+        }
+
+        const double seconds = std::chrono::duration_cast<std::chrono::duration<double>>(Clock::now() - start).count();
+        const double ticksPerSecond = seconds > 0.0 ? frame / seconds : 0.0;
+        const double peakMegabytes = ProcessInfo::getPeakMemoryUsage() / (1024.0 * 1024.0);
+
+        std::cout << "frames: " << frame << "\n"
+                  << "seconds: " << seconds << "\n"
+                  << "ticks per second: " << ticksPerSecond << "\n"
+                  << "peak memory (MiB): " << peakMegabytes << std::endl;
+
+        saveRecording();
+
+        PalettedAnimatedSprite::destroySharedResources();
+
+        return 0;
+    }
+
     int Client::run() {
+        if(launchOptions.headless) {
+            return runHeadless();
+        }
+
         initWindow();
         initServices();
         initGame();
 
         loop();
+        saveRecording();
 
         return 0;
     }
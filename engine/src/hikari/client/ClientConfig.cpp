@@ -16,6 +16,10 @@ namespace hikari {
     const char* ClientConfig::PROPERTY_VIDEOMODE = "videoMode";
     const char* ClientConfig::PROPERTY_BINDINGS = "bindings";
     const char* ClientConfig::PROPERTY_KEYBOARD_BINDINGS = "keyboard";
+    const char* ClientConfig::PROPERTY_LOGGING = "logging";
+    const char* ClientConfig::PROPERTY_LOGGING_LEVEL = "level";
+    const char* ClientConfig::PROPERTY_LOGGING_ASYNC = "async";
+    const char* ClientConfig::PROPERTY_LOGGING_BUFFERSIZE = "bufferSize";
 
     const char* ClientConfig::VIDEO_SCALE_1X = "1x";
     const char* ClientConfig::VIDEO_SCALE_2X = "2x";
@@ -54,6 +58,17 @@ namespace hikari {
                 }
             }
 
+            //
+            // Extract logging settings
+            //
+            if(configJson.isMember(PROPERTY_LOGGING)) {
+                const Json::Value & loggingConfigJson = configJson.get(PROPERTY_LOGGING, Json::Value());
+
+                logLevel = loggingConfigJson.get(PROPERTY_LOGGING_LEVEL, logLevel).asString();
+                enableAsyncLogging = loggingConfigJson.get(PROPERTY_LOGGING_ASYNC, enableAsyncLogging).asBool();
+                logBufferSize = loggingConfigJson.get(PROPERTY_LOGGING_BUFFERSIZE, logBufferSize).asUInt();
+            }
+
             //
             // Extract video mode settings
             //
@@ -91,6 +106,9 @@ namespace hikari {
         : enableVsync(false)
         , enableFpsDisplay(false)
         , stackSize(1024)
+        , enableAsyncLogging(true)
+        , logBufferSize(4096)
+        , logLevel("info")
         , musicVolume(100.0f)
         , sampleVolume(100.0f)
         , videoMode("1x")
@@ -103,6 +121,9 @@ namespace hikari {
         : enableVsync(false)
         , enableFpsDisplay(false)
         , stackSize(1024)
+        , enableAsyncLogging(true)
+        , logBufferSize(4096)
+        , logLevel("info")
         , musicVolume(100.0f)
         , sampleVolume(100.0f)
         , videoMode("1x")
@@ -147,6 +168,18 @@ namespace hikari {
         return stackSize;
     }
 
+    bool ClientConfig::isAsyncLoggingEnabled() const {
+        return enableAsyncLogging;
+    }
+
+    unsigned int ClientConfig::getLogBufferSize() const {
+        return logBufferSize;
+    }
+
+    std::string ClientConfig::getLogLevel() const {
+        return logLevel;
+    }
+
     std::string ClientConfig::getVideoMode() const {
         return videoMode;
     }
@@ -175,6 +208,10 @@ namespace hikari {
         container[PROPERTY_FPS] = isFpsDisplayEnabled();
         container[PROPERTY_SCRIPTING] = Json::Value(Json::objectValue);
         container[PROPERTY_SCRIPTING][PROPERTY_SCRIPTING_STACKSIZE] = getScriptingStackSize();
+        container[PROPERTY_LOGGING] = Json::Value(Json::objectValue);
+        container[PROPERTY_LOGGING][PROPERTY_LOGGING_LEVEL] = getLogLevel();
+        container[PROPERTY_LOGGING][PROPERTY_LOGGING_ASYNC] = isAsyncLoggingEnabled();
+        container[PROPERTY_LOGGING][PROPERTY_LOGGING_BUFFERSIZE] = getLogBufferSize();
         
         // Write all of the keybindings to an object and then attach it
         Json::Value keybindingObject(Json::objectValue);
@@ -17,28 +17,41 @@ namespace hikari {
         , mutedFlag(false)
         , sampleVolume(DEFAULT_VOLUME)
         , musicVolume(DEFAULT_VOLUME)
-        , musicStream(MUSIC_BUFFER_SIZE, 1)
-        , sampleStream(SAMPLE_BUFFER_SIZE, 12)
+        , musicStream(new NSFSoundStream(MUSIC_BUFFER_SIZE, 1))
+        , sampleStream(new NSFSoundStream(SAMPLE_BUFFER_SIZE, 12))
         , library(nullptr)
     {
         if(isValidConfiguration(configuration)) {
             auto musicDataFilePath = configuration["music"].asString();
-            musicLoaded = musicStream.open(musicDataFilePath);
+            musicLoaded = musicStream->open(musicDataFilePath);
 
             auto samplesDataFilePath = configuration["samples"].asString();
-            samplesLoaded = sampleStream.open(samplesDataFilePath);
+            samplesLoaded = sampleStream->open(samplesDataFilePath);
 
             library.reset(new SoundLibrary(configuration["library"].asString()));
         }
     }
 
+    AudioService::AudioService()
+        : musicLoaded(false)
+        , samplesLoaded(false)
+        , mutedFlag(false)
+        , sampleVolume(DEFAULT_VOLUME)
+        , musicVolume(DEFAULT_VOLUME)
+        , musicStream(nullptr)
+        , sampleStream(nullptr)
+        , library(nullptr)
+    {
+
+    }
+
     AudioService::~AudioService() {
         if(isMusicLoaded()) {
-            musicStream.stop();
+            musicStream->stop();
         }
 
         if(isSamplesLoaded()) {
-            sampleStream.stop();
+            sampleStream->stop();
         }
     }
 
@@ -54,19 +67,21 @@ namespace hikari {
     }
 
     void AudioService::playMusic(const std::string & name) {
-        if(library->isEnabled()) {
+        if(library && library->isEnabled()) {
             const auto stream = library->playMusic(name, getMusicVolume());
         }
     }
 
     void AudioService::stopMusic() {
-        library->stopMusic();
+        if(library) {
+            library->stopMusic();
+        }
     }
 
     void AudioService::setMusicVolume(float volume) {
         musicVolume = volume;
 
-        if(library->isEnabled()) {
+        if(library && library->isEnabled()) {
             library->setMusicVolume(musicVolume);
         }
     }
@@ -76,7 +91,7 @@ namespace hikari {
     }
 
     void AudioService::playSample(const std::string & name) {
-        if(library->isEnabled()) {
+        if(library && library->isEnabled()) {
             const auto stream = library->playSample(name, getSampleVolume());
         }
     }
@@ -84,7 +99,7 @@ namespace hikari {
     void AudioService::setSampleVolume(float volume) {
         sampleVolume = volume;
 
-        if(library->isEnabled()) {
+        if(library && library->isEnabled()) {
             library->setSampleVolume(sampleVolume);
         }
     }
@@ -94,7 +109,9 @@ namespace hikari {
     }
 
     void AudioService::stopAllSamples() {
-        library->stopSample();
+        if(library) {
+            library->stopSample();
+        }
     }
 
     bool AudioService::isMusicLoaded() const {
@@ -108,7 +125,7 @@ namespace hikari {
     void AudioService::mute() {
         mutedFlag = true;
 
-        if(library->isEnabled()) {
+        if(library && library->isEnabled()) {
             library->setMusicVolume(getMusicVolume());
             library->setSampleVolume(getSampleVolume());
         }
@@ -117,7 +134,7 @@ namespace hikari {
     void AudioService::unmute() {
         mutedFlag = false;
 
-        if(library->isEnabled()) {
+        if(library && library->isEnabled()) {
             library->setMusicVolume(getMusicVolume());
             library->setSampleVolume(getSampleVolume());
         }
@@ -5,8 +5,7 @@
 #include <Music_Emu.h>
 #include <gme.h>
 
-#include <climits>
-#include <iostream>
+#include <algorithm>
 
 namespace hikari {
 
@@ -15,6 +14,7 @@ namespace hikari {
         , masterBufferSize(bufferSize)
         , samplerCount(samplerCount)
         // , activeSampler(0)
+        , mixSources()
         , masterBuffer(new short[masterBufferSize])
         , sampleBuffers()
         , sampleEmus()
@@ -24,6 +24,10 @@ namespace hikari {
         samplerCount = std::max(samplerCount, static_cast<std::size_t>(1));
         this->samplerCount = samplerCount;
 
+        // Reserve up front so onGetData never allocates on the audio thread
+        activeSamplers.reserve(samplerCount);
+        mixSources.reserve(samplerCount);
+
         createSampleBuffers();
 
         this->stop();
@@ -115,76 +119,38 @@ namespace hikari {
         //         sampleEmus[bufferIndex]->play(masterBufferSize, sampleBuffers[bufferIndex].get());
         //     }
         // }
-        activeSamplers.remove_if([&](const SamplerPair & pair) -> bool {
-            bool ended = (pair.first)->track_ended();
-            int track = (pair.first)->current_track();
+        activeSamplers.erase(
+            std::remove_if(std::begin(activeSamplers), std::end(activeSamplers), [&](const SamplerPair & pair) -> bool {
+                bool ended = (pair.first)->track_ended();
+                int track = (pair.first)->current_track();
+
+                if(ended) {
+                    availableSamplers.push(pair);
+                    samplerSlots.erase(track);
+                }
 
-            if(ended) {
-                availableSamplers.push(pair);
-                samplerSlots.erase(track);
-            }
-
-            return ended;
-        });
+                return ended;
+            }),
+            std::end(activeSamplers)
+        );
 
         if(activeSamplers.size() == 0) {
             keepGoing = false;
         }
 
+        mixSources.clear();
+
         std::for_each(std::begin(activeSamplers), std::end(activeSamplers), [&](SamplerPair & pair) {
             auto & emu = pair.first;
             auto & buffer = *pair.second;
 
             if(!emu->track_ended()) {
                 emu->play(masterBufferSize, &buffer[0]);
-            } else {
-                //availableSamplers.push(pair);
+                mixSources.push_back(&buffer[0]);
             }
         });
 
-        for(std::size_t i = 0; i < masterBufferSize; ++i) {
-            short mixedValue = SHRT_MAX;
-            std::cout << "mixedValue = " << mixedValue << std::endl;
-            std::for_each(std::begin(activeSamplers), std::end(activeSamplers), [&](SamplerPair & pair) {
-                auto & emu = pair.first;
-                auto & buffer = *pair.second;
-
-                if(!emu->track_ended()) {
-                    // This mixing strategy came from: http://www.vttoth.com/CMS/index.php/technical-notes/68
-                    // And supporting information from: http://cboard.cprogramming.com/c-programming/103456-mixing-pcm-samples-dealing-clicks-overflow.html
-                    //mixedValue = mixedValue + buffer[i] - ((mixedValue * buffer[i]) / 65535);
-
-                    // Method dreived from: http://stackoverflow.com/a/10029792
-                    float a = (mixedValue + 32767.0f) / 65536.0f;
-                    float b = (buffer[i] + 32767.0f) / 65536.0f;
-
-                    mixedValue = static_cast<short>((a + b) * 65536.0f);
-                } else {
-                    buffer[i] = 0;
-                }
-            });
-
-            mixedBuffer[i] = mixedValue;
-        }
-
-        // HIKARI_LOG(debug2) << "Active samplers: " <<activeSamplers.size();
-
-        // Mix buffers
-        // for(int i = 0; i < masterBufferSize; ++i) {
-        //     short mixedValue = 0;
-
-        //     for(int bufferIndex = 0; bufferIndex < samplerCount; ++bufferIndex) {
-        //         // Don't mix buffers that aren't playing.
-        //         if(!sampleEmus[bufferIndex]->track_ended()) {
-        //             mixedValue += sampleBuffers[bufferIndex].get()[i];
-        //         } else {
-        //             // Zero-out any buffer that isn't playing.
-        //             sampleBuffers[bufferIndex].get()[i] = 0;
-        //         }
-        //     }
-
-        //     mixedBuffer[i] = mixedValue;
-        // }
+        mixSamples(mixSources.data(), mixSources.size(), mixedBuffer, masterBufferSize);
 
         Data.samples     = &masterBuffer[0];
         Data.sampleCount = masterBufferSize;
@@ -255,14 +221,14 @@ namespace hikari {
     void NSFSoundStream::stopAllSamplers() {
         sf::Lock lock(mutex);
 
-        activeSamplers.remove_if([&](const SamplerPair & pair) -> bool {
+        std::for_each(std::begin(activeSamplers), std::end(activeSamplers), [&](const SamplerPair & pair) {
             int track = (pair.first)->current_track();
 
             availableSamplers.push(pair);
             samplerSlots.erase(track);
-
-            return true;
         });
+
+        activeSamplers.clear();
     }
 
     const std::string NSFSoundStream::getTrackName() {
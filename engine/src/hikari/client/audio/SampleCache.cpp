@@ -0,0 +1,55 @@
+#include "hikari/client/audio/SampleCache.hpp"
+
+#include <cstring>
+#include <ostream>
+
+namespace hikari {
+
+    const char SampleCache::MAGIC[4] = { 'H', 'K', 'S', 'C' };
+    const std::uint32_t SampleCache::VERSION = 1;
+
+    void SampleCache::write(std::ostream & output, std::uint32_t sampleRate, std::uint32_t channelCount, const std::vector<short> & pcm) {
+        Header header;
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = VERSION;
+        header.sampleRate = sampleRate;
+        header.channelCount = channelCount;
+        header.sampleCount = static_cast<std::uint32_t>(pcm.size());
+
+        output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        if(!pcm.empty()) {
+            output.write(reinterpret_cast<const char*>(&pcm[0]), static_cast<std::streamsize>(pcm.size() * sizeof(short)));
+        }
+    }
+
+    bool SampleCache::read(const std::vector<char> & contents, std::uint32_t sampleRate, std::uint32_t channelCount, std::vector<short> & pcm) {
+        Header header;
+
+        if(contents.size() < sizeof(header)) {
+            return false;
+        }
+
+        std::memcpy(&header, &contents[0], sizeof(header));
+
+        const std::size_t pcmBytes = contents.size() - sizeof(header);
+
+        if(std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0
+            || header.version != VERSION
+            || header.sampleRate != sampleRate
+            || header.channelCount != channelCount
+            || pcmBytes != header.sampleCount * sizeof(short))
+        {
+            return false;
+        }
+
+        pcm.resize(header.sampleCount);
+
+        if(header.sampleCount > 0) {
+            std::memcpy(&pcm[0], &contents[sizeof(header)], pcmBytes);
+        }
+
+        return true;
+    }
+
+} // hikari
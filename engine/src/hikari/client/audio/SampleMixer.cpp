@@ -0,0 +1,81 @@
+#include "hikari/client/audio/SampleMixer.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+
+namespace hikari {
+
+    namespace {
+        const std::size_t BLOCK_SIZE = 256;
+
+        inline short saturate(std::int32_t value) {
+            return static_cast<short>(std::min<std::int32_t>(std::max<std::int32_t>(value, SHRT_MIN), SHRT_MAX));
+        }
+
+        //
+        // Mixes count samples starting at offset. The loops are written with
+        // a compile-time trip count for whole blocks so they vectorize
+        // without a scalar epilogue; the final partial block takes the
+        // generic path.
+        //
+        template <std::size_t Count>
+        void mixBlock(const short * const * sources, std::size_t sourceCount, short * output, std::size_t offset) {
+            std::int32_t sum[Count];
+            const short * first = sources[0] + offset;
+
+            for(std::size_t i = 0; i < Count; ++i) {
+                sum[i] = first[i];
+            }
+
+            for(std::size_t source = 1; source < sourceCount; ++source) {
+                const short * samples = sources[source] + offset;
+
+                for(std::size_t i = 0; i < Count; ++i) {
+                    sum[i] += samples[i];
+                }
+            }
+
+            short * mixed = output + offset;
+
+            for(std::size_t i = 0; i < Count; ++i) {
+                mixed[i] = saturate(sum[i]);
+            }
+        }
+
+        void mixPartialBlock(const short * const * sources, std::size_t sourceCount, short * output, std::size_t offset, std::size_t count) {
+            for(std::size_t i = offset; i < offset + count; ++i) {
+                std::int32_t sum = 0;
+
+                for(std::size_t source = 0; source < sourceCount; ++source) {
+                    sum += sources[source][i];
+                }
+
+                output[i] = saturate(sum);
+            }
+        }
+    }
+
+    void mixSamples(const short * const * sources, std::size_t sourceCount, short * output, std::size_t sampleCount) {
+        if(sourceCount == 0) {
+            std::fill(output, output + sampleCount, static_cast<short>(0));
+            return;
+        }
+
+        if(sourceCount == 1) {
+            std::copy(sources[0], sources[0] + sampleCount, output);
+            return;
+        }
+
+        std::size_t offset = 0;
+
+        for(; offset + BLOCK_SIZE <= sampleCount; offset += BLOCK_SIZE) {
+            mixBlock<BLOCK_SIZE>(sources, sourceCount, output, offset);
+        }
+
+        if(offset < sampleCount) {
+            mixPartialBlock(sources, sourceCount, output, offset, sampleCount - offset);
+        }
+    }
+
+} // hikari
@@ -0,0 +1,72 @@
+#include "hikari/client/audio/SampleRenderer.hpp"
+#include "hikari/core/util/Log.hpp"
+#include <Music_Emu.h>
+#include <gme.h>
+
+namespace hikari {
+
+    const long SampleRenderer::SAMPLE_RATE = 44100;
+    const unsigned int SampleRenderer::CHANNEL_COUNT = 2;
+    const std::size_t SampleRenderer::MAXIMUM_SAMPLE_COUNT = 4 * SAMPLE_RATE; // Cap samples at 4 seconds
+
+    SampleRenderer::SampleRenderer(const std::string & fileName, const std::vector<char> & fileData)
+        : emu()
+        , renderBuffer(512)
+    {
+        gme_type_t fileType = gme_identify_extension(fileName.c_str());
+
+        if(fileType && !fileData.empty()) {
+            emu.reset(fileType->new_emu());
+
+            if(emu) {
+                gme_err_t error = emu->set_sample_rate(SAMPLE_RATE);
+
+                if(!error) {
+                    error = gme_load_data(emu.get(), &fileData[0], static_cast<long>(fileData.size()));
+                }
+
+                if(error) {
+                    HIKARI_LOG(debug) << "Couldn't create sample renderer for " << fileName << ": " << error;
+                    emu.reset();
+                }
+            }
+        }
+    }
+
+    SampleRenderer::~SampleRenderer() {
+
+    }
+
+    bool SampleRenderer::isValid() const {
+        return static_cast<bool>(emu);
+    }
+
+    bool SampleRenderer::render(int track, std::vector<short> & samples) {
+        samples.clear();
+
+        if(!emu || emu->start_track(track)) {
+            return false;
+        }
+
+        const std::size_t bufferSize = renderBuffer.size();
+
+        while(!emu->track_ended() && samples.size() < MAXIMUM_SAMPLE_COUNT) {
+            if(emu->play(static_cast<long>(bufferSize), &renderBuffer[0])) {
+                return false;
+            }
+
+            samples.insert(std::end(samples), std::begin(renderBuffer), std::end(renderBuffer));
+        }
+
+        return true;
+    }
+
+    long SampleRenderer::getSampleRate() {
+        return SAMPLE_RATE;
+    }
+
+    unsigned int SampleRenderer::getChannelCount() {
+        return CHANNEL_COUNT;
+    }
+
+} // hikari
@@ -1,11 +1,21 @@
 #include "hikari/client/audio/SoundLibrary.hpp"
 #include "hikari/client/audio/GMESoundStream.hpp"
+#include "hikari/client/audio/SampleCache.hpp"
+#include "hikari/client/audio/SampleRenderer.hpp"
+#include "hikari/core/util/ContentHash.hpp"
 #include "hikari/core/util/FileSystem.hpp"
 #include "hikari/core/util/Log.hpp"
+#include "hikari/core/util/PhysFS.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <functional>
+#include <iomanip>
+#include <map>
+#include <sstream>
 #include <string>
+#include <thread>
 
 #include <SFML/Audio/Sound.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
@@ -18,6 +28,16 @@ namespace hikari {
     const unsigned int SoundLibrary::MUSIC_BUFFER_SIZE = 2048 * 2;  // some platforms need larger buffer
     const unsigned int SoundLibrary::SAMPLE_BUFFER_SIZE = 2048 * 2; // so we'll double it for now.
     const unsigned int SoundLibrary::AUDIO_SAMPLE_RATE = 44100;
+    const char * SoundLibrary::SAMPLE_CACHE_DIRECTORY = "cache/samples";
+
+    namespace {
+        std::string makeCachePath(const std::string & directory, std::uint64_t contentHash, unsigned int track) {
+            std::ostringstream path;
+            path << directory << "/" << std::hex << std::setw(16) << std::setfill('0') << contentHash
+                 << std::dec << "-" << track << ".pcm";
+            return path.str();
+        }
+    }
 
     SoundLibrary::SoundLibrary(const std::string & file)
         : isEnabledFlag(false)
@@ -42,6 +62,10 @@ namespace hikari {
         Json::Value root;
         auto fileContents = FileSystem::openFileRead(file);
 
+        std::vector<std::string> nsfFiles;
+        std::vector<std::vector<char>> nsfContents;
+        std::vector<PendingSample> pendingSamples;
+
         if(reader.parse(*fileContents, root, false)) {
             auto nsfCount = root.size();
 
@@ -50,16 +74,19 @@ namespace hikari {
                 const std::string nsfFile = currentLibrary[PROP_FILE].asString();
 
                 //
-                // Create the sound stream/emulators
+                // Create the sound stream/emulator for music
                 //
                 auto musicStream = std::make_shared<GMESoundStream>(MUSIC_BUFFER_SIZE);
-                auto sampleStream = std::make_shared<GMESoundStream>(SAMPLE_BUFFER_SIZE);
                 musicStream->open(nsfFile);
-                sampleStream->open(nsfFile);
 
                 samplers.push_back(musicStream);
                 HIKARI_LOG(debug) << "Loaded sampler for " << nsfFile;
 
+                // Keep the file's contents around for the sample render workers
+                nsfFiles.push_back(nsfFile);
+                nsfContents.push_back(FileSystem::readFileAsCharBuffer(nsfFile));
+                const std::uint64_t contentHash = hashContents(nsfContents.back());
+
                 //
                 // Parse the music
                 //
@@ -79,42 +106,166 @@ namespace hikari {
                 }
 
                 //
-                // Parse the samples
+                // Parse the samples; their PCM data is produced below
                 //
                 const Json::Value & sampleArray = currentLibrary[PROP_SAMPLES];
                 auto sampleCount = sampleArray.size();
 
                 for(decltype(sampleCount) sampleIndex = 0; sampleIndex < sampleCount; ++sampleIndex) {
                     const Json::Value & sampleEntryJson = sampleArray[sampleIndex];
-                    const std::string & name = sampleEntryJson[PROP_NAME].asString();
 
                     auto sampleEntry = std::make_shared<SampleEntry>();
                     sampleEntry->track = sampleEntryJson[PROP_TRACK].asUInt();
                     sampleEntry->priority = sampleEntryJson[PROP_PRIORITY].asUInt();
                     sampleEntry->samplerId = samplerIndex;
 
-                    // Create a sound buffer and pre-render the sample into it.
-                    auto sampleSoundBuffer = std::shared_ptr<sf::SoundBuffer>(
-                            sampleStream->renderTrackToBuffer(sampleEntry->track));
+                    PendingSample pendingSample;
+                    pendingSample.name = sampleEntryJson[PROP_NAME].asString();
+                    pendingSample.cachePath = makeCachePath(SAMPLE_CACHE_DIRECTORY, contentHash, sampleEntry->track);
+                    pendingSample.entry = sampleEntry;
+                    pendingSample.needsRendering = false;
+
+                    pendingSamples.push_back(pendingSample);
+                }
+            }
+        }
+
+        //
+        // Pre-render samples which aren't cached yet
+        //
+        std::for_each(std::begin(pendingSamples), std::end(pendingSamples), [this](PendingSample & pendingSample) {
+            pendingSample.needsRendering = !readCachedSample(pendingSample);
+        });
+
+        renderSamples(pendingSamples, nsfFiles, nsfContents);
+
+        std::for_each(std::begin(pendingSamples), std::end(pendingSamples), [this](PendingSample & pendingSample) {
+            const std::string & name = pendingSample.name;
+
+            if(pendingSample.needsRendering) {
+                writeCachedSample(pendingSample);
+            }
+
+            auto sampleSoundBuffer = std::make_shared<sf::SoundBuffer>();
+
+            if(!pendingSample.pcm.empty()) {
+                sampleSoundBuffer->loadFromSamples(
+                    &pendingSample.pcm[0],
+                    pendingSample.pcm.size(),
+                    SampleRenderer::getChannelCount(),
+                    SampleRenderer::getSampleRate()
+                );
+            }
+
+            // Index the buffers my the same key (the name of the sample)
+            sampleSoundBuffers.insert(std::make_pair(name, sampleSoundBuffer));
+
+            auto p = std::make_shared<SamplePlayer>();
+            p->buffer = sampleSoundBuffer;
+            p->player = std::make_shared<sf::Sound>(*sampleSoundBuffer.get());
+            p->priority = pendingSample.entry->priority;
+
+            samplePlayers.insert(std::make_pair(name, p));
+
+            samples.insert(std::make_pair(name, pendingSample.entry));
+            HIKARI_LOG(debug) << "\t-> loaded sample \"" << name << "\"";
+        });
+
+        isEnabledFlag = true;
+    }
+
+    void SoundLibrary::renderSamples(std::vector<PendingSample> & pendingSamples,
+        const std::vector<std::string> & nsfFiles,
+        const std::vector<std::vector<char>> & nsfContents) const
+    {
+        std::vector<PendingSample*> jobs;
 
-                    // Index the buffers my the same key (the name of the sample)
-                    sampleSoundBuffers.insert(std::make_pair(name, sampleSoundBuffer));
+        std::for_each(std::begin(pendingSamples), std::end(pendingSamples), [&jobs](PendingSample & pendingSample) {
+            if(pendingSample.needsRendering) {
+                jobs.push_back(&pendingSample);
+            }
+        });
+
+        if(jobs.empty()) {
+            return;
+        }
 
-                    auto p = std::make_shared<SamplePlayer>();
-                    p->buffer = sampleSoundBuffer;
-                    p->player = std::make_shared<sf::Sound>(*sampleSoundBuffer.get());
-                    p->priority = sampleEntryJson[PROP_PRIORITY].asUInt();
+        // Jobs are handed out through a shared counter so that slow tracks
+        // don't hold up a whole worker's share of the work.
+        std::atomic<std::size_t> nextJob(0);
 
-                    samplePlayers.insert(std::make_pair(name, p));
+        auto worker = [&]() {
+            std::map<unsigned int, std::unique_ptr<SampleRenderer>> renderers;
 
-                    samples.insert(std::make_pair(name, sampleEntry));
-                    HIKARI_LOG(debug) << "\t-> loaded sample \"" << name << "\"";
+            for(std::size_t jobIndex = nextJob++; jobIndex < jobs.size(); jobIndex = nextJob++) {
+                PendingSample & pendingSample = *jobs[jobIndex];
+                const unsigned int samplerId = pendingSample.entry->samplerId;
+                auto & renderer = renderers[samplerId];
 
+                if(!renderer) {
+                    renderer.reset(new SampleRenderer(nsfFiles.at(samplerId), nsfContents.at(samplerId)));
+                }
+
+                if(!renderer->render(pendingSample.entry->track, pendingSample.pcm)) {
+                    pendingSample.pcm.clear();
                 }
             }
+        };
+
+        const unsigned int hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+        const std::size_t workerCount = std::min(static_cast<std::size_t>(hardwareThreads), jobs.size());
+        std::vector<std::thread> workers;
+
+        HIKARI_LOG(debug) << "Rendering " << jobs.size() << " sample(s) on " << workerCount << " thread(s)";
+
+        // The calling thread does its share of the work too.
+        for(std::size_t i = 1; i < workerCount; ++i) {
+            workers.push_back(std::thread(worker));
         }
 
-        isEnabledFlag = true;
+        worker();
+
+        std::for_each(std::begin(workers), std::end(workers), [](std::thread & thread) {
+            thread.join();
+        });
+    }
+
+    bool SoundLibrary::readCachedSample(PendingSample & pendingSample) const {
+        if(!FileSystem::exists(pendingSample.cachePath)) {
+            return false;
+        }
+
+        const std::vector<char> contents = FileSystem::readFileAsCharBuffer(pendingSample.cachePath);
+        const std::uint32_t sampleRate = static_cast<std::uint32_t>(SampleRenderer::getSampleRate());
+
+        if(!SampleCache::read(contents, sampleRate, SampleRenderer::getChannelCount(), pendingSample.pcm)) {
+            HIKARI_LOG(debug) << "Ignoring stale cached sample " << pendingSample.cachePath;
+            return false;
+        }
+
+        return true;
+    }
+
+    void SoundLibrary::writeCachedSample(const PendingSample & pendingSample) const {
+        if(pendingSample.pcm.empty()) {
+            return;
+        }
+
+        try {
+            if(!PhysFS::exists(SAMPLE_CACHE_DIRECTORY)) {
+                PhysFS::mkdir(SAMPLE_CACHE_DIRECTORY);
+            }
+
+            auto out = FileSystem::openFileWrite(pendingSample.cachePath);
+            SampleCache::write(
+                *out,
+                static_cast<std::uint32_t>(SampleRenderer::getSampleRate()),
+                SampleRenderer::getChannelCount(),
+                pendingSample.pcm
+            );
+        } catch(std::exception & ex) {
+            HIKARI_LOG(warning) << "Couldn't cache sample \"" << pendingSample.name << "\": " << ex.what();
+        }
     }
 
     bool SoundLibrary::isEnabled() const {
@@ -8,6 +8,8 @@
 #include "hikari/client/game/objects/Spawner.hpp"
 #include "hikari/client/game/objects/controllers/CutSceneHeroActionController.hpp"
 #include "hikari/client/game/objects/controllers/PlayerInputHeroActionController.hpp"
+#include "hikari/client/scripting/BehaviorUpdateBatch.hpp"
+#include "hikari/client/scripting/ScriptWorldState.hpp"
 #include "hikari/client/scripting/SquirrelService.hpp"
 #include "hikari/client/game/objects/GameObject.hpp"
 #include "hikari/client/game/objects/CollectableItem.hpp"
@@ -16,7 +18,6 @@
 #include "hikari/client/game/objects/EnemyFactory.hpp"
 #include "hikari/client/game/objects/Projectile.hpp"
 #include "hikari/client/game/objects/ProjectileFactory.hpp"
-#include "hikari/client/game/objects/Particle.hpp"
 #include "hikari/client/game/objects/ParticleFactory.hpp"
 #include "hikari/client/game/objects/PalettedAnimatedSprite.hpp"
 #include "hikari/client/game/Effect.hpp"
@@ -46,7 +47,10 @@
 #include "hikari/client/game/events/EventData.hpp"
 #include "hikari/client/game/events/WeaponFireEventData.hpp"
 #include "hikari/client/game/events/ObjectRemovedEventData.hpp"
+#include "hikari/client/game/events/EventPool.hpp"
 #include "hikari/client/game/ScreenEffectsService.hpp"
+#include "hikari/client/gui/CommandConsole.hpp"
+#include "hikari/client/gui/ConsoleCommands.hpp"
 #include "hikari/client/gui/GuiService.hpp"
 #include "hikari/client/gui/Menu.hpp"
 #include "hikari/client/gui/WeaponMenuItem.hpp"
@@ -59,20 +63,22 @@
 #include "hikari/core/game/TileMapCollisionResolver.hpp"
 #include "hikari/core/game/WorldCollisionResolver.hpp"
 #include "hikari/core/game/map/MapLoader.hpp"
+#include "hikari/core/game/map/StageFormat.hpp"
 #include "hikari/core/game/map/MapRenderer.hpp"
 #include "hikari/core/game/map/Door.hpp"
 #include "hikari/core/game/map/Force.hpp"
 #include "hikari/core/game/map/Room.hpp"
 #include "hikari/core/game/map/RoomTransition.hpp"
 #include "hikari/core/geom/GeometryUtils.hpp"
+#include "hikari/core/gui/ImageFont.hpp"
 #include "hikari/core/util/ImageCache.hpp"
 #include "hikari/core/util/AnimationSetCache.hpp"
 #include "hikari/core/util/JsonUtils.hpp"
 #include "hikari/core/util/FileSystem.hpp"
-#include "hikari/core/util/ReferenceWrapper.hpp"
 #include "hikari/core/util/ServiceLocator.hpp"
 #include "hikari/core/util/StringUtils.hpp"
 #include "hikari/core/util/Log.hpp"
+#include "hikari/core/util/Profiler.hpp"
 
 #include <json/value.h>
 
@@ -97,6 +103,7 @@
 namespace hikari {
 
     const std::string GamePlayState::MENU_ACTION_ETANK = "useETank";
+    const unsigned long GamePlayState::EVENT_PROCESSING_BUDGET_MILLIS = 4;
 
     GamePlayState::GamePlayState(const std::string &name, GameController & controller, const Json::Value &params, const std::weak_ptr<GameConfig> & gameConfig, ServiceLocator &services)
         : name(name)
@@ -111,6 +118,7 @@ namespace hikari {
         , imageCache(services.locateService<ImageCache>(Services::IMAGECACHE))
         , userInput(new RealTimeInput())
         , scriptEnv(services.locateService<SquirrelService>(Services::SCRIPTING))
+        , scriptWorldState(new ScriptWorldState(scriptEnv->getVmInstance()))
         , screenEffectsService(services.locateService<ScreenEffectsService>(Services::SCREENEFFECTS))
         , collisionResolver(new WorldCollisionResolver())
         , currentMap(nullptr)
@@ -135,15 +143,21 @@ namespace hikari {
         , guiWeaponMenu(new gui::Menu())
         , guiWeaponMenuActionListener(nullptr)
         , guiWeaponMenuSelectionListener(nullptr)
+        , console(nullptr)
         , keyboardInput(new KeyboardInput())
         , oldHeroPosition(new Vector2<float>())
+        , mapLoader(services.locateService<MapLoader>(hikari::Services::MAPLOADER))
+        , mapFiles()
         , maps()
+        , mapOverride()
         , itemSpawners()
         , deactivatedItemSpawners()
         , eventHandlerDelegates()
         , bonusChancesTable()
         , taskQueue()
         , world()
+        , spriteBatch()
+        , random(static_cast<std::uint32_t>(std::time(nullptr)))
         , camera(Rectangle2D<float>(0.0f, 0.0f, 256.0f, 240.0f))
         , view()
         , spawnerMarker()
@@ -158,8 +172,9 @@ namespace hikari {
         , isHeroAlive(false)
         , gotoNextState(false)
         , isRestoringEnergy(false)
+        , eventProcessingBudget(EVENT_PROCESSING_BUDGET_MILLIS)
     {
-        loadAllMaps(services.locateService<MapLoader>(hikari::Services::MAPLOADER), params);
+        findAllMaps(params);
 
         bindEventHandlers();
 
@@ -167,6 +182,7 @@ namespace hikari {
         // Create/configure GUI
         //
         buildGui();
+        buildConsole(params);
 
         auto animationCacheWeak = services.locateService<AnimationSetCache>(Services::ANIMATIONSETCACHE);
 
@@ -202,8 +218,6 @@ namespace hikari {
         world.setEnemyFactory(enemyFactoryWeak);
         world.setParticleFactory(particleFactoryWeak);
         world.setProjectileFactory(projectileFactoryWeak);
-
-        srand(static_cast<unsigned int>(time(nullptr)));
     }
 
     GamePlayState::~GamePlayState() {
@@ -383,6 +397,79 @@ namespace hikari {
         }
     }
 
+    void GamePlayState::buildConsole(const Json::Value &params) {
+        const auto & fontConfig = params["gui"]["fonts"]["console"];
+
+        if(!imageCache || !fontConfig.isMember("image")) {
+            HIKARI_LOG(debug) << "No console font configured; the command console is disabled.";
+            return;
+        }
+
+        const int glyphSize = fontConfig.get("glyphSize", 8).asInt();
+
+        auto font = std::make_shared<ImageFont>(
+            imageCache->get(fontConfig["image"].asString()),
+            fontConfig["glyphs"].asString(),
+            glyphSize,
+            glyphSize
+        );
+
+        console.reset(new gui::CommandConsole(font));
+
+        // Start tucked away above the screen; toggling slides it down.
+        console->setPosition(sf::Vector2i(0, -102));
+
+        registerConsoleCommands(*console);
+    }
+
+    bool GamePlayState::isConsoleOpen() const {
+        return console && console->isOpen();
+    }
+
+    bool GamePlayState::handleConsoleEvent(const sf::Event &event) {
+        if(!console) {
+            return false;
+        }
+
+        if((event.type == sf::Event::KeyPressed) && event.key.code == sf::Keyboard::Tilde) {
+            console->toggle();
+            return true;
+        }
+
+        if(!console->isOpen()) {
+            return false;
+        }
+
+        // While the console is open it gets all of the keyboard so that
+        // typing doesn't trigger the debug keys below.
+        if(event.type == sf::Event::TextEntered) {
+            const auto character = event.text.unicode;
+
+            if(character >= 32 && character < 127 && character != '`' && character != '~') {
+                console->setCommandBuffer(console->getCommandBuffer() + static_cast<char>(character));
+            }
+
+            return true;
+        }
+
+        if(event.type == sf::Event::KeyPressed) {
+            if(event.key.code == sf::Keyboard::Return) {
+                console->commitCommand();
+            } else if(event.key.code == sf::Keyboard::BackSpace) {
+                std::string buffer = console->getCommandBuffer();
+
+                if(!buffer.empty()) {
+                    buffer.erase(buffer.size() - 1);
+                    console->setCommandBuffer(buffer);
+                }
+            }
+
+            return true;
+        }
+
+        return false;
+    }
+
     void GamePlayState::updateGui() {
         if(auto gp = gameProgress.lock()) {
             guiHeroEnergyGauge->setValue(
@@ -464,6 +551,10 @@ namespace hikari {
     }
 
     void GamePlayState::handleEvent(sf::Event &event) {
+        if(handleConsoleEvent(event)) {
+            return;
+        }
+
         if((event.type == sf::Event::KeyPressed) && event.key.code == sf::Keyboard::Return) {
             // Menu handlng code use to be here. <--
 
@@ -528,17 +619,25 @@ namespace hikari {
         if(auto gui = guiService.lock()) {
             gui->renderAsTop(guiContainer.get(), target);
         }
+
+        if(console) {
+            console->render(target);
+        }
     }
 
     bool GamePlayState::update(float dt) {
         gotoNextState = false;
 
+        if(console) {
+            console->update(dt);
+        }
+
         guiWeaponMenu->logic();
 
         userInput->update(dt);
 
         if(eventBus) {
-            eventBus->processEvents();
+            eventBus->processEvents(eventProcessingBudget);
         }
 
         if(isRefillingEnergy) {
@@ -582,6 +681,9 @@ namespace hikari {
 
         updateGui();
 
+        // Pick up any z-index changes before the next frame is drawn.
+        world.getRenderQueue().update();
+
         return gotoNextState;
     }
 
@@ -609,7 +711,11 @@ namespace hikari {
 
         if(auto gp = gameProgress.lock()) {
 			// Determine which stage we're on and set that to the current level...
-			if ((currentMap = maps.at(mapList.at(gp->getCurrentBoss() % mapList.size())))) {
+			const std::string & mapFileName = mapOverride.empty()
+				? mapList.at(gp->getCurrentBoss() % mapList.size())
+				: mapOverride;
+
+			if ((currentMap = loadMap(mapFileName))) {
 				currentTileset = currentMap->getTileset();
 			}
 
@@ -639,8 +745,16 @@ namespace hikari {
             guiWeaponMenu->setEnabled(false);
         }
 
+        for(auto it = std::begin(blockSequences), end = std::end(blockSequences); it != end; it++) {
+            world.getRenderQueue().remove((*it).get());
+        }
+
         blockSequences.clear();
 
+        if(console) {
+            console->close();
+        }
+
         collisionResolver->setWorld(nullptr);
     }
 
@@ -720,6 +834,7 @@ namespace hikari {
                     ptr->detachEventListeners(*eventBus.get());
                     ptr->attachEventListeners(*eventBus.get());
                     ptr->setAwake(false);
+                    ptr->prepare(world);
                 }
             }
         );
@@ -731,6 +846,10 @@ namespace hikari {
 
             HIKARI_LOG(debug4) << "Linking " << descriptors.size() << " block sequences.";
 
+            for(auto it = std::begin(blockSequences), end = std::end(blockSequences); it != end; it++) {
+                world.getRenderQueue().remove((*it).get());
+            }
+
             blockSequences.clear();
 
             std::for_each(
@@ -740,6 +859,7 @@ namespace hikari {
                     auto wrapper = std::make_shared<BlockSequence>(descriptor, world);
                     wrapper->setEventBus(eventBus);
                     blockSequences.push_back(wrapper);
+                    world.getRenderQueue().add(wrapper.get(), GameWorld::RENDER_LAYER_BLOCKS);
                 }
             );
         }
@@ -772,6 +892,7 @@ namespace hikari {
                         } else {
                             if(spawner->canSleep()) {
                                 spawner->setAwake(false);
+                                spawner->prepare(world);
                             }
                         }
                     }
@@ -786,7 +907,7 @@ namespace hikari {
         if(bonusTableIndex > -1) { // -1 is a special case where nothing drops, ever.
             if(const auto & gameConfigPtr = gameConfig.lock()) {
                 const auto & chanceTable = gameConfigPtr->getItemChancePairs(bonusTableIndex);
-                int roll = rand() % 100;
+                int roll = random.nextInt(100);
 
                 if(chanceTable.size() > 0) {
                     int lowerBound = 0;
@@ -812,101 +933,114 @@ namespace hikari {
     }
 
     void GamePlayState::spawnDeathExplosion(EntityDeathType::Type type, const Vector2<float> & position) {
+        auto & particles = world.getParticles();
+
         if(type == EntityDeathType::Hero) {
             // This type of explosion shoots in 8 directions. Two explosions per
             // direction; one fast and one slow. It's the death that happens to Rock
             // as well as Robot Masters.
-            std::list<Vector2<float>> velocities;
-            velocities.emplace_back(Vector2<float>(-2.125f,  -2.125f )); // Fast up left
-            velocities.emplace_back(Vector2<float>(0.0f,     -3.0f   )); // Fast up
-            velocities.emplace_back(Vector2<float>(2.125f,   -2.125f )); // Fast up right
-            velocities.emplace_back(Vector2<float>(-3.0f,     0.0f   )); // Fast left
-            velocities.emplace_back(Vector2<float>(-2.125f,   2.125f )); // Fast down left
-            velocities.emplace_back(Vector2<float>(0.0f,      3.0f   )); // Fast down
-            velocities.emplace_back(Vector2<float>(2.125f,    2.125f )); // Fast down right
-            velocities.emplace_back(Vector2<float>(3.0f,      0.0f   )); // Fast right
-            velocities.emplace_back(Vector2<float>(-1.0625f, -1.0625f)); // Slow up left
-            velocities.emplace_back(Vector2<float>(0.0f,     -1.5f   )); // Slow up
-            velocities.emplace_back(Vector2<float>(1.0625f,  -1.0625f)); // Slow up right
-            velocities.emplace_back(Vector2<float>(-1.5f,     0.0f   )); // Slow left
-            velocities.emplace_back(Vector2<float>(-1.0625f,  1.0625f)); // Slow down left
-            velocities.emplace_back(Vector2<float>(0.0f,      1.5f   )); // Slow down
-            velocities.emplace_back(Vector2<float>(1.0625f,   1.0625f)); // Slow down right
-            velocities.emplace_back(Vector2<float>(1.5f,      0.0f   )); // Slow right
-
-            while(!velocities.empty()) {
-                auto vel = velocities.front();
-                velocities.pop_front();
-
-                if(std::shared_ptr<Particle> clone = world.spawnParticle("Medium Explosion (Loop)")) {
-                    clone->setPosition(position);
-                    clone->setVelocity(vel);
-                    clone->setActive(true);
-                    world.queueObjectAddition(clone);
-                }
+            static const Vector2<float> velocities[] = {
+                Vector2<float>(-2.125f,  -2.125f ), // Fast up left
+                Vector2<float>(0.0f,     -3.0f   ), // Fast up
+                Vector2<float>(2.125f,   -2.125f ), // Fast up right
+                Vector2<float>(-3.0f,     0.0f   ), // Fast left
+                Vector2<float>(-2.125f,   2.125f ), // Fast down left
+                Vector2<float>(0.0f,      3.0f   ), // Fast down
+                Vector2<float>(2.125f,    2.125f ), // Fast down right
+                Vector2<float>(3.0f,      0.0f   ), // Fast right
+                Vector2<float>(-1.0625f, -1.0625f), // Slow up left
+                Vector2<float>(0.0f,     -1.5f   ), // Slow up
+                Vector2<float>(1.0625f,  -1.0625f), // Slow up right
+                Vector2<float>(-1.5f,     0.0f   ), // Slow left
+                Vector2<float>(-1.0625f,  1.0625f), // Slow down left
+                Vector2<float>(0.0f,      1.5f   ), // Slow down
+                Vector2<float>(1.0625f,   1.0625f), // Slow down right
+                Vector2<float>(1.5f,      0.0f   )  // Slow right
+            };
+
+            const auto explosion = particles.findTemplate("Medium Explosion (Loop)");
+
+            for(std::size_t i = 0; i < sizeof(velocities) / sizeof(velocities[0]); ++i) {
+                particles.spawn(explosion, position, velocities[i]);
             }
 
             if(auto sound = audioService.lock()) {
                 sound->playSample("Rockman (Death)");
             }
         } else if(type == EntityDeathType::Large) {
-            if(std::shared_ptr<Particle> clone = world.spawnParticle("Large Explosion")) {
-                clone->setPosition(position);
-                clone->setActive(true);
-                world.queueObjectAddition(clone);
-            }
+            particles.spawn(particles.findTemplate("Large Explosion"), position);
         } else if(type == EntityDeathType::Small) {
-            if(std::shared_ptr<Particle> clone = world.spawnParticle("Medium Explosion")) {
-                clone->setPosition(position);
-                clone->setActive(true);
-                world.queueObjectAddition(clone);
+            particles.spawn(particles.findTemplate("Medium Explosion"), position);
+        }
+    }
+
+    void GamePlayState::findAllMaps(const Json::Value &params) {
+        try {
+            std::string stagesDirectory = params["assets"]["stages"].asString();
+
+            bool directoryExists = FileSystem::exists(stagesDirectory);
+            bool directoryIsDirectory = FileSystem::isDirectory(stagesDirectory);
+
+            if(directoryExists && directoryIsDirectory) {
+                // Get file listing and remember all compiled stages as maps; they're loaded on first use.
+                // Stages are still referred to by the name of the JSON they were compiled from.
+                auto fileListing = FileSystem::getFileListing(stagesDirectory);
+                const std::string stageExtension = StageFormat::FILE_EXTENSION;
+
+                HIKARI_LOG(debug3) << "Found " << fileListing.size() << " file(s) in map directory.";
+
+                for(auto index = std::begin(fileListing), end = std::end(fileListing); index != end; index++) {
+                    const std::string & fileName = (*index);
+                    const std::string & filePath = stagesDirectory + "/" + fileName; // TODO: Handle file paths for real
+
+                    if(StringUtils::endsWith(filePath, stageExtension)) {
+                        const std::string jsonName = fileName.substr(0, fileName.size() - stageExtension.size()) + ".json";
+                        mapFiles[jsonName] = filePath;
+                    }
+                }
+            } else {
+                HIKARI_LOG(error) << "Failed to find maps! Specified path doesn't exist or isn't a directory.";
             }
+        } catch(std::exception& ex) {
+            HIKARI_LOG(error) << "Failed to find maps! Reason: " << ex.what();
         }
     }
 
-    void GamePlayState::loadAllMaps(const std::weak_ptr<MapLoader> &mapLoader, const Json::Value &params) {
-        if(auto mapLoaderPtr = mapLoader.lock()) {
-            try {
-                std::string stagesDirectory = params["assets"]["stages"].asString();
+    std::shared_ptr<Map> GamePlayState::loadMap(const std::string & fileName) {
+        const auto loaded = maps.find(fileName);
 
-                bool directoryExists = FileSystem::exists(stagesDirectory);
-                bool directoryIsDirectory = FileSystem::isDirectory(stagesDirectory);
+        if(loaded != std::end(maps)) {
+            return loaded->second;
+        }
 
-                if(directoryExists && directoryIsDirectory) {
-                    // Get file listing and load all .json files as maps
-                    auto fileListing = FileSystem::getFileListing(stagesDirectory);
+        const auto file = mapFiles.find(fileName);
 
-                    HIKARI_LOG(debug3) << "Found " << fileListing.size() << " file(s) in map directory.";
+        if(file == std::end(mapFiles)) {
+            HIKARI_LOG(error) << "Failed to load map \"" << fileName << "\"; no such map was found.";
+            return nullptr;
+        }
 
-                    for(auto index = std::begin(fileListing), end = std::end(fileListing); index != end; index++) {
-                        const std::string & fileName = (*index);
-                        const std::string & filePath = stagesDirectory + "/" + fileName; // TODO: Handle file paths for real
+        if(auto mapLoaderPtr = mapLoader.lock()) {
+            const std::string & filePath = file->second;
 
-                        if(StringUtils::endsWith(filePath, ".json")) {
-                            try {
-                                HIKARI_LOG(debug) << "Loading map from \"" << fileName << "\"...";
+            try {
+                HIKARI_LOG(debug) << "Loading map from \"" << fileName << "\"...";
 
-                                auto mapJsonObject = JsonUtils::loadJson(filePath);
-                                auto map = mapLoaderPtr->loadFromJson(mapJsonObject);
+                auto map = mapLoaderPtr->loadFromFile(filePath);
 
-                                if(map) {
-                                    maps[fileName] = map;
-                                    HIKARI_LOG(debug) << "Successfully loaded map from \"" << fileName << "\".";
-                                } else {
-                                    HIKARI_LOG(error) << "Failed to load map from \"" << filePath << "\".";
-                                }
-                            } catch(std::exception &ex) {
-                                HIKARI_LOG(error) << "Failed to load map from \"" << filePath << "\". Error: " << ex.what();
-                            }
-                        }
-                    }
+                if(map) {
+                    maps[fileName] = map;
+                    HIKARI_LOG(debug) << "Successfully loaded map from \"" << fileName << "\".";
+                    return map;
                 } else {
-                    HIKARI_LOG(error) << "Failed to load maps! Specified path doesn't exist or isn't a directory.";
+                    HIKARI_LOG(error) << "Failed to load map from \"" << filePath << "\".";
                 }
-            } catch(std::exception& ex) {
-                HIKARI_LOG(error) << "Failed to load maps! Reason: " << ex.what();
+            } catch(std::exception &ex) {
+                HIKARI_LOG(error) << "Failed to load map from \"" << filePath << "\". Error: " << ex.what();
             }
         }
+
+        return nullptr;
     }
 
     void GamePlayState::startStage() {
@@ -919,6 +1053,11 @@ namespace hikari {
             int numRooms = currentMap->getRoomCount();
 
             for(int i = 0; i < numRooms; ++i) {
+                // Rooms that haven't been constructed yet still have fresh spawners
+                if(!currentMap->isRoomLoaded(i)) {
+                    continue;
+                }
+
                 auto room = currentMap->getRoom(i);
 
                 HIKARI_LOG(debug4) << "Resetting spawners for room " << i << ".";
@@ -1135,34 +1274,21 @@ namespace hikari {
     }
 
     void GamePlayState::updateParticles(float dt) {
-        const auto & activeParticles = world.getActiveParticles();
-        const auto & cameraView = camera.getView();
-
-        std::for_each(
-            std::begin(activeParticles),
-            std::end(activeParticles),
-            [this, &cameraView, &dt](const std::shared_ptr<Particle> & particle) {
-                particle->update(dt);
-
-                if(!geom::intersects(particle->getBoundingBox(), cameraView)) {
-                    HIKARI_LOG(debug3) << "Cleaning up off-screen particle #" << particle->getId();
-                    particle->setActive(false);
-                }
-
-                if(!particle->isActive()) {
-                    world.queueObjectRemoval(particle);
-                }
-        });
+        world.getParticles().update(dt, camera.getView());
     }
 
     void GamePlayState::updateProjectiles(float dt) {
         //
         // Update projectiles
         //
-        const auto & activeEnemies = world.getActiveEnemies();
         const auto & activeProjectiles = world.getActiveProjectiles();
         const auto & cameraView = camera.getView();
 
+        // Enemies have moved since the last tick so bring the broadphase up
+        // to date before testing projectiles against it.
+        world.updateEnemyIndex();
+        std::vector<Enemy*> nearbyEnemies;
+
         std::for_each(
             std::begin(activeProjectiles),
             std::end(activeProjectiles),
@@ -1177,11 +1303,13 @@ namespace hikari {
 
                 // Check Hero -> Enemy projectiles
                 if(projectile->getFaction() == Factions::Hero) {
-                    // Check for collision with enemies
+                    // Check for collision with enemies that share a grid cell
+                    world.queryEnemies(projectile->getBoundingBox(), nearbyEnemies);
+
                     std::for_each(
-                        std::begin(activeEnemies),
-                        std::end(activeEnemies),
-                        [&](const std::shared_ptr<Enemy> & enemy) {
+                        std::begin(nearbyEnemies),
+                        std::end(nearbyEnemies),
+                        [&](Enemy * enemy) {
                             if(!projectile->isInert() && !enemy->isPhasing()) {
                                 int collisionType = 0;
                                 // Types:
@@ -1343,31 +1471,23 @@ namespace hikari {
         // Render the entities here...
         const auto & activeItems = world.getActiveItems();
 
-        std::for_each(
-            std::begin(activeItems),
-            std::end(activeItems),
-            std::bind(&CollectableItem::render, std::placeholders::_1, ReferenceWrapper<sf::RenderTarget>(target)));
+        for(auto it = std::begin(activeItems), end = std::end(activeItems); it != end; it++) {
+            (*it)->render(target);
+        }
 
         const auto & activeEnemies = world.getActiveEnemies();
 
-        std::for_each(
-            std::begin(activeEnemies),
-            std::end(activeEnemies),
-            std::bind(&Enemy::render, std::placeholders::_1, ReferenceWrapper<sf::RenderTarget>(target)));
-
-        const auto & activeParticles = world.getActiveParticles();
+        for(auto it = std::begin(activeEnemies), end = std::end(activeEnemies); it != end; it++) {
+            (*it)->render(target);
+        }
 
-        std::for_each(
-            std::begin(activeParticles),
-            std::end(activeParticles),
-            std::bind(&Particle::render, std::placeholders::_1, ReferenceWrapper<sf::RenderTarget>(target)));
+        world.getParticles().render(target);
 
         const auto & activeProjectiles = world.getActiveProjectiles();
 
-        std::for_each(
-            std::begin(activeProjectiles),
-            std::end(activeProjectiles),
-            std::bind(&Projectile::render, std::placeholders::_1, ReferenceWrapper<sf::RenderTarget>(target)));
+        for(auto it = std::begin(activeProjectiles), end = std::end(activeProjectiles); it != end; it++) {
+            (*it)->render(target);
+        }
 
         // Restore UI view
         target.setView(oldView);
@@ -1378,9 +1498,9 @@ namespace hikari {
     }
 
     void GamePlayState::renderWorld(sf::RenderTarget &target) const {
+        HIKARI_PROFILE_ZONE("GamePlayState::renderWorld");
         const auto& oldView = target.getDefaultView();
         auto newView = camera.getPixelAlignedView();
-        std::vector<Renderable*> orderedEntities;
 
         target.setView(newView);
         mapRenderer->setRoom(currentRoom);
@@ -1388,72 +1508,36 @@ namespace hikari {
         // Render the map background first
         mapRenderer->renderBackground(target);
 
-        // 1) Partition the list of renderables by "z-index"
-        const auto & activeItems = world.getActiveItems();
+        // The render queue is already sorted by z-index, so everything below 0
+        // is drawn beneath the map's foreground and the rest on top of it.
+        const auto & renderQueue = world.getRenderQueue();
+        const std::size_t foregroundStart = renderQueue.lowerBound(0);
+        const Renderable * heroRenderable = hero.get();
 
-        for(auto it = std::begin(activeItems), end = std::end(activeItems); it != end; it++) {
-            orderedEntities.push_back((*it).get());
-        }
-
-        const auto & activeEnemies = world.getActiveEnemies();
-
-        for(auto it = std::begin(activeEnemies), end = std::end(activeEnemies); it != end; it++) {
-            orderedEntities.push_back((*it).get());
-        }
+        spriteBatch.begin(target);
 
-        for(auto it = std::begin(blockSequences), end = std::end(blockSequences); it != end; it++) {
-            orderedEntities.push_back((*it).get());
-        }
-
-        if(isHeroAlive) {
-            orderedEntities.push_back(hero.get());
-        }
+        for(std::size_t i = 0, count = renderQueue.size(); i < count; ++i) {
+            if(i == foregroundStart) {
+                spriteBatch.flush();
+                mapRenderer->renderForeground(target);
+            }
 
-        const auto & activeParticles = world.getActiveParticles();
+            Renderable * renderable = renderQueue.at(i);
 
-        for(auto it = std::begin(activeParticles), end = std::end(activeParticles); it != end; it++) {
-            orderedEntities.push_back((*it).get());
+            if(renderable != heroRenderable || isHeroAlive) {
+                renderable->render(spriteBatch);
+            }
         }
 
-        const auto & activeProjectiles = world.getActiveProjectiles();
-
-        for(auto it = std::begin(activeProjectiles), end = std::end(activeProjectiles); it != end; it++) {
-            orderedEntities.push_back((*it).get());
+        if(foregroundStart >= renderQueue.size()) {
+            spriteBatch.flush();
+            mapRenderer->renderForeground(target);
         }
 
-        // Sort by z-index, then partition the list so we have two groups:
-        // Group 1) Background sprites
-        // Group 2) Foreground sprites
-
-        std::stable_sort(
-            std::begin(orderedEntities),
-            std::end(orderedEntities),
-            [&](const Renderable* a, const Renderable* b) {
-                return a->getZIndex() < b->getZIndex();
-            });
-
-        auto backgroundSprites = std::stable_partition(
-            std::begin(orderedEntities),
-            std::end(orderedEntities),
-            [&](const Renderable* renderable) -> bool {
-                return renderable->getZIndex() < 0;
-            });
+        spriteBatch.end();
 
-        // These are the background sprites and are rendered on top of the map's
-        // background, but beneath the map's foreground.
-        std::for_each(
-            std::begin(orderedEntities),
-            backgroundSprites,
-            std::bind(&Renderable::render, std::placeholders::_1, ReferenceWrapper<sf::RenderTarget>(target)));
-
-        mapRenderer->renderForeground(target);
-
-        // These are the foreground sprites and are rendered on top of the map's
-        // foreground.
-        std::for_each(
-            backgroundSprites,
-            std::end(orderedEntities),
-            std::bind(&Renderable::render, std::placeholders::_1, ReferenceWrapper<sf::RenderTarget>(target)));
+        // Particles are always drawn on top of everything else in the world.
+        world.getParticles().render(target);
 
         // Restore UI view
         target.setView(oldView);
@@ -1497,32 +1581,13 @@ namespace hikari {
 
             // TODO: Create a system to spawn particles together like this, declaratively.
 
-            if(std::shared_ptr<Particle> clone = world.spawnParticle("Damage Sweat")) {
-                clone->setPosition(Vector2<float>(
-                    hero->getPosition().getX() - 11.0f,
-                    hero->getPosition().getY() - 19.0f
-                ));
-                clone->setActive(true);
-                world.queueObjectAddition(clone);
-            }
+            auto & particles = world.getParticles();
+            const auto sweat = particles.findTemplate("Damage Sweat");
+            const auto & heroPosition = hero->getPosition();
 
-            if(std::shared_ptr<Particle> clone = world.spawnParticle("Damage Sweat")) {
-                clone->setPosition(Vector2<float>(
-                    hero->getPosition().getX(),
-                    hero->getPosition().getY() - 23.0f
-                ));
-                clone->setActive(true);
-                world.queueObjectAddition(clone);
-            }
-
-            if(std::shared_ptr<Particle> clone = world.spawnParticle("Damage Sweat")) {
-                clone->setPosition(Vector2<float>(
-                    hero->getPosition().getX() + 13.0f,
-                    hero->getPosition().getY() - 19.0f
-                ));
-                clone->setActive(true);
-                world.queueObjectAddition(clone);
-            }
+            particles.spawn(sweat, Vector2<float>(heroPosition.getX() - 11.0f, heroPosition.getY() - 19.0f));
+            particles.spawn(sweat, Vector2<float>(heroPosition.getX(), heroPosition.getY() - 23.0f));
+            particles.spawn(sweat, Vector2<float>(heroPosition.getX() + 13.0f, heroPosition.getY() - 19.0f));
         }
     }
 
@@ -1672,14 +1737,12 @@ namespace hikari {
 
         if(eventData->getEntityId() == hero->getId()) {
             if(eventData->getStateName() == "water") {
-                if(std::shared_ptr<Particle> clone = world.spawnParticle("Medium Splash")) {
-                    clone->setPosition(Vector2<float>(
+                world.getParticles().spawn(
+                    world.getParticles().findTemplate("Medium Splash"),
+                    Vector2<float>(
                         hero->getPosition().getX(),
                         static_cast<float>(static_cast<int>(std::floor(hero->getPosition().getY())) / 16) * 16)
-                    );
-                    clone->setActive(true);
-                    world.queueObjectAddition(clone);
-                }
+                );
 
                 if(auto sound = audioService.lock()) {
                     sound->playSample("Splash");
@@ -1695,11 +1758,7 @@ namespace hikari {
                     sound->playSample("Teleport");
                 }
             } else if(eventData->getStateName() == "sliding") {
-                if(std::shared_ptr<Particle> clone = world.spawnParticle("Sliding Dust")) {
-                    clone->setPosition(hero->getPosition());
-                    clone->setActive(true);
-                    world.queueObjectAddition(clone);
-                }
+                world.getParticles().spawn(world.getParticles().findTemplate("Sliding Dust"), hero->getPosition());
             }
         }
     }
@@ -1746,6 +1805,30 @@ namespace hikari {
         );
     }
 
+    void GamePlayState::setUserInput(const std::shared_ptr<Input> & input) {
+        userInput = input;
+
+        if(hero) {
+            hero->setActionController(std::make_shared<PlayerInputHeroActionController>(userInput));
+        }
+    }
+
+    void GamePlayState::setMapOverride(const std::string & mapFileName) {
+        mapOverride = mapFileName;
+    }
+
+    void GamePlayState::setRandomSeed(std::uint32_t seed) {
+        random.seed(seed);
+    }
+
+    void GamePlayState::setEventProcessingBudget(unsigned long maxMillis) {
+        eventProcessingBudget = maxMillis;
+    }
+
+    void GamePlayState::registerConsoleCommands(gui::CommandConsole & console) {
+        gui::registerEventBusCommands(console, "events", eventBus);
+    }
+
     void GamePlayState::fadeOut() {
         if(screenEffectsService) {
             screenEffectsService->fadeOut();
@@ -1866,6 +1949,9 @@ namespace hikari {
             renderer->setCullRegion(Rectangle2D<int>(cameraX, cameraY, cameraWidth, cameraHeight));
         }
 
+        // The screen is still dark, so finish preparing the rooms next to this one now
+        gamePlayState.currentMap->waitForRooms();
+
         // Fade in
         gamePlayState.fadeIn();
     }
@@ -2011,6 +2097,7 @@ namespace hikari {
         , bubbleSpawnLongTimer(LONG_BUBBLE_SPAWN_DURATION)
         , bubbleSpawnShortTimer(SHORT_BUBBLE_SPAWN_DURATION)
         , gotoNextState(false)
+        , nearbyFeatures()
     {
     }
 
@@ -2018,17 +2105,14 @@ namespace hikari {
 
     }
 
-    std::shared_ptr<Particle> GamePlayState::PlayingSubState::spawnSmallBubble() {
-        std::shared_ptr<Particle> clone = gamePlayState.world.spawnParticle("Small Bubble");
-
-        if(clone) {
-            clone->setPosition(gamePlayState.hero->getPosition() + Vector2<float>(0.0f, -8.0f));
-            clone->setVelocity(Vector2<float>(0.0f, -(80.0f/60.0f))); // Moves vertically 80px/s
-            clone->setActive(true);
-            gamePlayState.world.queueObjectAddition(clone);
-        }
+    void GamePlayState::PlayingSubState::spawnSmallBubble() {
+        auto & particles = gamePlayState.world.getParticles();
 
-        return clone;
+        particles.spawn(
+            particles.findTemplate("Small Bubble"),
+            gamePlayState.hero->getPosition() + Vector2<float>(0.0f, -8.0f),
+            Vector2<float>(0.0f, -(80.0f/60.0f)) // Moves vertically 80px/s
+        );
     }
 
     void GamePlayState::PlayingSubState::enter() {
@@ -2064,16 +2148,18 @@ namespace hikari {
     }
 
     GamePlayState::SubState::StateChangeAction GamePlayState::PlayingSubState::update(float dt) {
+        HIKARI_PROFILE_ZONE("PlayingSubState::update");
         auto& camera = gamePlayState.camera;
 
         auto playerPosition = gamePlayState.world.getPlayerPosition();
 
-        Sqrat::RootTable()
-            .SetValue("heroId", gamePlayState.hero->getId())
-            .SetValue("heroX", playerPosition.getX())
-            .SetValue("heroY", playerPosition.getY())
-            .SetValue("heroBottomY", gamePlayState.hero->getBoundingBox().getBottom())
-            .SetValue("isHeroShooting", gamePlayState.hero->isNowShooting());
+        gamePlayState.scriptWorldState->publish(
+            gamePlayState.hero->getId(),
+            playerPosition.getX(),
+            playerPosition.getY(),
+            gamePlayState.hero->getBoundingBox().getBottom(),
+            gamePlayState.hero->isNowShooting()
+        );
 
         gamePlayState.world.update(dt);
 
@@ -2135,14 +2221,33 @@ namespace hikari {
         //
         // Update enemies
         //
+        // This happens in three passes, and the order matters:
+        //
+        //   1. Every enemy moves and animates. Native brains think right away;
+        //      scripted brains only queue themselves on the batch.
+        //   2. The batch runs every queued scripted brain with one call into
+        //      the VM, so each script sees where its enemy moved this tick.
+        //   3. Off-screen cleanup and touch damage run once every brain has
+        //      had its say, so they see where the enemies finally ended up.
+        //
         const auto & activeEnemies = gamePlayState.world.getActiveEnemies();
 
+        auto & behaviorUpdateBatch = gamePlayState.scriptEnv->getBehaviorUpdateBatch();
+        behaviorUpdateBatch.begin();
+
         std::for_each(
             std::begin(activeEnemies),
             std::end(activeEnemies),
-            [this, &camera, &dt](const std::shared_ptr<Enemy> & enemy) {
+            [&dt](const std::shared_ptr<Enemy> & enemy) {
                 enemy->update(dt);
+        });
+
+        behaviorUpdateBatch.dispatch(dt);
 
+        std::for_each(
+            std::begin(activeEnemies),
+            std::end(activeEnemies),
+            [this, &camera](const std::shared_ptr<Enemy> & enemy) {
                 const auto & cameraView = camera.getView();
 
                 if(!geom::intersects(enemy->getBoundingBox(), cameraView)) {
@@ -2221,36 +2326,27 @@ namespace hikari {
             // Update hero
             //
             if(gamePlayState.hero) {
-                // Check to see if there are any ladders to grab on to.
-                auto ladderIndex = std::begin(gamePlayState.currentRoom->getLadders());
-                const auto & ladderEnd = std::end(gamePlayState.currentRoom->getLadders());
+                const auto & room = gamePlayState.currentRoom;
 
-                while(ladderIndex != ladderEnd) {
-                    const BoundingBox<float> & ladder = *ladderIndex;
-
-                    if(gamePlayState.hero->getBoundingBox().intersects(ladder)) {
-                       gamePlayState.hero->requestClimbingAttachment(ladder);
-                    }
+                // Check to see if there are any ladders to grab on to.
+                const auto & ladders = room->getLadders();
+                room->queryLadders(gamePlayState.hero->getBoundingBox(), nearbyFeatures);
 
-                    ladderIndex++;
+                for(auto it = std::begin(nearbyFeatures), end = std::end(nearbyFeatures); it != end; it++) {
+                    gamePlayState.hero->requestClimbingAttachment(ladders[*it]);
                 }
 
                 // Check to see if there are any Forces that need to act on the hero.
                 gamePlayState.hero->setAmbientVelocity(Vector2<float>(0.0f, 0.0f));
 
-                std::for_each(
-                    std::begin(gamePlayState.currentRoom->getForces()),
-                    std::end(gamePlayState.currentRoom->getForces()),
-                    [&](const std::shared_ptr<Force> & force) {
-                        const BoundingBox<float> & bounds = force->getBounds();
-
-                        if(gamePlayState.hero->getBoundingBox().intersects(bounds)) {
-                            gamePlayState.hero->setAmbientVelocity(
-                                gamePlayState.hero->getAmbientVelocity() + force->getVelocity()
-                            );
-                        }
-                    }
-                );
+                const auto & forces = room->getForces();
+                room->queryForces(gamePlayState.hero->getBoundingBox(), nearbyFeatures);
+
+                for(auto it = std::begin(nearbyFeatures), end = std::end(nearbyFeatures); it != end; it++) {
+                    gamePlayState.hero->setAmbientVelocity(
+                        gamePlayState.hero->getAmbientVelocity() + forces[*it]->getVelocity()
+                    );
+                }
 
                 if(auto gp = gamePlayState.gameProgress.lock()) {
                     int currentWeaponEnergy = gp->getWeaponEnergy(gp->getCurrentWeapon());
@@ -2410,21 +2506,13 @@ namespace hikari {
         //
         auto & currentRoom = gamePlayState.currentRoom;
         auto & currentRoomTransitions = currentRoom->getTransitions();
+        auto & currentRoomTransitionBounds = currentRoom->getTransitionBounds();
 
-        for(auto transitionIt = currentRoomTransitions.begin(), end = currentRoomTransitions.end(); transitionIt != end; transitionIt++) {
-            const RoomTransition& transition = *transitionIt;
+        currentRoom->queryTransitions(hero->getBoundingBox(), nearbyFeatures);
 
-            int regionLeft   = ((currentRoom->getX() + transition.getX()) * currentRoom->getGridSize());
-            int regionTop    = ((currentRoom->getY() + transition.getY()) * currentRoom->getGridSize());
-            int regionWidth  = transition.getWidth() * currentRoom->getGridSize();
-            int regionHeight = transition.getHeight() * currentRoom->getGridSize();
-
-            BoundingBox<float> transitionBounds(
-                static_cast<float>(regionLeft),
-                static_cast<float>(regionTop),
-                static_cast<float>(regionWidth),
-                static_cast<float>(regionHeight)
-            );
+        for(auto indexIt = std::begin(nearbyFeatures), end = std::end(nearbyFeatures); indexIt != end; indexIt++) {
+            const RoomTransition& transition = currentRoomTransitions[*indexIt];
+            const BoundingBox<float>& transitionBounds = currentRoomTransitionBounds[*indexIt];
 
             // Boss entrances can be triggered by merely touching, but regular
             // transitions require Rock to be fully contained before triggering.
@@ -2552,7 +2640,7 @@ namespace hikari {
                 exitDoor->open();
 
                 if(gamePlayState.eventBus) {
-                    gamePlayState.eventBus->triggerEvent(EventDataPtr(new DoorEventData(exitDoor)));
+                    gamePlayState.eventBus->triggerEvent(makeEvent<DoorEventData>(exitDoor));
                 }
             } else {
                 HIKARI_LOG(debug4) << "Current room has no exit door";
@@ -2684,7 +2772,7 @@ namespace hikari {
                         entranceDoor->close();
 
                         if(gamePlayState.eventBus) {
-                            gamePlayState.eventBus->triggerEvent(EventDataPtr(new DoorEventData(exitDoor)));
+                            gamePlayState.eventBus->triggerEvent(makeEvent<DoorEventData>(exitDoor));
                         }
                     } else {
                         HIKARI_LOG(debug4) << "Next room has no entrance door";
@@ -2810,25 +2898,15 @@ namespace hikari {
             cameraView.getX() + (cameraView.getWidth() / 2.0f),
             cameraView.getY() + (cameraView.getHeight() / 2.0f));
 
+        auto & particles = world.getParticles();
+        const auto explosion = particles.findTemplate("Medium Explosion (Loop)");
+
         for(std::size_t i = 0, length = energyRingParticleVelocities.size(); i < length; ++i) {
             const auto & velocity = energyRingParticleVelocities[i];
             const auto & position = energyRingParticlePositions[i];
 
-            if(std::shared_ptr<Particle> slowParticle = world.spawnParticle("Medium Explosion (Loop)")) {
-                slowParticle->setPosition(cameraCenter + position);
-                slowParticle->setVelocity(velocity * speed);
-                slowParticle->setActive(true);
-                slowParticle->setMaximumAge(maximumAge);
-                world.queueObjectAddition(slowParticle);
-            }
-
-            if(std::shared_ptr<Particle> fastParticle = world.spawnParticle("Medium Explosion (Loop)")) {
-                fastParticle->setPosition(cameraCenter + position);
-                fastParticle->setVelocity(velocity * speed * 2.0f);
-                fastParticle->setActive(true);
-                fastParticle->setMaximumAge(maximumAge / 2.0f);
-                world.queueObjectAddition(fastParticle);
-            }
+            particles.spawn(explosion, cameraCenter + position, velocity * speed, maximumAge);
+            particles.spawn(explosion, cameraCenter + position, velocity * speed * 2.0f, maximumAge / 2.0f);
         }
     }
 
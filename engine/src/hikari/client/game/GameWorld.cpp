@@ -1,31 +1,95 @@
 #include "hikari/client/game/GameWorld.hpp"
 #include "hikari/client/game/events/EventBus.hpp"
 #include "hikari/client/game/events/ObjectRemovedEventData.hpp"
+#include "hikari/client/game/events/EventPool.hpp"
 #include "hikari/client/game/objects/GameObject.hpp"
 #include "hikari/client/game/objects/CollectableItem.hpp"
 #include "hikari/client/game/objects/Entity.hpp"
 #include "hikari/client/game/objects/Enemy.hpp"
-#include "hikari/client/game/objects/Particle.hpp"
 #include "hikari/client/game/objects/Projectile.hpp"
 #include "hikari/client/game/objects/Hero.hpp"
 #include "hikari/client/game/objects/ItemFactory.hpp"
 #include "hikari/client/game/objects/EnemyFactory.hpp"
 #include "hikari/client/game/objects/ParticleFactory.hpp"
 #include "hikari/client/game/objects/ProjectileFactory.hpp"
+#include "hikari/client/game/objects/Spawner.hpp"
 
 #include "hikari/core/game/map/Room.hpp"
 #include "hikari/core/util/Log.hpp"
 #include "hikari/core/util/exception/HikariException.hpp"
 
+#include <algorithm>
+
 namespace hikari {
 
+    namespace {
+        //
+        // Size (in pixels) of a cell in the enemy broadphase grid. Four tiles
+        // is roughly the size of a large enemy.
+        //
+        const float ENEMY_INDEX_CELL_SIZE = 64.0f;
+
+        //
+        // Obstacles are rehashed once per tick but can move while other
+        // objects are being updated, so they are indexed with some slack.
+        // This needs to be larger than the distance an obstacle can travel
+        // in a single tick.
+        //
+        const float OBSTACLE_INDEX_CELL_SIZE = 64.0f;
+        const float OBSTACLE_INDEX_MARGIN = 16.0f;
+
+        BoundingBox<float> getPaddedBounds(const Entity & entity) {
+            const auto & box = entity.getBoundingBox();
+
+            return BoundingBox<float>(
+                box.getLeft() - OBSTACLE_INDEX_MARGIN,
+                box.getTop() - OBSTACLE_INDEX_MARGIN,
+                box.getWidth() + OBSTACLE_INDEX_MARGIN * 2.0f,
+                box.getHeight() + OBSTACLE_INDEX_MARGIN * 2.0f
+            );
+        }
+
+        //
+        // Computes a box which encloses all of an Enemy's hit boxes. The first
+        // hit box always mirrors the bounding box.
+        //
+        BoundingBox<float> getHitBoxExtents(const Enemy & enemy) {
+            const auto & hitBoxes = enemy.getHitBoxes();
+            const auto & box = enemy.getBoundingBox();
+
+            float left = box.getLeft();
+            float top = box.getTop();
+            float right = box.getRight();
+            float bottom = box.getBottom();
+
+            for(auto it = std::begin(hitBoxes), end = std::end(hitBoxes); it != end; ++it) {
+                const auto & bounds = (*it).bounds;
+
+                left = std::min(left, bounds.getLeft());
+                top = std::min(top, bounds.getTop());
+                right = std::max(right, bounds.getRight());
+                bottom = std::max(bottom, bounds.getBottom());
+            }
+
+            return BoundingBox<float>(left, top, right - left, bottom - top);
+        }
+    }
+
+    GameWorld::RegisteredObject::RegisteredObject()
+        : object()
+        , handle()
+        , obstacleHandle()
+        , removalQueued(false)
+    {
+
+    }
+
     GameWorld::GameWorld()
         : eventBus()
         , player(nullptr)
         , currentRoom(nullptr)
         , itemFactory()
         , enemyFactory()
-        , particleFactory()
         , projectileFactory()
         , queuedAdditions()
         , queuedRemovals()
@@ -36,10 +100,16 @@ namespace hikari {
         , queuedEnemyAdditions()
         , queuedEnemyRemovals()
         , activeEnemies()
-        , queuedParticleAdditions()
-        , queuedParticleRemovals()
-        , activeParticles()
+        , queuedProjectileAdditions()
+        , queuedProjectileRemovals()
+        , activeProjectiles()
+        , particles()
+        , renderQueue()
         , objectRegistry()
+        , spawnOwners()
+        , enemyIndex(ENEMY_INDEX_CELL_SIZE)
+        , obstacleIndex(OBSTACLE_INDEX_CELL_SIZE)
+        , obstacles()
         , gravityEnabled(true)
 
     {
@@ -59,6 +129,11 @@ namespace hikari {
     }
 
     void GameWorld::setCurrentRoom(const std::shared_ptr<Room> & room) {
+        if(currentRoom != room) {
+            // The old room's spawners can't be told about anything anymore
+            spawnOwners.clear();
+        }
+
         currentRoom = room;
     }
 
@@ -75,7 +150,7 @@ namespace hikari {
     }
 
     void GameWorld::setParticleFactory(const std::weak_ptr<ParticleFactory> & particleFactory) {
-        this->particleFactory = particleFactory;
+        particles.setFactory(particleFactory);
     }
 
     void GameWorld::setProjectileFactory(const std::weak_ptr<ProjectileFactory> & projectileFactory) {
@@ -89,6 +164,7 @@ namespace hikari {
     void GameWorld::update(float dt) {
         processRemovals();
         processAdditions();
+        syncObstacleIndex();
     }
 
     void GameWorld::queueObjectAddition(const std::shared_ptr<GameObject> &obj) {
@@ -115,14 +191,6 @@ namespace hikari {
         }
     }
 
-    void GameWorld::queueObjectAddition(const std::shared_ptr<Particle> &obj) {
-        if(obj) {
-            queuedParticleAdditions.push_back(obj);
-        } else {
-            HIKARI_LOG(debug) << "Tried to add a null object (particle); ignoring.";
-        }
-    }
-
     void GameWorld::queueObjectAddition(const std::shared_ptr<Projectile> &obj) {
         if(obj) {
             queuedProjectileAdditions.push_back(obj);
@@ -133,13 +201,7 @@ namespace hikari {
 
     void GameWorld::queueObjectRemoval(const std::shared_ptr<GameObject> &obj) {
         if(obj) {
-            auto finder = std::find(
-                std::begin(queuedRemovals),
-                std::end(queuedRemovals),
-                obj);
-
-            // Avoid double-enqueueing
-            if(finder == std::end(queuedRemovals)) {
+            if(markForRemoval(obj->getId())) {
                 queuedRemovals.push_back(obj);
             }
         } else {
@@ -149,13 +211,7 @@ namespace hikari {
 
     void GameWorld::queueObjectRemoval(const std::shared_ptr<CollectableItem> &obj) {
         if(obj) {
-            auto finder = std::find(
-                std::begin(queuedItemRemovals),
-                std::end(queuedItemRemovals),
-                obj);
-
-            // Avoid double-enqueueing
-            if(finder == std::end(queuedItemRemovals)) {
+            if(markForRemoval(obj->getId())) {
                 queuedItemRemovals.push_back(obj);
             }
         } else {
@@ -165,13 +221,7 @@ namespace hikari {
 
     void GameWorld::queueObjectRemoval(const std::shared_ptr<Enemy> &obj) {
         if(obj) {
-            auto finder = std::find(
-                std::begin(queuedEnemyRemovals),
-                std::end(queuedEnemyRemovals),
-                obj);
-
-            // Avoid double-enqueueing
-            if(finder == std::end(queuedEnemyRemovals)) {
+            if(markForRemoval(obj->getId())) {
                 queuedEnemyRemovals.push_back(obj);
             }
         } else {
@@ -179,31 +229,9 @@ namespace hikari {
         }
     }
 
-    void GameWorld::queueObjectRemoval(const std::shared_ptr<Particle> &obj) {
-        if(obj) {
-            auto finder = std::find(
-                std::begin(queuedParticleRemovals),
-                std::end(queuedParticleRemovals),
-                obj);
-
-            // Avoid double-enqueueing
-            if(finder == std::end(queuedParticleRemovals)) {
-                queuedParticleRemovals.push_back(obj);
-            }
-        } else {
-            HIKARI_LOG(debug) << "Tried to remove a null object (particle); ignoring.";
-        }
-    }
-
     void GameWorld::queueObjectRemoval(const std::shared_ptr<Projectile> &obj) {
         if(obj) {
-            auto finder = std::find(
-                std::begin(queuedProjectileRemovals),
-                std::end(queuedProjectileRemovals),
-                obj);
-
-            // Avoid double-enqueueing
-            if(finder == std::end(queuedProjectileRemovals)) {
+            if(markForRemoval(obj->getId())) {
                 queuedProjectileRemovals.push_back(obj);
             }
         } else {
@@ -211,162 +239,189 @@ namespace hikari {
         }
     }
 
-    void GameWorld::processAdditions() {
-        // Generic objects
-        while(!queuedAdditions.empty()) {
-            auto objectToBeAdded = queuedAdditions.front();
+    bool GameWorld::markForRemoval(int objectId) {
+        auto found = objectRegistry.find(objectId);
 
-            activeObjects.push_back(objectToBeAdded);
-            objectRegistry.emplace(std::make_pair(objectToBeAdded->getId(), objectToBeAdded));
-
-            queuedAdditions.pop_front();
+        if(found == std::end(objectRegistry)) {
+            HIKARI_LOG(debug4) << "Tried to remove an object that isn't in the world, id = " << objectId << "; ignoring.";
+            return false;
         }
 
-        // Collectable Items
-        while(!queuedItemAdditions.empty()) {
-            auto objectToBeAdded = queuedItemAdditions.front();
+        // Avoid double-enqueueing
+        if(found->second.removalQueued) {
+            return false;
+        }
 
-            activeItems.push_back(objectToBeAdded);
-            objectRegistry.emplace(std::make_pair(objectToBeAdded->getId(), objectToBeAdded));
+        found->second.removalQueued = true;
+        return true;
+    }
 
-            objectToBeAdded->setRoom(getCurrentRoom());
-            objectToBeAdded->setEventBus(getEventBus());
+    template <typename T>
+    bool GameWorld::registerObject(const std::shared_ptr<T> & object, SlotMap<std::shared_ptr<T>> & activeSet) {
+        auto inserted = objectRegistry.insert(std::make_pair(object->getId(), RegisteredObject()));
 
-            queuedItemAdditions.pop_front();
+        if(!inserted.second) {
+            HIKARI_LOG(debug) << "Tried to add an object that is already in the world, id = " << object->getId() << "; ignoring.";
+            return false;
         }
 
-        // Enemies
-        while(!queuedEnemyAdditions.empty()) {
-            auto objectToBeAdded = queuedEnemyAdditions.front();
+        RegisteredObject & entry = inserted.first->second;
+        entry.object = object;
+        entry.handle = activeSet.insert(object);
 
-            activeEnemies.push_back(objectToBeAdded);
-            objectRegistry.emplace(std::make_pair(objectToBeAdded->getId(), objectToBeAdded));
+        return true;
+    }
 
-            objectToBeAdded->setRoom(getCurrentRoom());
-            objectToBeAdded->setEventBus(getEventBus());
+    template <typename T>
+    void GameWorld::unregisterObject(int objectId, SlotMap<std::shared_ptr<T>> & activeSet) {
+        auto found = objectRegistry.find(objectId);
 
-            queuedEnemyAdditions.pop_front();
+        if(found != std::end(objectRegistry)) {
+            activeSet.remove(found->second.handle);
+            objectRegistry.erase(found);
         }
+    }
 
-        // Particles
-        while(!queuedParticleAdditions.empty()) {
-            auto objectToBeAdded = queuedParticleAdditions.front();
-
-            activeParticles.push_back(objectToBeAdded);
-            objectRegistry.emplace(std::make_pair(objectToBeAdded->getId(), objectToBeAdded));
+    void GameWorld::processAdditions() {
+        // Generic objects
+        for(std::size_t i = 0; i < queuedAdditions.size(); ++i) {
+            const auto objectToBeAdded = queuedAdditions[i];
 
-            queuedParticleAdditions.pop_front();
+            registerObject(objectToBeAdded, activeObjects);
         }
 
-        // Projectiles
-        while(!queuedProjectileAdditions.empty()) {
-            auto objectToBeAdded = queuedProjectileAdditions.front();
+        queuedAdditions.clear();
 
-            activeProjectiles.push_back(objectToBeAdded);
-            objectRegistry.emplace(std::make_pair(objectToBeAdded->getId(), objectToBeAdded));
+        // Collectable Items
+        for(std::size_t i = 0; i < queuedItemAdditions.size(); ++i) {
+            const auto objectToBeAdded = queuedItemAdditions[i];
 
-            objectToBeAdded->setRoom(getCurrentRoom());
-            objectToBeAdded->setEventBus(getEventBus());
+            if(registerObject(objectToBeAdded, activeItems)) {
+                renderQueue.add(objectToBeAdded.get(), RENDER_LAYER_ITEMS);
 
-            queuedProjectileAdditions.pop_front();
+                objectToBeAdded->setRoom(getCurrentRoom());
+                objectToBeAdded->setEventBus(getEventBus());
+            }
         }
-    }
 
-    void GameWorld::processRemovals() {
-        auto eventBusPtr = eventBus.lock();
+        queuedItemAdditions.clear();
+
+        // Enemies
+        for(std::size_t i = 0; i < queuedEnemyAdditions.size(); ++i) {
+            const auto objectToBeAdded = queuedEnemyAdditions[i];
 
-        while(!queuedRemovals.empty()) {
-            auto objectToBeRemoved = queuedRemovals.front();
+            if(registerObject(objectToBeAdded, activeEnemies)) {
+                renderQueue.add(objectToBeAdded.get(), RENDER_LAYER_ENEMIES);
+                enemyIndex.update(objectToBeAdded.get(), getHitBoxExtents(*objectToBeAdded));
 
-            activeObjects.erase(
-                std::remove(std::begin(activeObjects), std::end(activeObjects), objectToBeRemoved),
-                std::end(activeObjects)
-            );
+                if(objectToBeAdded->isObstacle()) {
+                    addObstacle(objectToBeAdded.get());
+                }
 
-            objectRegistry.erase(objectToBeRemoved->getId());
+                objectToBeAdded->setObstacleStatusCallback([this](Entity & entity) {
+                    handleObstacleStatusChange(entity);
+                });
 
-            queuedRemovals.pop_front();
+                objectToBeAdded->setRoom(getCurrentRoom());
+                objectToBeAdded->setEventBus(getEventBus());
+            }
+        }
 
-            //objectToBeRemoved->setEventBus(std::weak_ptr<EventBus>());
+        queuedEnemyAdditions.clear();
 
-            if(eventBusPtr) {
-                eventBusPtr->queueEvent(std::make_shared<ObjectRemovedEventData>(objectToBeRemoved->getId()));
+        // Projectiles
+        for(std::size_t i = 0; i < queuedProjectileAdditions.size(); ++i) {
+            const auto objectToBeAdded = queuedProjectileAdditions[i];
+
+            if(registerObject(objectToBeAdded, activeProjectiles)) {
+                renderQueue.add(objectToBeAdded.get(), RENDER_LAYER_PROJECTILES);
+
+                objectToBeAdded->setRoom(getCurrentRoom());
+                objectToBeAdded->setEventBus(getEventBus());
             }
         }
 
-        while(!queuedItemRemovals.empty()) {
-            auto objectToBeRemoved = queuedItemRemovals.front();
+        queuedProjectileAdditions.clear();
+    }
 
-            activeItems.erase(
-                std::remove(std::begin(activeItems), std::end(activeItems), objectToBeRemoved),
-                std::end(activeItems)
-            );
+    void GameWorld::processRemovals() {
+        auto eventBusPtr = eventBus.lock();
 
-            objectRegistry.erase(objectToBeRemoved->getId());
+        // Indexed loops; a spawner or factory told about a removal may queue
+        // more of them.
 
-            queuedItemRemovals.pop_front();
+        for(std::size_t i = 0; i < queuedRemovals.size(); ++i) {
+            const auto objectToBeRemoved = queuedRemovals[i];
 
-            objectToBeRemoved->setEventBus(std::weak_ptr<EventBus>());
+            unregisterObject(objectToBeRemoved->getId(), activeObjects);
+
+            //objectToBeRemoved->setEventBus(std::weak_ptr<EventBus>());
+
+            spawnOwners.notifyOwner(objectToBeRemoved->getId());
 
             if(eventBusPtr) {
-                eventBusPtr->queueEvent(std::make_shared<ObjectRemovedEventData>(objectToBeRemoved->getId()));
+                eventBusPtr->queueEvent(makeEvent<ObjectRemovedEventData>(objectToBeRemoved->getId()));
             }
         }
 
-        while(!queuedEnemyRemovals.empty()) {
-            auto objectToBeRemoved = queuedEnemyRemovals.front();
+        queuedRemovals.clear();
 
-            activeEnemies.erase(
-                std::remove(std::begin(activeEnemies), std::end(activeEnemies), objectToBeRemoved),
-                std::end(activeEnemies)
-            );
+        for(std::size_t i = 0; i < queuedItemRemovals.size(); ++i) {
+            const auto objectToBeRemoved = queuedItemRemovals[i];
 
-            objectRegistry.erase(objectToBeRemoved->getId());
-
-            queuedEnemyRemovals.pop_front();
+            unregisterObject(objectToBeRemoved->getId(), activeItems);
+            renderQueue.remove(objectToBeRemoved.get());
 
             objectToBeRemoved->setEventBus(std::weak_ptr<EventBus>());
 
+            spawnOwners.notifyOwner(objectToBeRemoved->getId());
+
             if(eventBusPtr) {
-                eventBusPtr->queueEvent(std::make_shared<ObjectRemovedEventData>(objectToBeRemoved->getId()));
+                eventBusPtr->queueEvent(makeEvent<ObjectRemovedEventData>(objectToBeRemoved->getId()));
             }
         }
 
-        while(!queuedParticleRemovals.empty()) {
-            auto objectToBeRemoved = queuedParticleRemovals.front();
+        queuedItemRemovals.clear();
 
-            activeParticles.erase(
-                std::remove(std::begin(activeParticles), std::end(activeParticles), objectToBeRemoved),
-                std::end(activeParticles)
-            );
+        for(std::size_t i = 0; i < queuedEnemyRemovals.size(); ++i) {
+            const auto objectToBeRemoved = queuedEnemyRemovals[i];
 
-            objectRegistry.erase(objectToBeRemoved->getId());
+            // The obstacle's handle lives in its registry entry, so it has to
+            // go first.
+            removeObstacle(objectToBeRemoved.get());
+            objectToBeRemoved->setObstacleStatusCallback(Entity::ObstacleStatusCallback());
 
-            queuedParticleRemovals.pop_front();
+            unregisterObject(objectToBeRemoved->getId(), activeEnemies);
+            renderQueue.remove(objectToBeRemoved.get());
+            enemyIndex.remove(objectToBeRemoved.get());
+
+            objectToBeRemoved->setEventBus(std::weak_ptr<EventBus>());
+
+            spawnOwners.notifyOwner(objectToBeRemoved->getId());
 
             if(eventBusPtr) {
-                eventBusPtr->queueEvent(std::make_shared<ObjectRemovedEventData>(objectToBeRemoved->getId()));
+                eventBusPtr->queueEvent(makeEvent<ObjectRemovedEventData>(objectToBeRemoved->getId()));
             }
         }
 
-        while(!queuedProjectileRemovals.empty()) {
-            auto objectToBeRemoved = queuedProjectileRemovals.front();
-
-            activeProjectiles.erase(
-                std::remove(std::begin(activeProjectiles), std::end(activeProjectiles), objectToBeRemoved),
-                std::end(activeProjectiles)
-            );
+        queuedEnemyRemovals.clear();
 
-            objectRegistry.erase(objectToBeRemoved->getId());
+        for(std::size_t i = 0; i < queuedProjectileRemovals.size(); ++i) {
+            const auto objectToBeRemoved = queuedProjectileRemovals[i];
 
-            queuedProjectileRemovals.pop_front();
+            unregisterObject(objectToBeRemoved->getId(), activeProjectiles);
+            renderQueue.remove(objectToBeRemoved.get());
 
             objectToBeRemoved->setEventBus(std::weak_ptr<EventBus>());
 
+            spawnOwners.notifyOwner(objectToBeRemoved->getId());
+
             if(eventBusPtr) {
-                eventBusPtr->queueEvent(std::make_shared<ObjectRemovedEventData>(objectToBeRemoved->getId()));
+                eventBusPtr->queueEvent(makeEvent<ObjectRemovedEventData>(objectToBeRemoved->getId()));
             }
         }
+
+        queuedProjectileRemovals.clear();
     }
 
     void GameWorld::removeAllObjects() {
@@ -388,14 +443,6 @@ namespace hikari {
                 this->queueObjectRemoval(enemy);
             });
 
-        // Particles
-        std::for_each(
-            std::begin(activeParticles),
-            std::end(activeParticles),
-            [this](const std::shared_ptr<Particle> particle) {
-                this->queueObjectRemoval(particle);
-            });
-
         // Projectiles
         std::for_each(
             std::begin(activeProjectiles),
@@ -405,6 +452,12 @@ namespace hikari {
             });
 
         processRemovals();
+
+        // Objects which were never added to the world don't go through
+        // processRemovals, so their owners would otherwise stick around.
+        spawnOwners.clear();
+
+        particles.clear();
     }
 
     std::shared_ptr<CollectableItem> GameWorld::spawnCollectableItem(const std::string & name /* CollectableItemInstanceConfig instanceConfig */) const {
@@ -419,7 +472,7 @@ namespace hikari {
         return std::shared_ptr<CollectableItem>(nullptr);
     }
 
-    std::unique_ptr<Enemy> GameWorld::spawnEnemy(const std::string & name /* EnemyInstanceConfig instanceConfig */) const {
+    std::shared_ptr<Enemy> GameWorld::spawnEnemy(const std::string & name /* EnemyInstanceConfig instanceConfig */) const {
         if(auto enemyFactoryPtr = enemyFactory.lock()) {
             try {
                 return enemyFactoryPtr->create(name);
@@ -428,22 +481,20 @@ namespace hikari {
             }
         }
 
-        return std::unique_ptr<Enemy>(nullptr);
+        return std::shared_ptr<Enemy>(nullptr);
     }
 
-    std::unique_ptr<Particle> GameWorld::spawnParticle(const std::string & name) const {
-        if(auto particleFactoryPtr = particleFactory.lock()) {
-            try {
-                return particleFactoryPtr->create(name);
-            } catch(HikariException & ex) {
-                HIKARI_LOG(debug) << ex.what();
-            }
+    void GameWorld::prewarmEnemies(const std::string & name, std::size_t count) const {
+        if(auto enemyFactoryPtr = enemyFactory.lock()) {
+            enemyFactoryPtr->prewarm(name, count);
         }
+    }
 
-        return std::unique_ptr<Particle>(nullptr);
+    void GameWorld::setSpawnOwner(int objectId, const std::weak_ptr<Spawner> & spawner) {
+        spawnOwners.setOwner(objectId, spawner);
     }
 
-    std::unique_ptr<Projectile> GameWorld::spawnProjectile(const std::string & name) const {
+    std::shared_ptr<Projectile> GameWorld::spawnProjectile(const std::string & name) const {
         if(auto projectileFactoryPtr = projectileFactory.lock()) {
             try {
                 return projectileFactoryPtr->create(name);
@@ -452,54 +503,136 @@ namespace hikari {
             }
         }
 
-        return std::unique_ptr<Projectile>(nullptr);
+        return std::shared_ptr<Projectile>(nullptr);
     }
 
     const std::weak_ptr<GameObject> GameWorld::getObjectById(int id) const {
         auto finder = objectRegistry.find(id);
 
         if(finder != std::end(objectRegistry)) {
-            return std::weak_ptr<GameObject>(finder->second);
+            return std::weak_ptr<GameObject>(finder->second.object);
         }
 
         return std::weak_ptr<GameObject>();
     }
 
     const std::vector<std::shared_ptr<CollectableItem>> & GameWorld::getActiveItems() const {
-        return activeItems;
+        return activeItems.getValues();
     }
 
     const std::vector<std::shared_ptr<Enemy>> & GameWorld::getActiveEnemies() const {
-        return activeEnemies;
+        return activeEnemies.getValues();
     }
 
-    const std::vector<std::shared_ptr<Particle>> & GameWorld::getActiveParticles() const {
-        return activeParticles;
+    const std::vector<std::shared_ptr<Projectile>> & GameWorld::getActiveProjectiles() const {
+        return activeProjectiles.getValues();
     }
 
-    const std::vector<std::shared_ptr<Projectile>> & GameWorld::getActiveProjectiles() const {
-        return activeProjectiles;
+    ParticleSystem & GameWorld::getParticles() {
+        return particles;
+    }
+
+    const ParticleSystem & GameWorld::getParticles() const {
+        return particles;
     }
 
-    std::vector<std::shared_ptr<Entity>> GameWorld::getObstacles() const {
-        std::vector<std::shared_ptr<Entity>> result;
+    void GameWorld::addObstacle(Entity * obstacle) {
+        auto found = objectRegistry.find(obstacle->getId());
 
-        std::for_each(
-            std::begin(getActiveEnemies()),
-            std::end(getActiveEnemies()),
-            [&](const std::shared_ptr<Enemy> & enemy) {
-                if(enemy->isObstacle()) {
-                    result.push_back(enemy);
+        if(found == std::end(objectRegistry)) {
+            return;
+        }
+
+        RegisteredObject & entry = found->second;
+
+        if(!obstacles.contains(entry.obstacleHandle)) {
+            entry.obstacleHandle = obstacles.insert(obstacle);
+        }
+
+        obstacleIndex.update(obstacle, getPaddedBounds(*obstacle));
+    }
+
+    void GameWorld::removeObstacle(Entity * obstacle) {
+        auto found = objectRegistry.find(obstacle->getId());
+
+        if(found == std::end(objectRegistry)) {
+            return;
+        }
+
+        RegisteredObject & entry = found->second;
+
+        if(obstacles.remove(entry.obstacleHandle)) {
+            obstacleIndex.remove(obstacle);
+        }
+
+        entry.obstacleHandle = SlotHandle();
+    }
+
+    void GameWorld::syncObstacleIndex() {
+        for(auto it = std::begin(obstacles), end = std::end(obstacles); it != end; ++it) {
+            obstacleIndex.update(*it, getPaddedBounds(**it));
+        }
+    }
+
+    void GameWorld::handleObstacleStatusChange(Entity & entity) {
+        if(entity.isObstacle()) {
+            addObstacle(&entity);
+        } else {
+            removeObstacle(&entity);
+        }
+    }
+
+    void GameWorld::queryObstacles(const BoundingBox<float> & bounds, std::vector<Entity*> & results) {
+        obstacleIndex.query(bounds, results);
+
+        if(results.size() > 1) {
+            std::sort(
+                std::begin(results),
+                std::end(results),
+                [](const Entity * a, const Entity * b) {
+                    return a->getId() < b->getId();
                 }
-            }
-        );
+            );
+        }
+    }
 
-        return result;
+    void GameWorld::updateEnemyIndex() {
+        for(auto it = std::begin(activeEnemies), end = std::end(activeEnemies); it != end; ++it) {
+            Enemy * enemy = (*it).get();
+            enemyIndex.update(enemy, getHitBoxExtents(*enemy));
+        }
     }
 
+    void GameWorld::queryEnemies(const BoundingBox<float> & bounds, std::vector<Enemy*> & results) const {
+        enemyIndex.query(bounds, results);
+
+        std::sort(
+            std::begin(results),
+            std::end(results),
+            [](const Enemy * a, const Enemy * b) {
+                return a->getId() < b->getId();
+            }
+        );
+    }
 
     void GameWorld::setPlayer(const std::shared_ptr<Hero>& player) {
+        if(this->player) {
+            renderQueue.remove(this->player.get());
+        }
+
         this->player = player;
+
+        if(player) {
+            renderQueue.add(player.get(), RENDER_LAYER_HERO);
+        }
+    }
+
+    RenderQueue & GameWorld::getRenderQueue() {
+        return renderQueue;
+    }
+
+    const RenderQueue & GameWorld::getRenderQueue() const {
+        return renderQueue;
     }
 
     const Vector2<float> GameWorld::getPlayerPosition() const {
@@ -0,0 +1,66 @@
+#include "hikari/client/game/InputRecorder.hpp"
+
+namespace hikari {
+
+    namespace {
+
+        const Input::Button ALL_BUTTONS[] = {
+            Input::BUTTON_UP,
+            Input::BUTTON_RIGHT,
+            Input::BUTTON_DOWN,
+            Input::BUTTON_LEFT,
+            Input::BUTTON_SHOOT,
+            Input::BUTTON_JUMP,
+            Input::BUTTON_START,
+            Input::BUTTON_SELECT,
+            Input::BUTTON_CANCEL
+        };
+
+    }
+
+    InputRecorder::InputRecorder(const std::shared_ptr<Input> & input, std::uint32_t randomSeed, float speedMultiplier)
+        : input(input)
+        , recording(randomSeed, speedMultiplier)
+    {
+
+    }
+
+    const bool InputRecorder::isUp(const Button &button) const {
+        return input->isUp(button);
+    }
+
+    const bool InputRecorder::isDown(const Button &button) const {
+        return input->isDown(button);
+    }
+
+    const bool InputRecorder::isHeld(const Button &button) const {
+        return input->isHeld(button);
+    }
+
+    const bool InputRecorder::wasPressed(const Button &button) const {
+        return input->wasPressed(button);
+    }
+
+    const bool InputRecorder::wasReleased(const Button &button) const {
+        return input->wasReleased(button);
+    }
+
+    void InputRecorder::update(float dt) {
+        input->update(dt);
+
+        Button buttons = Input::BUTTON_NONE;
+
+        for(std::size_t i = 0; i < sizeof(ALL_BUTTONS) / sizeof(ALL_BUTTONS[0]); ++i) {
+            if(input->isDown(ALL_BUTTONS[i])) {
+                buttons |= ALL_BUTTONS[i];
+            }
+        }
+
+        recording.addTick(buttons);
+    }
+
+    const InputRecording & InputRecorder::getRecording() const {
+        return recording;
+    }
+
+} // hikari
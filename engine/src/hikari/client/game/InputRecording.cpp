@@ -0,0 +1,201 @@
+#include "hikari/client/game/InputRecording.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <utility>
+
+namespace hikari {
+
+    namespace {
+
+        void writeByte(std::ostream & output, std::uint8_t value) {
+            output.put(static_cast<char>(value));
+        }
+
+        void writeUint16(std::ostream & output, std::uint16_t value) {
+            writeByte(output, static_cast<std::uint8_t>(value & 0xFF));
+            writeByte(output, static_cast<std::uint8_t>((value >> 8) & 0xFF));
+        }
+
+        void writeUint32(std::ostream & output, std::uint32_t value) {
+            writeUint16(output, static_cast<std::uint16_t>(value & 0xFFFF));
+            writeUint16(output, static_cast<std::uint16_t>((value >> 16) & 0xFFFF));
+        }
+
+        void writeFloat(std::ostream & output, float value) {
+            std::uint32_t bits = 0;
+            std::memcpy(&bits, &value, sizeof(bits));
+            writeUint32(output, bits);
+        }
+
+        bool readByte(std::istream & input, std::uint8_t & value) {
+            char byte = 0;
+
+            if(!input.get(byte)) {
+                return false;
+            }
+
+            value = static_cast<std::uint8_t>(byte);
+            return true;
+        }
+
+        bool readUint16(std::istream & input, std::uint16_t & value) {
+            std::uint8_t low = 0;
+            std::uint8_t high = 0;
+
+            if(!readByte(input, low) || !readByte(input, high)) {
+                return false;
+            }
+
+            value = static_cast<std::uint16_t>(low | (high << 8));
+            return true;
+        }
+
+        bool readUint32(std::istream & input, std::uint32_t & value) {
+            std::uint16_t low = 0;
+            std::uint16_t high = 0;
+
+            if(!readUint16(input, low) || !readUint16(input, high)) {
+                return false;
+            }
+
+            value = static_cast<std::uint32_t>(low) | (static_cast<std::uint32_t>(high) << 16);
+            return true;
+        }
+
+        bool readFloat(std::istream & input, float & value) {
+            std::uint32_t bits = 0;
+
+            if(!readUint32(input, bits)) {
+                return false;
+            }
+
+            std::memcpy(&value, &bits, sizeof(value));
+            return true;
+        }
+
+    }
+
+    const char InputRecording::MAGIC[4] = { 'H', 'K', 'I', 'R' };
+    const std::uint8_t InputRecording::VERSION = 2;
+
+    InputRecording::InputRecording(std::uint32_t randomSeed, float speedMultiplier)
+        : randomSeed(randomSeed)
+        , speedMultiplier(speedMultiplier)
+        , ticks()
+    {
+
+    }
+
+    std::uint32_t InputRecording::getRandomSeed() const {
+        return randomSeed;
+    }
+
+    void InputRecording::setRandomSeed(std::uint32_t seed) {
+        randomSeed = seed;
+    }
+
+    float InputRecording::getSpeedMultiplier() const {
+        return speedMultiplier;
+    }
+
+    void InputRecording::setSpeedMultiplier(float multiplier) {
+        speedMultiplier = multiplier;
+    }
+
+    void InputRecording::addTick(Input::Button buttons) {
+        ticks.push_back(static_cast<std::uint16_t>(buttons));
+    }
+
+    Input::Button InputRecording::getTick(std::size_t tick) const {
+        if(tick < ticks.size()) {
+            return static_cast<Input::Button>(ticks[tick]);
+        }
+
+        return Input::BUTTON_NONE;
+    }
+
+    std::size_t InputRecording::getTickCount() const {
+        return ticks.size();
+    }
+
+    void InputRecording::clear() {
+        ticks.clear();
+    }
+
+    void InputRecording::write(std::ostream & output) const {
+        typedef std::pair<std::uint16_t, std::uint16_t> Run;
+
+        const std::uint16_t maxRunLength = std::numeric_limits<std::uint16_t>::max();
+        std::vector<Run> runs;
+
+        for(auto it = std::begin(ticks); it != std::end(ticks); ++it) {
+            if(!runs.empty() && runs.back().first == *it && runs.back().second < maxRunLength) {
+                runs.back().second += 1;
+            } else {
+                runs.push_back(Run(*it, 1));
+            }
+        }
+
+        output.write(MAGIC, sizeof(MAGIC));
+        writeByte(output, VERSION);
+        writeUint32(output, randomSeed);
+        writeFloat(output, speedMultiplier);
+        writeUint32(output, static_cast<std::uint32_t>(ticks.size()));
+        writeUint32(output, static_cast<std::uint32_t>(runs.size()));
+
+        for(auto it = std::begin(runs); it != std::end(runs); ++it) {
+            writeUint16(output, it->first);
+            writeUint16(output, it->second);
+        }
+    }
+
+    bool InputRecording::read(std::istream & input) {
+        ticks.clear();
+
+        char magic[sizeof(MAGIC)];
+        std::uint8_t version = 0;
+        std::uint32_t seed = 0;
+        float speed = 1.0f;
+        std::uint32_t tickCount = 0;
+        std::uint32_t runCount = 0;
+
+        if(!input.read(magic, sizeof(magic))
+                || !std::equal(magic, magic + sizeof(magic), MAGIC)
+                || !readByte(input, version)
+                || version < 1
+                || version > VERSION
+                || !readUint32(input, seed)
+                || (version >= 2 && !readFloat(input, speed))
+                || !readUint32(input, tickCount)
+                || !readUint32(input, runCount)) {
+            return false;
+        }
+
+        for(std::uint32_t i = 0; i < runCount; ++i) {
+            std::uint16_t buttons = 0;
+            std::uint16_t length = 0;
+
+            if(!readUint16(input, buttons) || !readUint16(input, length)) {
+                ticks.clear();
+                return false;
+            }
+
+            ticks.insert(std::end(ticks), length, buttons);
+        }
+
+        if(ticks.size() != tickCount) {
+            ticks.clear();
+            return false;
+        }
+
+        randomSeed = seed;
+        speedMultiplier = speed;
+
+        return true;
+    }
+
+} // hikari
@@ -0,0 +1,220 @@
+#include "hikari/client/game/ParticleBuffer.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+namespace hikari {
+
+    const ParticleBuffer::TemplateId ParticleBuffer::INVALID_TEMPLATE = -1;
+
+    ParticleBuffer::ParticleBuffer()
+        : templates()
+        , templateIds()
+        , textures()
+        , templateId()
+        , positionX()
+        , positionY()
+        , velocityX()
+        , velocityY()
+        , age()
+        , maximumAge()
+        , frameTime()
+        , frame()
+    {
+
+    }
+
+    ParticleBuffer::TemplateId ParticleBuffer::findTemplate(const std::string & name) const {
+        auto found = templateIds.find(name);
+
+        if(found != std::end(templateIds)) {
+            return found->second;
+        }
+
+        return INVALID_TEMPLATE;
+    }
+
+    ParticleBuffer::TemplateId ParticleBuffer::addTemplate(const std::string & name, const ParticleTemplate & description) {
+        Template entry;
+        entry.description = description;
+
+        auto texture = std::find(std::begin(textures), std::end(textures), description.texture);
+        entry.textureIndex = static_cast<std::size_t>(std::distance(std::begin(textures), texture));
+
+        if(texture == std::end(textures)) {
+            textures.push_back(description.texture);
+        }
+
+        const TemplateId id = static_cast<TemplateId>(templates.size());
+
+        templates.push_back(entry);
+        templateIds[name] = id;
+
+        return id;
+    }
+
+    bool ParticleBuffer::spawn(TemplateId id, const Vector2<float> & position, const Vector2<float> & velocity, float maximumAge) {
+        if(id < 0 || static_cast<std::size_t>(id) >= templates.size()) {
+            return false;
+        }
+
+        templateId.push_back(id);
+        positionX.push_back(position.getX());
+        positionY.push_back(position.getY());
+        velocityX.push_back(velocity.getX());
+        velocityY.push_back(velocity.getY());
+        age.push_back(0.0f);
+        this->maximumAge.push_back(maximumAge);
+        frameTime.push_back(0.0f);
+        frame.push_back(Animation::ANIMATION_BEGINNING_FRAME_INDEX);
+
+        return true;
+    }
+
+    float ParticleBuffer::getMaximumAge(TemplateId id) const {
+        if(id < 0 || static_cast<std::size_t>(id) >= templates.size()) {
+            return 0.0f;
+        }
+
+        return templates[id].description.maximumAge;
+    }
+
+    void ParticleBuffer::kill(std::size_t index) {
+        const std::size_t last = templateId.size() - 1;
+
+        // Order doesn't matter, so the last particle fills the gap.
+        if(index != last) {
+            templateId[index] = templateId[last];
+            positionX[index] = positionX[last];
+            positionY[index] = positionY[last];
+            velocityX[index] = velocityX[last];
+            velocityY[index] = velocityY[last];
+            age[index] = age[last];
+            maximumAge[index] = maximumAge[last];
+            frameTime[index] = frameTime[last];
+            frame[index] = frame[last];
+        }
+
+        templateId.pop_back();
+        positionX.pop_back();
+        positionY.pop_back();
+        velocityX.pop_back();
+        velocityY.pop_back();
+        age.pop_back();
+        maximumAge.pop_back();
+        frameTime.pop_back();
+        frame.pop_back();
+    }
+
+    void ParticleBuffer::advanceFrame(std::size_t index, float dt) {
+        const Animation * animation = templates[templateId[index]].description.animation.get();
+
+        if(!animation || animation->getNumberOfFrames() == 0) {
+            return;
+        }
+
+        const unsigned int frameCount = animation->getNumberOfFrames();
+        unsigned int currentFrame = frame[index];
+        float elapsed = frameTime[index] + dt;
+        float frameDuration = animation->getFrameAt(currentFrame).getDisplayTime();
+
+        // Same rules as Animator: repeating animations loop back to their
+        // keyframe, others hold their last frame.
+        while(frameDuration > 0.0f && elapsed >= frameDuration) {
+            elapsed -= frameDuration;
+            currentFrame += 1;
+
+            if(currentFrame >= frameCount) {
+                if(animation->doesRepeat()) {
+                    currentFrame = animation->getKeyframeIndex();
+                } else {
+                    currentFrame = frameCount - 1;
+                    elapsed = 0.0f;
+                    break;
+                }
+            }
+
+            frameDuration = animation->getFrameAt(currentFrame).getDisplayTime();
+        }
+
+        frame[index] = currentFrame;
+        frameTime[index] = elapsed;
+    }
+
+    void ParticleBuffer::update(float dt, const Rectangle2D<float> & view) {
+        const std::size_t count = templateId.size();
+
+        // Velocities are in pixels per tick, as they always have been.
+        for(std::size_t i = 0; i < count; ++i) {
+            positionX[i] += velocityX[i];
+            positionY[i] += velocityY[i];
+            age[i] += dt;
+        }
+
+        for(std::size_t i = 0; i < count; ++i) {
+            advanceFrame(i, dt);
+        }
+
+        const float viewLeft = view.getLeft();
+        const float viewTop = view.getTop();
+        const float viewRight = view.getRight();
+        const float viewBottom = view.getBottom();
+
+        for(std::size_t i = 0; i < templateId.size(); ) {
+            const BoundingBox<float> & box = templates[templateId[i]].description.boundingBox;
+            const float left = positionX[i] - box.getOrigin().getX();
+            const float top = positionY[i] - box.getOrigin().getY();
+
+            const bool expired = maximumAge[i] > 0.0f && age[i] >= maximumAge[i];
+            const bool offscreen = left > viewRight || left + box.getWidth() < viewLeft
+                || top > viewBottom || top + box.getHeight() < viewTop;
+
+            if(expired || offscreen) {
+                kill(i);
+            } else {
+                ++i;
+            }
+        }
+    }
+
+    void ParticleBuffer::clear() {
+        templateId.clear();
+        positionX.clear();
+        positionY.clear();
+        velocityX.clear();
+        velocityY.clear();
+        age.clear();
+        maximumAge.clear();
+        frameTime.clear();
+        frame.clear();
+    }
+
+    void ParticleBuffer::reserve(std::size_t count) {
+        templateId.reserve(count);
+        positionX.reserve(count);
+        positionY.reserve(count);
+        velocityX.reserve(count);
+        velocityY.reserve(count);
+        age.reserve(count);
+        maximumAge.reserve(count);
+        frameTime.reserve(count);
+        frame.reserve(count);
+    }
+
+    std::size_t ParticleBuffer::size() const {
+        return templateId.size();
+    }
+
+    Vector2<float> ParticleBuffer::getPosition(std::size_t index) const {
+        return Vector2<float>(positionX.at(index), positionY.at(index));
+    }
+
+    std::size_t ParticleBuffer::getTextureCount() const {
+        return textures.size();
+    }
+
+    const std::shared_ptr<sf::Texture> & ParticleBuffer::getTexture(std::size_t textureIndex) const {
+        return textures.at(textureIndex);
+    }
+
+} // hikari
@@ -0,0 +1,117 @@
+#include "hikari/client/game/ParticleSystem.hpp"
+#include "hikari/client/game/objects/ParticleFactory.hpp"
+#include "hikari/core/util/Log.hpp"
+
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+namespace hikari {
+
+    namespace {
+        /**
+         * Appends each particle's quad to the vertex array of its texture.
+         */
+        struct BatchBuilder {
+            std::vector<sf::VertexArray> & batches;
+
+            explicit BatchBuilder(std::vector<sf::VertexArray> & batches)
+                : batches(batches)
+            {
+            }
+
+            void operator()(std::size_t textureIndex, float left, float top, float width, float height, float u, float v) {
+                sf::VertexArray & batch = batches[textureIndex];
+
+                batch.append(sf::Vertex(sf::Vector2f(left, top), sf::Vector2f(u, v)));
+                batch.append(sf::Vertex(sf::Vector2f(left + width, top), sf::Vector2f(u + width, v)));
+                batch.append(sf::Vertex(sf::Vector2f(left + width, top + height), sf::Vector2f(u + width, v + height)));
+                batch.append(sf::Vertex(sf::Vector2f(left, top + height), sf::Vector2f(u, v + height)));
+            }
+        };
+    }
+
+    const ParticleSystem::TemplateId ParticleSystem::INVALID_TEMPLATE = ParticleBuffer::INVALID_TEMPLATE;
+
+    ParticleSystem::ParticleSystem()
+        : factory()
+        , particles()
+        , batches()
+    {
+
+    }
+
+    void ParticleSystem::setFactory(const std::weak_ptr<ParticleFactory> & factory) {
+        this->factory = factory;
+    }
+
+    ParticleSystem::TemplateId ParticleSystem::findTemplate(const std::string & name) {
+        const TemplateId found = particles.findTemplate(name);
+
+        if(found != INVALID_TEMPLATE) {
+            return found;
+        }
+
+        if(auto factoryPtr = factory.lock()) {
+            if(const ParticleTemplate * description = factoryPtr->findTemplate(name)) {
+                return addTemplate(name, *description);
+            }
+        }
+
+        HIKARI_LOG(debug) << "No particle template named \"" << name << "\".";
+
+        return INVALID_TEMPLATE;
+    }
+
+    ParticleSystem::TemplateId ParticleSystem::addTemplate(const std::string & name, const ParticleTemplate & description) {
+        const TemplateId id = particles.addTemplate(name, description);
+
+        while(batches.size() < particles.getTextureCount()) {
+            batches.push_back(sf::VertexArray(sf::Quads));
+        }
+
+        return id;
+    }
+
+    bool ParticleSystem::spawn(TemplateId id, const Vector2<float> & position, const Vector2<float> & velocity) {
+        return particles.spawn(id, position, velocity, particles.getMaximumAge(id));
+    }
+
+    bool ParticleSystem::spawn(TemplateId id, const Vector2<float> & position, const Vector2<float> & velocity, float maximumAge) {
+        return particles.spawn(id, position, velocity, maximumAge);
+    }
+
+    void ParticleSystem::update(float dt, const Rectangle2D<float> & view) {
+        particles.update(dt, view);
+    }
+
+    void ParticleSystem::render(sf::RenderTarget & target) const {
+        for(auto it = std::begin(batches), end = std::end(batches); it != end; ++it) {
+            it->clear();
+        }
+
+        BatchBuilder builder(batches);
+        particles.visitQuads(builder);
+
+        for(std::size_t i = 0; i < batches.size(); ++i) {
+            const auto & texture = particles.getTexture(i);
+
+            if(batches[i].getVertexCount() > 0 && texture) {
+                target.draw(batches[i], sf::RenderStates(texture.get()));
+            }
+        }
+    }
+
+    void ParticleSystem::clear() {
+        particles.clear();
+    }
+
+    void ParticleSystem::reserve(std::size_t count) {
+        particles.reserve(count);
+    }
+
+    std::size_t ParticleSystem::size() const {
+        return particles.size();
+    }
+
+} // hikari
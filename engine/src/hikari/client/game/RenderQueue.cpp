@@ -0,0 +1,112 @@
+#include "hikari/client/game/RenderQueue.hpp"
+#include "hikari/core/game/Renderable.hpp"
+
+#include <algorithm>
+
+namespace hikari {
+
+    RenderQueue::RenderQueue()
+        : entries()
+        , nextSequence(0)
+    {
+
+    }
+
+    bool RenderQueue::isDrawnBefore(const Entry & a, const Entry & b) {
+        if(a.zIndex != b.zIndex) {
+            return a.zIndex < b.zIndex;
+        }
+
+        if(a.layer != b.layer) {
+            return a.layer < b.layer;
+        }
+
+        return a.sequence < b.sequence;
+    }
+
+    void RenderQueue::add(Renderable * renderable, int layer) {
+        if(!renderable) {
+            return;
+        }
+
+        Entry entry;
+        entry.renderable = renderable;
+        entry.zIndex = renderable->getZIndex();
+        entry.layer = layer;
+        entry.sequence = nextSequence++;
+
+        // The new entry has the highest sequence, so it goes after everything
+        // it would otherwise tie with.
+        entries.insert(
+            std::upper_bound(std::begin(entries), std::end(entries), entry, &RenderQueue::isDrawnBefore),
+            entry
+        );
+    }
+
+    bool RenderQueue::remove(const Renderable * renderable) {
+        auto found = std::find_if(std::begin(entries), std::end(entries), [renderable](const Entry & entry) {
+            return entry.renderable == renderable;
+        });
+
+        if(found != std::end(entries)) {
+            entries.erase(found);
+            return true;
+        }
+
+        return false;
+    }
+
+    bool RenderQueue::contains(const Renderable * renderable) const {
+        return std::any_of(std::begin(entries), std::end(entries), [renderable](const Entry & entry) {
+            return entry.renderable == renderable;
+        });
+    }
+
+    void RenderQueue::clear() {
+        entries.clear();
+    }
+
+    void RenderQueue::update() {
+        for(auto it = std::begin(entries), end = std::end(entries); it != end; ++it) {
+            it->zIndex = it->renderable->getZIndex();
+        }
+
+        // Insertion sort: linear when nothing changed, and stable.
+        for(std::size_t i = 1; i < entries.size(); ++i) {
+            if(!isDrawnBefore(entries[i], entries[i - 1])) {
+                continue;
+            }
+
+            const Entry entry = entries[i];
+            std::size_t j = i;
+
+            while(j > 0 && isDrawnBefore(entry, entries[j - 1])) {
+                entries[j] = entries[j - 1];
+                --j;
+            }
+
+            entries[j] = entry;
+        }
+    }
+
+    std::size_t RenderQueue::size() const {
+        return entries.size();
+    }
+
+    bool RenderQueue::empty() const {
+        return entries.empty();
+    }
+
+    Renderable * RenderQueue::at(std::size_t index) const {
+        return entries.at(index).renderable;
+    }
+
+    std::size_t RenderQueue::lowerBound(int zIndex) const {
+        auto found = std::partition_point(std::begin(entries), std::end(entries), [zIndex](const Entry & entry) {
+            return entry.zIndex < zIndex;
+        });
+
+        return static_cast<std::size_t>(found - std::begin(entries));
+    }
+
+} // hikari
@@ -0,0 +1,48 @@
+#include "hikari/client/game/ReplayInput.hpp"
+
+namespace hikari {
+
+    ReplayInput::ReplayInput(const InputRecording & recording)
+        : recording(recording)
+        , tick(0)
+        , currentButtons(Input::BUTTON_NONE)
+        , previousButtons(Input::BUTTON_NONE)
+    {
+
+    }
+
+    const bool ReplayInput::isUp(const Button &button) const {
+        return !isDown(button);
+    }
+
+    const bool ReplayInput::isDown(const Button &button) const {
+        return (currentButtons & button) != 0;
+    }
+
+    const bool ReplayInput::isHeld(const Button &button) const {
+        return (currentButtons & previousButtons & button) != 0;
+    }
+
+    const bool ReplayInput::wasPressed(const Button &button) const {
+        return (currentButtons & ~previousButtons & button) != 0;
+    }
+
+    const bool ReplayInput::wasReleased(const Button &button) const {
+        return (~currentButtons & previousButtons & button) != 0;
+    }
+
+    void ReplayInput::update(float dt) {
+        previousButtons = currentButtons;
+        currentButtons = recording.getTick(tick);
+        ++tick;
+    }
+
+    const InputRecording & ReplayInput::getRecording() const {
+        return recording;
+    }
+
+    bool ReplayInput::isFinished() const {
+        return tick >= recording.getTickCount();
+    }
+
+} // hikari
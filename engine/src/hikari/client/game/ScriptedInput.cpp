@@ -0,0 +1,114 @@
+#include "hikari/client/game/ScriptedInput.hpp"
+#include "hikari/core/util/Log.hpp"
+
+#include <json/value.h>
+
+#include <algorithm>
+
+namespace hikari {
+
+    Input::Button ScriptedInput::parseButton(const std::string & name) {
+        if(name == "up") {
+            return Input::BUTTON_UP;
+        } else if(name == "right") {
+            return Input::BUTTON_RIGHT;
+        } else if(name == "down") {
+            return Input::BUTTON_DOWN;
+        } else if(name == "left") {
+            return Input::BUTTON_LEFT;
+        } else if(name == "shoot") {
+            return Input::BUTTON_SHOOT;
+        } else if(name == "jump") {
+            return Input::BUTTON_JUMP;
+        } else if(name == "start") {
+            return Input::BUTTON_START;
+        } else if(name == "select") {
+            return Input::BUTTON_SELECT;
+        } else if(name == "cancel") {
+            return Input::BUTTON_CANCEL;
+        }
+
+        return Input::BUTTON_NONE;
+    }
+
+    ScriptedInput::ScriptedInput(const Json::Value & script)
+        : steps()
+        , nextStep(0)
+        , frame(0)
+        , currentButtons(Input::BUTTON_NONE)
+        , previousButtons(Input::BUTTON_NONE)
+    {
+        const Json::Value & stepsJson = script["steps"];
+
+        for(unsigned int i = 0, length = stepsJson.size(); i < length; ++i) {
+            const Json::Value & stepJson = stepsJson[i];
+            const Json::Value & buttonsJson = stepJson["buttons"];
+
+            Step step;
+            step.frame = stepJson.get("frame", 0).asUInt();
+            step.buttons = Input::BUTTON_NONE;
+
+            for(unsigned int j = 0, buttonCount = buttonsJson.size(); j < buttonCount; ++j) {
+                const std::string buttonName = buttonsJson[j].asString();
+                const Button button = parseButton(buttonName);
+
+                if(button == Input::BUTTON_NONE) {
+                    HIKARI_LOG(warning) << "Ignoring unknown button \"" << buttonName << "\" in input script.";
+                }
+
+                step.buttons |= button;
+            }
+
+            steps.push_back(step);
+        }
+
+        // Later steps win when two of them are for the same frame.
+        std::stable_sort(std::begin(steps), std::end(steps), [](const Step & a, const Step & b) {
+            return a.frame < b.frame;
+        });
+
+        applySteps();
+    }
+
+    void ScriptedInput::applySteps() {
+        while(nextStep < steps.size() && steps[nextStep].frame <= frame) {
+            currentButtons = steps[nextStep].buttons;
+            ++nextStep;
+        }
+    }
+
+    const bool ScriptedInput::isUp(const Button &button) const {
+        return !isDown(button);
+    }
+
+    const bool ScriptedInput::isDown(const Button &button) const {
+        return (currentButtons & button) != 0;
+    }
+
+    const bool ScriptedInput::isHeld(const Button &button) const {
+        return (currentButtons & previousButtons & button) != 0;
+    }
+
+    const bool ScriptedInput::wasPressed(const Button &button) const {
+        return (currentButtons & ~previousButtons & button) != 0;
+    }
+
+    const bool ScriptedInput::wasReleased(const Button &button) const {
+        return (~currentButtons & previousButtons & button) != 0;
+    }
+
+    void ScriptedInput::update(float dt) {
+        previousButtons = currentButtons;
+        ++frame;
+        applySteps();
+    }
+
+    unsigned int ScriptedInput::getFrame() const {
+        return frame;
+    }
+
+    bool ScriptedInput::isFinished() const {
+        return nextStep >= steps.size();
+    }
+
+} // hikari
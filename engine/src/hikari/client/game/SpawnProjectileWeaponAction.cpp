@@ -41,10 +41,8 @@ namespace hikari {
                 projectile->setMotion(motion);
             }
 
-            std::shared_ptr<Projectile> projectilePtr(std::move(projectile));
-
-            world.queueObjectAddition(projectilePtr);
-            trackedProjectile = std::weak_ptr<GameObject>(projectilePtr);
+            world.queueObjectAddition(projectile);
+            trackedProjectile = std::weak_ptr<GameObject>(projectile);
         }
 
         // Return an empty pointer
@@ -0,0 +1,107 @@
+#include "hikari/client/game/SpriteBatch.hpp"
+
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <cmath>
+
+namespace hikari {
+
+    SpriteBatch::SpriteBatch()
+        : target(nullptr)
+        , vertices()
+        , texture(nullptr)
+        , shader(nullptr)
+        , drawCallCount(0)
+        , spriteCount(0)
+    {
+
+    }
+
+    void SpriteBatch::begin(sf::RenderTarget & target) {
+        this->target = &target;
+        vertices.clear();
+        texture = nullptr;
+        shader = nullptr;
+        drawCallCount = 0;
+        spriteCount = 0;
+    }
+
+    void SpriteBatch::draw(const sf::Sprite & sprite) {
+        append(sprite, nullptr, sprite.getColor());
+    }
+
+    void SpriteBatch::draw(const sf::Sprite & sprite, sf::Shader & shader, const sf::Color & color) {
+        append(sprite, &shader, color);
+    }
+
+    void SpriteBatch::append(const sf::Sprite & sprite, sf::Shader * spriteShader, const sf::Color & color) {
+        const sf::Texture * spriteTexture = sprite.getTexture();
+
+        // sf::Sprite doesn't draw anything without a texture either.
+        if(!target || !spriteTexture) {
+            return;
+        }
+
+        if(spriteTexture != texture || spriteShader != shader) {
+            flush();
+            texture = spriteTexture;
+            shader = spriteShader;
+        }
+
+        // The same quad sf::Sprite builds, moved into world space up front.
+        const sf::IntRect & rect = sprite.getTextureRect();
+        const sf::Transform & transform = sprite.getTransform();
+
+        const float width = static_cast<float>(std::abs(rect.width));
+        const float height = static_cast<float>(std::abs(rect.height));
+        const float left = static_cast<float>(rect.left);
+        const float top = static_cast<float>(rect.top);
+        const float right = left + static_cast<float>(rect.width);
+        const float bottom = top + static_cast<float>(rect.height);
+
+        vertices.push_back(sf::Vertex(transform.transformPoint(sf::Vector2f(0.0f, 0.0f)), color, sf::Vector2f(left, top)));
+        vertices.push_back(sf::Vertex(transform.transformPoint(sf::Vector2f(width, 0.0f)), color, sf::Vector2f(right, top)));
+        vertices.push_back(sf::Vertex(transform.transformPoint(sf::Vector2f(width, height)), color, sf::Vector2f(right, bottom)));
+        vertices.push_back(sf::Vertex(transform.transformPoint(sf::Vector2f(0.0f, height)), color, sf::Vector2f(left, bottom)));
+
+        ++spriteCount;
+    }
+
+    void SpriteBatch::flush() {
+        if(!target || vertices.empty()) {
+            return;
+        }
+
+        sf::RenderStates states(texture);
+        states.shader = shader;
+
+        target->draw(&vertices[0], static_cast<unsigned int>(vertices.size()), sf::Quads, states);
+        vertices.clear();
+
+        ++drawCallCount;
+    }
+
+    void SpriteBatch::end() {
+        flush();
+        target = nullptr;
+        texture = nullptr;
+        shader = nullptr;
+    }
+
+    sf::RenderTarget * SpriteBatch::getTarget() const {
+        return target;
+    }
+
+    unsigned int SpriteBatch::getDrawCallCount() const {
+        return drawCallCount;
+    }
+
+    unsigned int SpriteBatch::getSpriteCount() const {
+        return spriteCount;
+    }
+
+} // hikari
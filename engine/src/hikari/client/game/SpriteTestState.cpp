@@ -23,7 +23,7 @@ namespace hikari {
                     auto animationSet = anims->get("assets/animations/particles.json");
                     animation = animationSet->get("medium-explosion");
 
-                    spriteTexture = images->get(animationSet->getImageFileName());
+                    spriteTexture = animationSet->getTexture();
                 }
             }
             
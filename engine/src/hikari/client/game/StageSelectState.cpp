@@ -27,6 +27,7 @@
 #include <guichan/widgets/label.hpp>
 #include <guichan/widgets/icon.hpp>
 #include <guichan/hakase/labelex.hpp>
+#include <guichan/sfml/sfmlimage.hpp>
 
 namespace hikari {
 
@@ -64,6 +65,8 @@ namespace hikari {
         , guiBackground()
         , guiLeftEye()
         , guiRightEye()
+        , cursorImage()
+        , portraitImage()
         , guiCursor()
         , cursorAnimations()
         , portraitAnimations()
@@ -194,18 +197,24 @@ namespace hikari {
         guiLeftEye.reset(new gui::Icon("assets/images/eye-stage-select.png"));
         guiRightEye.reset(new gui::Icon("assets/images/eye-stage-select.png"));
 
+        // Animation sets may live on a shared atlas page, so the icons draw
+        // from the set's own texture rather than reloading its image file.
         if(cursorAnimations) {
-            guiCursor.first.reset(new gui::Icon(cursorAnimations->getImageFileName()));
+            cursorImage.reset(new gcn::SFMLImage(cursorAnimations->getTexture().get(), false));
+            guiCursor.first.reset(new gui::Icon(cursorImage.get()));
             guiCursor.second.reset(new gui::IconAnimator(*guiCursor.first.get()));
             guiCursor.second->setAnimation(cursorAnimations->get("default"));
+            guiCursor.second->update(0.0f);
         }
 
         if(portraitAnimations) {
+            portraitImage.reset(new gcn::SFMLImage(portraitAnimations->getTexture().get(), false));
+
             for(unsigned int i = 0; i < NUM_OF_PORTRAITS; ++i) {
                 const auto & position = cursorPositions.at(i);
 
                 AnimatedIcon portraitIcon;
-                portraitIcon.first.reset(new gui::Icon(portraitAnimations->getImageFileName()));
+                portraitIcon.first.reset(new gui::Icon(portraitImage.get()));
                 portraitIcon.first->setPosition(
                     static_cast<int>(position.getX() + 8),
                     static_cast<int>(position.getY() + 8)
@@ -214,6 +223,7 @@ namespace hikari {
 
                 // TODO: Look up the correct portrait from the JSON.
                 portraitIcon.second->setAnimation(portraitAnimations->get("default"));
+                portraitIcon.second->update(0.0f);
 
                 portraits.push_back(std::move(portraitIcon));
             }
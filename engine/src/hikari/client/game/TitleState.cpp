@@ -2,6 +2,7 @@
 #include "hikari/client/game/InputService.hpp"
 #include "hikari/client/game/EventBusService.hpp"
 #include "hikari/client/game/events/GameQuitEventData.hpp"
+#include "hikari/client/game/events/EventPool.hpp"
 #include "hikari/client/audio/AudioService.hpp"
 #include "hikari/client/gui/GuiService.hpp"
 #include "hikari/client/gui/Menu.hpp"
@@ -81,7 +82,7 @@ namespace hikari {
                         goToNextState = true;
                     } else if(menuItemName == ITEM_QUIT) {
                         if(auto events = globalEventBus.lock()) {
-                            events->triggerEvent(EventDataPtr(new GameQuitEventData(GameQuitEventData::QUIT_NOW)));
+                            events->triggerEvent(makeEvent<GameQuitEventData>(GameQuitEventData::QUIT_NOW));
                         }
                     }
                 } else {
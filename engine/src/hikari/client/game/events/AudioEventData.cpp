@@ -1,9 +1,9 @@
 #include "hikari/client/game/events/AudioEventData.hpp"
-#include "hikari/core/util/HashedString.hpp"
+#include "hikari/client/game/events/EventPool.hpp"
 
 namespace hikari {
 
-    const EventType AudioEventData::Type = HashedString("AudioEventData").getHash();
+    HIKARI_DEFINE_EVENT_TYPE(AudioEventData);
     const char * AudioEventData::NO_NAME = "";
 
     AudioEventData::AudioEventData(AudioAction action, const std::string & name)
@@ -31,7 +31,7 @@ namespace hikari {
     }
 
     EventDataPtr AudioEventData::copy() const {
-        return EventDataPtr(new AudioEventData(getAudioAction(), getName()));
+        return makeEvent<AudioEventData>(getAudioAction(), getName());
     }
 
     const char * AudioEventData::getName() const {
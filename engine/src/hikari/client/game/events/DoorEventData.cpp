@@ -1,9 +1,9 @@
 #include "hikari/client/game/events/DoorEventData.hpp"
-#include "hikari/core/util/HashedString.hpp"
+#include "hikari/client/game/events/EventPool.hpp"
 
 namespace hikari {
 
-    const EventType DoorEventData::Type = HashedString("DoorEventData").getHash();
+    HIKARI_DEFINE_EVENT_TYPE(DoorEventData);
 
     DoorEventData::DoorEventData(const std::weak_ptr<Door> & door)
         : BaseEventData(0.0f)
@@ -25,7 +25,7 @@ namespace hikari {
     }
 
     EventDataPtr DoorEventData::copy() const {
-        return EventDataPtr(new DoorEventData(getDoor()));
+        return makeEvent<DoorEventData>(getDoor());
     }
 
     const char * DoorEventData::getName() const {
@@ -1,9 +1,9 @@
 #include "hikari/client/game/events/EntityDamageEventData.hpp"
-#include "hikari/core/util/HashedString.hpp"
+#include "hikari/client/game/events/EventPool.hpp"
 
 namespace hikari {
 
-    const EventType EntityDamageEventData::Type = HashedString("EntityDamageEventData").getHash();
+    HIKARI_DEFINE_EVENT_TYPE(EntityDamageEventData);
 
     EntityDamageEventData::EntityDamageEventData(int entityId, float amount)
         : BaseEventData(0.0f)
@@ -30,7 +30,7 @@ namespace hikari {
     }
 
     EventDataPtr EntityDamageEventData::copy() const {
-        return EventDataPtr(new EntityDamageEventData(getEntityId(), getAmount()));
+        return makeEvent<EntityDamageEventData>(getEntityId(), getAmount());
     }
 
     const char * EntityDamageEventData::getName() const {
@@ -1,9 +1,9 @@
 #include "hikari/client/game/events/EntityDeathEventData.hpp"
-#include "hikari/core/util/HashedString.hpp"
+#include "hikari/client/game/events/EventPool.hpp"
 
 namespace hikari {
 
-    const EventType EntityDeathEventData::Type = HashedString("EntityDeathEventData").getHash(); // was 0xdeadb33f;
+    HIKARI_DEFINE_EVENT_TYPE(EntityDeathEventData);
 
     EntityDeathEventData::EntityDeathEventData(int entityId, EntityType entityType)
         : BaseEventData(0.0f)
@@ -30,7 +30,7 @@ namespace hikari {
     }
 
     EventDataPtr EntityDeathEventData::copy() const {
-        return EventDataPtr(new EntityDeathEventData(getEntityId()));
+        return makeEvent<EntityDeathEventData>(getEntityId());
     }
 
     const char * EntityDeathEventData::getName() const {
@@ -1,9 +1,9 @@
 #include "hikari/client/game/events/EntityStateChangeEventData.hpp"
-#include "hikari/core/util/HashedString.hpp"
+#include "hikari/client/game/events/EventPool.hpp"
 
 namespace hikari {
 
-    const EventType EntityStateChangeEventData::Type = HashedString("EntityStateChangeEventData").getHash(); // was 0xd11f5747;
+    HIKARI_DEFINE_EVENT_TYPE(EntityStateChangeEventData);
 
     EntityStateChangeEventData::EntityStateChangeEventData(int entityId, const std::string & stateName)
         : BaseEventData(0.0f)
@@ -30,7 +30,7 @@ namespace hikari {
     }
 
     EventDataPtr EntityStateChangeEventData::copy() const {
-        return EventDataPtr(new EntityStateChangeEventData(getEntityId(), getStateName()));
+        return makeEvent<EntityStateChangeEventData>(getEntityId(), getStateName());
     }
 
     const char * EntityStateChangeEventData::getName() const {
@@ -1,15 +1,65 @@
 #include "hikari/client/game/events/EventBusImpl.hpp"
 #include "hikari/client/game/events/EventData.hpp"
 #include "hikari/core/util/Log.hpp"
+#include "hikari/core/util/Profiler.hpp"
+#include "hikari/core/util/StringHash.hpp"
 
+#include <algorithm>
 #include <iterator>
 
 namespace hikari {
 
+    namespace {
+
+        /**
+         * Keeps the dispatch depth balanced even if a listener throws.
+         */
+        class DispatchScope {
+        private:
+            unsigned int & depth;
+
+        public:
+            explicit DispatchScope(unsigned int & depth)
+                : depth(depth)
+            {
+                ++depth;
+            }
+
+            ~DispatchScope() {
+                --depth;
+            }
+        };
+
+    }
+
+    EventBusImpl::EventTypeStatistics::EventTypeStatistics()
+        : type(0)
+        , name()
+        , count(0)
+        , totalNanoseconds(0)
+        , maxNanoseconds(0)
+    {
+
+    }
+
+    EventBusImpl::Listener::Listener(const EventListenerDelegate & delegate)
+        : delegate(delegate)
+        , active(true)
+    {
+
+    }
+
     EventBusImpl::EventBusImpl(const std::string & name, bool setAsGlobal)
         : EventBus(name, setAsGlobal)
+        , eventListeners()
+        , pendingListeners()
+        , dispatchDepth(0)
+        , hasInactiveListeners(false)
+        , statistics()
+        , eventQueue()
+        , processingCount(0)
     {
-        activeQueueIndex = 0;
+
     }
 
     EventBusImpl::~EventBusImpl() {
@@ -21,149 +71,237 @@ namespace hikari {
         EventListenerList & eventListenerList = eventListeners[type];
 
         for(auto it = std::begin(eventListenerList); it != std::end(eventListenerList); ++it) {
-            if(eventDelegate == (*it)) {
+            if(it->active && eventDelegate == it->delegate) {
+                HIKARI_LOG(error) << "Attempting to double-register a delegate for " << findHashedString(type) << ".";
+                return false;
+            }
+        }
+
+        for(auto it = std::begin(pendingListeners); it != std::end(pendingListeners); ++it) {
+            if(it->first == type && eventDelegate == it->second) {
                 HIKARI_LOG(error) << "Attempting to double-register a delegate.";
                 return false;
             }
         }
 
-        eventListenerList.push_back(eventDelegate);
+        // Growing a list that is being iterated over would move the delegate
+        // that's currently executing, so wait until dispatching is done.
+        if(dispatchDepth > 0) {
+            pendingListeners.push_back(std::make_pair(type, eventDelegate));
+        } else {
+            eventListenerList.push_back(Listener(eventDelegate));
+        }
 
         return true;
     }
 
     bool EventBusImpl::removeListener(const EventListenerDelegate & eventDelegate, const EventType & type) {
-        bool success = false;
-
         auto findIt = eventListeners.find(type);
 
-        if(findIt != std::end(eventListeners)) {
+        if(findIt == std::end(eventListeners)) {
+            return false;
+        }
 
-            EventListenerList & listeners = findIt->second;
+        EventListenerList & listeners = findIt->second;
 
-            for(auto it = std::begin(listeners); it != std::end(listeners); ++it) {
-                if(eventDelegate == (*it)) {
+        for(auto it = std::begin(listeners); it != std::end(listeners); ++it) {
+            if(it->active && eventDelegate == it->delegate) {
+                if(dispatchDepth > 0) {
+                    it->active = false;
+                    hasInactiveListeners = true;
+                } else {
                     listeners.erase(it);
-                    success = true;
-                    break;
                 }
+
+                return true;
             }
         }
 
-        return success;
+        for(auto it = std::begin(pendingListeners); it != std::end(pendingListeners); ++it) {
+            if(it->first == type && eventDelegate == it->second) {
+                pendingListeners.erase(it);
+                return true;
+            }
+        }
+
+        return false;
     }
-    
-    bool EventBusImpl::triggerEvent(const EventDataPtr & event) const {
-        bool processed = false;
 
+    bool EventBusImpl::dispatch(const EventDataPtr & event, Clock::time_point & finishedAt) const {
+        const Clock::time_point start = Clock::now();
         auto findIt = eventListeners.find(event->getEventType());
 
-        if(findIt != std::end(eventListeners)) {
-            const EventListenerList & eventListenerList = findIt->second;
+        if(findIt == std::end(eventListeners)) {
+            finishedAt = start;
+            return false;
+        }
+
+        bool processed = false;
+
+        {
+            DispatchScope scope(dispatchDepth);
 
-            for(auto it = eventListenerList.cbegin(); it != eventListenerList.cend(); ++it) {
-                auto listener = (*it);
+            // Listeners added from here on are pending, so the list can't
+            // grow; index instead of iterating to be safe anyway.
+            const EventListenerList & listeners = findIt->second;
+            const std::size_t listenerCount = listeners.size();
 
-                listener(event);
+            for(std::size_t i = 0; i < listenerCount; ++i) {
+                const Listener & listener = listeners[i];
 
-                processed = true;
+                if(listener.active) {
+                    listener.delegate(event);
+                    processed = true;
+                }
             }
         }
 
+        finishedAt = Clock::now();
+        recordDispatch(*event, finishedAt - start);
+
+        if(dispatchDepth == 0) {
+            flushListenerChanges();
+        }
+
         return processed;
     }
-    
+
+    void EventBusImpl::recordDispatch(const EventData & event, Clock::duration elapsed) const {
+        EventTypeStatistics & entry = statistics[event.getEventType()];
+
+        if(entry.count == 0) {
+            entry.type = event.getEventType();
+            entry.name = event.getName();
+
+            // Event types register their names where they are defined; this
+            // catches any that don't, so debug logs can still name them.
+            rememberHashedString(entry.name);
+        }
+
+        const std::uint64_t nanoseconds = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()
+        );
+
+        entry.count += 1;
+        entry.totalNanoseconds += nanoseconds;
+
+        if(nanoseconds > entry.maxNanoseconds) {
+            entry.maxNanoseconds = nanoseconds;
+        }
+    }
+
+    void EventBusImpl::flushListenerChanges() const {
+        if(hasInactiveListeners) {
+            for(auto it = std::begin(eventListeners); it != std::end(eventListeners); ++it) {
+                EventListenerList & listeners = it->second;
+
+                listeners.erase(
+                    std::remove_if(std::begin(listeners), std::end(listeners), [](const Listener & listener) {
+                        return !listener.active;
+                    }),
+                    std::end(listeners)
+                );
+            }
+
+            hasInactiveListeners = false;
+        }
+
+        if(!pendingListeners.empty()) {
+            for(auto it = std::begin(pendingListeners); it != std::end(pendingListeners); ++it) {
+                eventListeners[it->first].push_back(Listener(it->second));
+            }
+
+            pendingListeners.clear();
+        }
+    }
+
+    bool EventBusImpl::triggerEvent(const EventDataPtr & event) const {
+        Clock::time_point finishedAt;
+        return dispatch(event, finishedAt);
+    }
+
     bool EventBusImpl::queueEvent(const EventDataPtr & event) {
-        // ASSERT activeQueueIndex >= 0
-        // ASSERT activeQueueIndex < 2
-        
         auto findIt = eventListeners.find(event->getEventType());
 
         if(findIt != std::end(eventListeners)) {
-            eventQueues[activeQueueIndex].push_back(event);
+            eventQueue.push_back(event);
             return true;
         }
 
         return false;
     }
-    
+
     bool EventBusImpl::cancelEvent(const EventType & type, bool allOfType) {
-        // ASSERT activeQueueIndex >= 0
-        // ASSERT activeQueueIndex < 2
-        
         bool success = false;
 
-        auto findIt = eventListeners.find(type);
-
-        if(findIt != std::end(eventListeners)) {
-            EventQueue & eventQueue = eventQueues[activeQueueIndex];
+        // Events which are already being processed can't be cancelled.
+        std::size_t index = processingCount;
 
-            auto it = std::begin(eventQueue);
+        while(index < eventQueue.size()) {
+            if(eventQueue[index]->getEventType() == type) {
+                eventQueue.erase(index);
+                success = true;
 
-            while(it != std::end(eventQueue)) {
-                // Keep next iterator since erasing will invalidate the current iterator
-                auto thisIt = it;
-                ++it;
-
-                if((*thisIt)->getEventType() == type) {
-                    eventQueue.erase(thisIt);
-                    success = true;
-
-                    if(!allOfType) {
-                        break;
-                    }
+                if(!allOfType) {
+                    break;
                 }
+            } else {
+                ++index;
             }
         }
 
         return success;
     }
-    
-    bool EventBusImpl::processEvents(unsigned long maxMillis) {
-        int queueToProcessIndex = activeQueueIndex;
 
-        // Swap active queue and clear the new queue
-        activeQueueIndex = (activeQueueIndex + 1) % 2;
-        eventQueues[activeQueueIndex].clear();
+    bool EventBusImpl::processEvents(unsigned long maxMillis) {
+        HIKARI_PROFILE_ZONE("EventBusImpl::processEvents");
+        const bool hasBudget = maxMillis != INFINITE;
+        const Clock::time_point deadline = Clock::now() + std::chrono::milliseconds(hasBudget ? maxMillis : 0);
 
-        // Process queued events
-        while(!eventQueues[queueToProcessIndex].empty()) {
-            EventDataPtr event = eventQueues[queueToProcessIndex].front();
-            eventQueues[queueToProcessIndex].pop_front();
+        // Only process the events that are queued right now; anything queued
+        // by a listener waits until the next call.
+        processingCount = eventQueue.size();
 
-            const EventType & eventType = event->getEventType();
+        Clock::time_point now;
 
-            // Find all delegate functions for this event
-            auto findIt = eventListeners.find(eventType);
+        while(processingCount > 0) {
+            EventDataPtr event(std::move(eventQueue.front()));
+            eventQueue.pop_front();
+            --processingCount;
 
-            if(findIt != std::end(eventListeners)) {
-                const EventListenerList & listeners = findIt->second;
+            dispatch(event, now);
 
-                // Call each listener
-                for(auto it = std::begin(listeners); it != std::end(listeners); ++it) {
-                    EventListenerDelegate listener = (*it);
-                    listener(event);
-                }
+            // At least one event is processed per call so that the queue
+            // always drains eventually, however slow its listeners are.
+            if(hasBudget && processingCount > 0 && now >= deadline) {
+                break;
             }
-
-            // TODO: Add elapsed processing time here so we can bail out if
-            // event processing is taking too much time in one frame.
         }
 
-        // If we couldn't process all events this frame, put them in the other
-        // queue so they'll get processed next frame.
-        bool queueFlushed = eventQueues[queueToProcessIndex].empty();
+        // Whatever is left is still at the front of the queue, so it will be
+        // processed first (and in order) next time.
+        const bool queueFlushed = processingCount == 0;
 
         if(!queueFlushed) {
-            while(!eventQueues[queueToProcessIndex].empty()) {
-                auto event = eventQueues[queueToProcessIndex].back();
-                eventQueues[queueToProcessIndex].pop_back();
-                eventQueues[activeQueueIndex].push_front(event);
-            }
+            HIKARI_LOG(debug2) << "Event processing ran out of time; carrying over "
+                << processingCount << " event(s).";
         }
 
+        processingCount = 0;
+
         return queueFlushed;
     }
-    
 
-} // hikari
\ No newline at end of file
+    std::size_t EventBusImpl::getQueuedEventCount() const {
+        return eventQueue.size();
+    }
+
+    const EventBusImpl::StatisticsMap & EventBusImpl::getStatistics() const {
+        return statistics;
+    }
+
+    void EventBusImpl::resetStatistics() {
+        statistics.clear();
+    }
+
+} // hikari
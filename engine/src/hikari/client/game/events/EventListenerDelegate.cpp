@@ -12,7 +12,7 @@ namespace hikari {
 
     }
 
-    void FunctionDelegateBase::operator()(EventDataPtr eventPtr) {
+    void FunctionDelegateBase::operator()(const EventDataPtr & eventPtr) const {
         if(fn) {
             fn(eventPtr);
         }
@@ -1,9 +1,9 @@
 #include "hikari/client/game/events/GameQuitEventData.hpp"
-#include "hikari/core/util/HashedString.hpp"
+#include "hikari/client/game/events/EventPool.hpp"
 
 namespace hikari {
 
-    const EventType GameQuitEventData::Type = HashedString("GameQuitEventData").getHash();
+    HIKARI_DEFINE_EVENT_TYPE(GameQuitEventData);
 
     GameQuitEventData::GameQuitEventData(QuitType quitType)
         : BaseEventData(0.0f)
@@ -25,7 +25,7 @@ namespace hikari {
     }
 
     EventDataPtr GameQuitEventData::copy() const {
-        return EventDataPtr(new GameQuitEventData(getQuitType()));
+        return makeEvent<GameQuitEventData>(getQuitType());
     }
 
     const char * GameQuitEventData::getName() const {
@@ -1,10 +1,10 @@
 #include "hikari/client/game/events/ObjectRemovedEventData.hpp"
-#include "hikari/core/util/HashedString.hpp"
+#include "hikari/client/game/events/EventPool.hpp"
 #include "hikari/core/util/Log.hpp"
 
 namespace hikari {
 
-    const EventType ObjectRemovedEventData::Type = HashedString("ObjectRemovedEventData").getHash();
+    HIKARI_DEFINE_EVENT_TYPE(ObjectRemovedEventData);
 
     ObjectRemovedEventData::ObjectRemovedEventData(int objectId)
         : BaseEventData(0.0f)
@@ -27,7 +27,7 @@ namespace hikari {
     }
 
     EventDataPtr ObjectRemovedEventData::copy() const {
-        return EventDataPtr(new ObjectRemovedEventData(getObjectId()));
+        return makeEvent<ObjectRemovedEventData>(getObjectId());
     }
 
     const char * ObjectRemovedEventData::getName() const {
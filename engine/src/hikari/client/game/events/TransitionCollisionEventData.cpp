@@ -1,8 +1,9 @@
 #include "hikari/client/game/events/TransitionCollisionEventData.hpp"
+#include "hikari/client/game/events/EventPool.hpp"
 
 namespace hikari {
 
-    const EventType TransitionCollisionEventData::Type = 0x94ae3da4;
+    HIKARI_DEFINE_EVENT_TYPE(TransitionCollisionEventData);
 
     TransitionCollisionEventData::TransitionCollisionEventData()
         : BaseEventData(0.0f)
@@ -19,7 +20,7 @@ namespace hikari {
     }
 
     EventDataPtr TransitionCollisionEventData::copy() const {
-        return EventDataPtr(new TransitionCollisionEventData());
+        return makeEvent<TransitionCollisionEventData>();
     }
 
     const char * TransitionCollisionEventData::getName() const {
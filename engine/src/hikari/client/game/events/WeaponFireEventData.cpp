@@ -1,9 +1,8 @@
 #include "hikari/client/game/events/WeaponFireEventData.hpp"
-#include "hikari/core/util/HashedString.hpp"
 
 namespace hikari {
 
-    const EventType WeaponFireEventData::Type = HashedString("WeaponFireEventData").getHash();
+    HIKARI_DEFINE_EVENT_TYPE(WeaponFireEventData);
 
     WeaponFireEventData::WeaponFireEventData(int weaponId, int shooterId, Faction faction, Direction direction, const Vector2<float> & position)
         : BaseEventData(0.0f)
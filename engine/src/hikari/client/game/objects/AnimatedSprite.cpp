@@ -1,6 +1,6 @@
 #include "hikari/client/game/objects/AnimatedSprite.hpp"
+#include "hikari/client/game/SpriteBatch.hpp"
 #include "hikari/core/game/Animation.hpp"
-#include "hikari/core/game/AnimationSet.hpp"
 
 #include <SFML/Graphics/RenderTarget.hpp>
 
@@ -11,6 +11,7 @@ namespace hikari {
     AnimatedSprite::AnimatedSprite()
         : sprite()
         , currentAnimation("")
+        , currentHandle(AnimationSet::INVALID_HANDLE)
         , animationSet()
         , animator(sprite)
         , isXAxisFlipped(false)
@@ -22,13 +23,30 @@ namespace hikari {
     AnimatedSprite::AnimatedSprite(const AnimatedSprite & proto)
         : sprite(proto.sprite)
         , currentAnimation("")
+        , currentHandle(AnimationSet::INVALID_HANDLE)
         , animationSet(proto.animationSet)
         , animator(sprite)
         , isXAxisFlipped(proto.isXAxisFlipped)
         , isYAxisFlipped(proto.isYAxisFlipped)
     {
         setAnimationSet(getAnimationSet());
-        setAnimation(proto.currentAnimation);
+        setAnimation(proto.currentHandle);
+    }
+
+    void AnimatedSprite::copyFrom(const AnimatedSprite & proto) {
+        sprite = proto.sprite;
+        isXAxisFlipped = proto.isXAxisFlipped;
+        isYAxisFlipped = proto.isYAxisFlipped;
+
+        setAnimationSet(proto.animationSet);
+
+        // Force the animation to be set again even if the handle matches
+        currentAnimation.clear();
+        currentHandle = AnimationSet::INVALID_HANDLE;
+        setAnimation(proto.currentHandle);
+
+        animator.unpause();
+        animator.rewind();
     }
 
     AnimatedSprite::~AnimatedSprite() {
@@ -43,17 +61,36 @@ namespace hikari {
         target.draw(sprite);
     }
 
+    void AnimatedSprite::render(SpriteBatch &batch) const {
+        batch.draw(sprite);
+    }
+
+    void AnimatedSprite::applyAnimation(const AnimationSet & animSet, AnimationHandle handle) {
+        const auto & animation = animSet.get(handle);
+
+        if(animation) {
+            animator.setAnimation(animation);
+            currentHandle = handle;
+            currentAnimation = animSet.getName(handle);
+        }
+    }
+
     void AnimatedSprite::setAnimation(const std::string & animationName) {
          if(animationName != currentAnimation) {
             if(auto animSet = animationSet.lock()) {
-                if(animSet->has(animationName)) {
-                    animator.setAnimation(animSet->get(animationName));
-                    currentAnimation = animationName;
-                }
+                applyAnimation(*animSet, animSet->getHandle(animationName));
             }
          }
     }
 
+    void AnimatedSprite::setAnimation(AnimationHandle animationHandle) {
+        if(animationHandle != currentHandle && animationHandle != AnimationSet::INVALID_HANDLE) {
+            if(auto animSet = animationSet.lock()) {
+                applyAnimation(*animSet, animationHandle);
+            }
+        }
+    }
+
     void AnimatedSprite::setAnimationSet(const std::weak_ptr<AnimationSet> & animationSetPtr) {
         if(!animationSetPtr.expired()) {
             animationSet = animationSetPtr;
@@ -72,6 +109,10 @@ namespace hikari {
         return currentAnimation;
     }
 
+    AnimationHandle AnimatedSprite::getAnimationHandle() const {
+        return currentHandle;
+    }
+
     const std::weak_ptr<AnimationSet> AnimatedSprite::getAnimationSet() const {
         return animationSet;
     }
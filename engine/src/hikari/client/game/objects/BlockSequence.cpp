@@ -2,6 +2,7 @@
 #include "hikari/client/game/events/EventBus.hpp"
 #include "hikari/client/game/events/EventData.hpp"
 #include "hikari/client/game/events/AudioEventData.hpp"
+#include "hikari/client/game/events/EventPool.hpp"
 #include "hikari/client/game/objects/Entity.hpp"
 #include "hikari/client/game/objects/Enemy.hpp"
 #include "hikari/client/game/objects/BlockSequence.hpp"
@@ -59,8 +60,7 @@ namespace hikari {
 
                 blockRects.push_back(shape);
 
-                std::unique_ptr<Enemy> entityUnique = world.spawnEnemy(descriptor.getEntityName());
-                std::shared_ptr<Enemy> entityShared(std::move(entityUnique));
+                std::shared_ptr<Enemy> entityShared = world.spawnEnemy(descriptor.getEntityName());
                 entityShared->setPosition(topLeft.getX(), topLeft.getY());
 
                 blockEntities.push_back(entityShared);
@@ -131,11 +131,9 @@ namespace hikari {
                 if(timingStep.getBlockIndicies().size()) {
                     if(auto events = eventBus.lock()) {
                         events->triggerEvent(
-                            EventDataPtr(
-                                new AudioEventData(
-                                    AudioEventData::ACTION_PLAY_SAMPLE,
-                                    descriptor.getSoundName()
-                                )
+                            makeEvent<AudioEventData>(
+                                AudioEventData::ACTION_PLAY_SAMPLE,
+                                descriptor.getSoundName()
                             )
                         );
                     }
@@ -219,6 +217,10 @@ namespace hikari {
         // }
     }
 
+    void BlockSequence::render(SpriteBatch &batch) {
+        // The blocks themselves are enemies and draw themselves.
+    }
+
     void BlockSequence::setZIndex(int index) {
         zIndex = index;
     }
@@ -1,7 +1,9 @@
 #include "hikari/client/game/objects/CollectableItem.hpp"
 #include "hikari/client/game/events/EventBus.hpp"
 #include "hikari/client/game/events/EntityDeathEventData.hpp"
+#include "hikari/client/game/events/EventPool.hpp"
 #include "hikari/client/game/Effect.hpp"
+#include "hikari/client/game/SpriteBatch.hpp"
 
 #include "hikari/core/game/map/Room.hpp"
 #include "hikari/core/util/Log.hpp"
@@ -49,7 +51,7 @@ namespace hikari {
         HIKARI_LOG(debug2) << "CollectableItem::onDeath()";
         if(auto eventManagetPtr = getEventBus().lock()) {
             // TODO: May want to triggerEvent() instead; test and see.
-            eventManagetPtr->queueEvent(EventDataPtr(new EntityDeathEventData(getId(), EntityDeathEventData::Item)));
+            eventManagetPtr->queueEvent(makeEvent<EntityDeathEventData>(getId(), EntityDeathEventData::Item));
         }
     }
 
@@ -71,6 +73,10 @@ namespace hikari {
         Entity::render(target);
     }
 
+    void CollectableItem::render(SpriteBatch &batch) {
+        Entity::render(batch);
+    }
+
     void CollectableItem::reset() {
         Entity::reset();
     }
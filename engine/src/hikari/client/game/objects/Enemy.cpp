@@ -1,7 +1,9 @@
 #include "hikari/client/game/objects/Enemy.hpp"
 #include "hikari/client/game/objects/EnemyBrain.hpp"
+#include "hikari/client/game/SpriteBatch.hpp"
 #include "hikari/client/game/events/EventBus.hpp"
 #include "hikari/client/game/events/EntityDeathEventData.hpp"
+#include "hikari/client/game/events/EventPool.hpp"
 #include "hikari/core/game/SpriteAnimator.hpp"
 #include "hikari/core/util/Log.hpp"
 #include <SFML/Graphics/RenderTarget.hpp>
@@ -49,12 +51,42 @@ namespace hikari {
         return std::unique_ptr<Enemy>(new Enemy(*this));
     }
 
+    void Enemy::recycle(const Enemy & proto) {
+        // Recycling deactivates the enemy, which shouldn't reach a brain that
+        // still thinks it's driving the old one. Set it aside until it's reset.
+        std::shared_ptr<EnemyBrain> recycledBrain;
+        recycledBrain.swap(brain);
+
+        Entity::recycle(proto);
+
+        hitPoints = proto.hitPoints;
+        damageTickCounter = 0;
+        bonusTableIndex = proto.bonusTableIndex;
+        canLiveOffscreen = proto.canLiveOffscreen;
+
+        setAgeless(true);
+
+        if(recycledBrain) {
+            recycledBrain->detach();
+            recycledBrain->reset();
+            setBrain(recycledBrain);
+        } else if(proto.brain) {
+            setBrain(proto.brain->clone());
+        }
+    }
+
     void Enemy::render(sf::RenderTarget &target) {
         if(damageTickCounter == 0) {
             Entity::render(target);
         }
     }
 
+    void Enemy::render(SpriteBatch &batch) {
+        if(damageTickCounter == 0) {
+            Entity::render(batch);
+        }
+    }
+
     void Enemy::onActivated() {
         if(brain) {
             brain->onActivated();
@@ -72,7 +104,7 @@ namespace hikari {
 
         if(getHitPoints() <= 0.0f) {
             if(auto eventManagetPtr = getEventBus().lock()) {
-                eventManagetPtr->queueEvent(EventDataPtr(new EntityDeathEventData(getId(), EntityDeathEventData::Enemy)));
+                eventManagetPtr->queueEvent(makeEvent<EntityDeathEventData>(getId(), EntityDeathEventData::Enemy));
             }
         }
         
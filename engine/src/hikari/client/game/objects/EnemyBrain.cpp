@@ -61,4 +61,12 @@ namespace hikari {
         // Does nothing
     }
 
+    void EnemyBrain::prewarm(std::size_t count) {
+        // Does nothing
+    }
+
+    void EnemyBrain::reset() {
+        // Does nothing
+    }
+
 } // hikari
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "hikari/client/game/objects/EnemyFactory.hpp"
 #include "hikari/client/game/objects/GameObject.hpp"
 #include "hikari/client/game/objects/Enemy.hpp"
+#include "hikari/client/game/objects/EnemyBrain.hpp"
 
 #include "hikari/client/scripting/SquirrelService.hpp"
 
@@ -25,20 +26,32 @@ namespace hikari {
 
     }
 
-    std::unique_ptr<Enemy> EnemyFactory::create(const std::string& enemyType) {
-        auto prototype = prototypeRegistry.find(enemyType);
+    std::shared_ptr<Enemy> EnemyFactory::create(const std::string& enemyType) {
+        auto pool = prototypeRegistry.find(enemyType);
 
-        if(prototype != std::end(prototypeRegistry)) {
-            return (*prototype).second->clone();
+        if(pool != std::end(prototypeRegistry)) {
+            return (*pool).second->acquire();
         } else {
             // TODO: Return a "default" item so no nullptrs will be made?
-            return std::unique_ptr<Enemy>(nullptr);
+            return std::shared_ptr<Enemy>(nullptr);
+        }
+    }
+
+    void EnemyFactory::prewarm(const std::string & enemyType, std::size_t count) {
+        auto pool = prototypeRegistry.find(enemyType);
+
+        if(pool != std::end(prototypeRegistry)) {
+            const auto & prototype = (*pool).second->getPrototype();
+
+            if(prototype && prototype->getBrain()) {
+                prototype->getBrain()->prewarm(count);
+            }
         }
     }
 
     void EnemyFactory::registerPrototype(const std::string & prototypeName, const std::shared_ptr<Enemy> & instance) {
         if(prototypeRegistry.find(prototypeName) == std::end(prototypeRegistry)) {
-            prototypeRegistry.insert(std::make_pair(prototypeName, instance));
+            prototypeRegistry.insert(std::make_pair(prototypeName, std::make_shared<ObjectPool<Enemy>>(instance)));
         } else {
             // Already registered; exception?
         }
@@ -2,11 +2,11 @@
 #include "hikari/client/game/objects/Enemy.hpp"
 #include "hikari/client/game/objects/EnemyBrain.hpp"
 #include "hikari/client/game/GameWorld.hpp"
-#include "hikari/client/game/events/EventBus.hpp"
-#include "hikari/client/game/events/ObjectRemovedEventData.hpp"
 
 #include "hikari/core/util/Log.hpp"
 
+#include <algorithm>
+
 namespace hikari {
 
     const unsigned int EnemySpawner::DEFAULT_SPAWN_LIMIT = 1;    // only spawn a single instance
@@ -31,21 +31,16 @@ namespace hikari {
         // No-op
     }
 
-    void EnemySpawner::handleObjectRemovedEvent(EventDataPtr event) {
-        auto eventData = std::static_pointer_cast<ObjectRemovedEventData>(event);
-
+    void EnemySpawner::onSpawnRemoved(int objectId) {
         // When an enemy "dies" it means that we can potentially spawn another
         // one when we wake up.
+        auto found = std::find(std::begin(spawnedEnemyIds), std::end(spawnedEnemyIds), objectId);
 
-        int deadEntityId = eventData->getObjectId();
+        if(found != std::end(spawnedEnemyIds)) {
+            HIKARI_LOG(debug4) << "EnemySpawner's enemy was consumed! id = " << objectId;
 
-        if(std::find(std::begin(spawnedEnemyIds), std::end(spawnedEnemyIds), deadEntityId) != std::end(spawnedEnemyIds)) {
-            HIKARI_LOG(debug4) << "EnemySpawner's enemy was consumed! id = " << eventData->getObjectId();
-
-            spawnedEnemyIds.erase(
-                std::remove(std::begin(spawnedEnemyIds), std::end(spawnedEnemyIds), deadEntityId)
-            );
-        } 
+            spawnedEnemyIds.erase(found);
+        }
     }
 
     void EnemySpawner::performAction(GameWorld & world) {
@@ -60,9 +55,10 @@ namespace hikari {
             spawnedObject->setPosition(getPosition());
             spawnedObject->setActive(true);
 
-            world.queueObjectAddition(std::shared_ptr<Enemy>(std::move(spawnedObject)));
+            world.queueObjectAddition(spawnedObject);
 
             spawnedEnemyIds.push_back(objectId);
+            world.setSpawnOwner(objectId, shared_from_this());
 
             // This resets the counter so that the spawner properly waits
             // to spawn another object.
@@ -72,23 +68,8 @@ namespace hikari {
         }
     }
 
-    void EnemySpawner::attachEventListeners(EventBus & EventBus) {
-        auto objectRemovedDelegate = EventListenerDelegate(std::bind(&EnemySpawner::handleObjectRemovedEvent, this, std::placeholders::_1));
-        EventBus.addListener(objectRemovedDelegate, ObjectRemovedEventData::Type);
-        eventHandlerDelegates.push_back(std::make_pair(objectRemovedDelegate, ObjectRemovedEventData::Type));
-    }
-
-    void EnemySpawner::detachEventListeners(EventBus & EventBus) {
-        std::for_each(
-            std::begin(eventHandlerDelegates),
-            std::end(eventHandlerDelegates), 
-            [&](const std::pair<EventListenerDelegate, EventType> & del) {
-                bool removed = EventBus.removeListener(del.first, del.second);
-                HIKARI_LOG(debug) << "EnemySpawner :: Removing event listener, type = " << del.second << ", succes = " << removed;
-            }
-        );
-
-        eventHandlerDelegates.clear();
+    void EnemySpawner::prepare(GameWorld & world) {
+        world.prewarmEnemies(enemyType, spawnLimit);
     }
 
     void EnemySpawner::setSpawnLimit(unsigned int limit) {
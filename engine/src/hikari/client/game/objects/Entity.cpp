@@ -1,8 +1,10 @@
 #include "hikari/client/game/objects/Entity.hpp"
 #include "hikari/client/game/objects/PalettedAnimatedSprite.hpp"
 #include "hikari/client/game/Shot.hpp"
+#include "hikari/client/game/SpriteBatch.hpp"
 #include "hikari/client/game/events/EventBus.hpp"
 #include "hikari/client/game/events/WeaponFireEventData.hpp"
+#include "hikari/client/game/events/EventPool.hpp"
 #include "hikari/core/game/map/Room.hpp"
 #include "hikari/core/game/map/Tileset.hpp"
 #include "hikari/core/game/SpriteAnimator.hpp"
@@ -37,6 +39,7 @@ namespace hikari {
         , obstacleFlag(false)
         , shieldFlag(false)
         , agelessFlag(false)
+        , obstacleStatusCallback()
         , age(DEFAULT_AGE_IN_M_SECONDS)
         , maximumAge(DEFAULT_MAXIMUM_AGE_IN_M_SECONDS)
         , actionSpot(0.0f, 0.0f)
@@ -78,6 +81,7 @@ namespace hikari {
         , obstacleFlag(proto.obstacleFlag)
         , shieldFlag(proto.shieldFlag)
         , agelessFlag(proto.agelessFlag)
+        , obstacleStatusCallback()
         , age(0)
         , maximumAge(proto.maximumAge)
         , actionSpot(proto.actionSpot)
@@ -104,6 +108,35 @@ namespace hikari {
     Entity::~Entity() {
     }
 
+    void Entity::recycle(const Entity & proto) {
+        renewId();
+
+        eventBus = proto.eventBus;
+        world = proto.world;
+        room = proto.room;
+        direction = proto.direction;
+        faction = proto.faction;
+        deathType = proto.deathType;
+        weaponId = proto.weaponId;
+        damageId = proto.damageId;
+        zIndex = proto.zIndex;
+        shieldFlag = proto.shieldFlag;
+        agelessFlag = proto.agelessFlag;
+        maximumAge = proto.maximumAge;
+        actionSpot = proto.actionSpot;
+        hitBoxes = proto.hitBoxes;
+        activeShots.clear();
+
+        setObstacle(proto.obstacleFlag);
+        body.copyState(proto.body);
+
+        if(proto.animatedSprite) {
+            animatedSprite->copyFrom(*proto.animatedSprite);
+        }
+
+        reset();
+    }
+
     std::unique_ptr<PalettedAnimatedSprite> & Entity::getAnimatedSprite() {
         return animatedSprite;
     }
@@ -114,6 +147,22 @@ namespace hikari {
         }
     }
 
+    void Entity::changeAnimation(AnimationHandle animationHandle) {
+        if(animatedSprite) {
+            animatedSprite->setAnimation(animationHandle);
+        }
+    }
+
+    AnimationHandle Entity::getAnimationHandle(const std::string& animationName) const {
+        if(animatedSprite) {
+            if(auto animSet = animatedSprite->getAnimationSet().lock()) {
+                return animSet->getHandle(animationName);
+            }
+        }
+
+        return AnimationSet::INVALID_HANDLE;
+    }
+
     void Entity::setAnimationSet(const std::shared_ptr<AnimationSet> & newAnimationSet) {
         if(newAnimationSet && animatedSprite) {
             animatedSprite->setAnimationSet(newAnimationSet);
@@ -274,7 +323,7 @@ namespace hikari {
                 }
 
                 events->triggerEvent(
-                    std::make_shared<WeaponFireEventData>(
+                    makeEvent<WeaponFireEventData>(
                         getWeaponId(),
                         getId(),
                         getFaction(),
@@ -390,13 +439,23 @@ namespace hikari {
     }
 
     void Entity::setObstacle(bool isObstacle) {
-        this->obstacleFlag = isObstacle;
+        if(this->obstacleFlag != isObstacle) {
+            this->obstacleFlag = isObstacle;
+
+            if(obstacleStatusCallback) {
+                obstacleStatusCallback(*this);
+            }
+        }
     }
 
     bool Entity::isObstacle() const {
         return obstacleFlag;
     }
 
+    void Entity::setObstacleStatusCallback(const ObstacleStatusCallback & callback) {
+        obstacleStatusCallback = callback;
+    }
+
     void Entity::setShielded(bool shielded) {
         this->shieldFlag = shielded;
         hitBoxes[0].shieldFlag = shielded;
@@ -475,30 +534,7 @@ namespace hikari {
         #ifdef HIKARI_DEBUG_ENTITIES
         // Draw bounding box behind sprite
         if(debug) {
-            // Bounding box is yellow
-            boxOutline.setOutlineColor(sf::Color(255, 255, 0));
-            target.draw(boxOutline);
-
-            for(auto hitBox = hitBoxes.begin();
-                hitBox != hitBoxes.end();
-                ++hitBox
-            ) {
-                auto & box = (*hitBox).bounds;
-
-                boxOutline.setPosition(std::floor(box.getLeft() ), std::floor(box.getTop()));
-                boxOutline.setSize(sf::Vector2f(std::floor(box.getWidth() ), std::floor(box.getHeight())));
-
-                boxPosition.setPosition(std::floor(box.getPosition().getX()), std::floor(box.getPosition().getY()));
-                boxPosition.setSize(sf::Vector2f(1.0f, 1.0f));
-
-                if((*hitBox).shieldFlag) {
-                    boxOutline.setOutlineColor(sf::Color(255, 0, 0));
-                } else {
-                    boxOutline.setOutlineColor(sf::Color(0, 255, 0));
-                }
-
-                target.draw(boxOutline);
-            }
+            renderDebugBoxes(target);
         }
         #endif // HIKARI_DEBUG_ENTITIES
 
@@ -512,6 +548,28 @@ namespace hikari {
         #endif // HIKARI_DEBUG_ENTITIES
     }
 
+    void Entity::render(SpriteBatch &batch) {
+        #ifdef HIKARI_DEBUG_ENTITIES
+        // Debug shapes go straight to the target, so anything already in the
+        // batch has to be drawn first to keep the order right.
+        sf::RenderTarget * target = batch.getTarget();
+
+        if(debug && target) {
+            batch.flush();
+            renderDebugBoxes(*target);
+        }
+        #endif // HIKARI_DEBUG_ENTITIES
+
+        renderEntity(batch);
+
+        #ifdef HIKARI_DEBUG_ENTITIES
+        if(debug && target) {
+            batch.flush();
+            target->draw(boxPosition);
+        }
+        #endif // HIKARI_DEBUG_ENTITIES
+    }
+
     int Entity::getZIndex() const {
         return zIndex;
     }
@@ -520,6 +578,33 @@ namespace hikari {
         zIndex = index;
     }
 
+    void Entity::renderDebugBoxes(sf::RenderTarget &target) {
+        // Bounding box is yellow
+        boxOutline.setOutlineColor(sf::Color(255, 255, 0));
+        target.draw(boxOutline);
+
+        for(auto hitBox = hitBoxes.begin();
+            hitBox != hitBoxes.end();
+            ++hitBox
+        ) {
+            auto & box = (*hitBox).bounds;
+
+            boxOutline.setPosition(std::floor(box.getLeft() ), std::floor(box.getTop()));
+            boxOutline.setSize(sf::Vector2f(std::floor(box.getWidth() ), std::floor(box.getHeight())));
+
+            boxPosition.setPosition(std::floor(box.getPosition().getX()), std::floor(box.getPosition().getY()));
+            boxPosition.setSize(sf::Vector2f(1.0f, 1.0f));
+
+            if((*hitBox).shieldFlag) {
+                boxOutline.setOutlineColor(sf::Color(255, 0, 0));
+            } else {
+                boxOutline.setOutlineColor(sf::Color(0, 255, 0));
+            }
+
+            target.draw(boxOutline);
+        }
+    }
+
     void Entity::renderEntity(sf::RenderTarget &target) {
         if(animatedSprite) {
             animatedSprite->setPosition(
@@ -529,6 +614,15 @@ namespace hikari {
         }
     }
 
+    void Entity::renderEntity(SpriteBatch &batch) {
+        if(animatedSprite) {
+            animatedSprite->setPosition(
+                getPosition().toFloor()
+            );
+            animatedSprite->render(batch);
+        }
+    }
+
     void Entity::removeNonActiveShots() {
         if(getActiveShotCount() > 0) {
             activeShots.erase(
@@ -9,7 +9,6 @@
 #include "hikari/client/game/objects/CollectableItem.hpp"
 #include "hikari/client/game/objects/Enemy.hpp"
 #include "hikari/client/game/objects/Projectile.hpp"
-#include "hikari/client/game/objects/Particle.hpp"
 #include "hikari/client/game/Effect.hpp"
 #include "hikari/client/game/objects/effects/NothingEffect.hpp"
 #include "hikari/client/game/objects/effects/ScriptedEffect.hpp"
@@ -112,7 +111,6 @@ namespace FactoryHelpers {
                                 auto item = std::make_shared<CollectableItem>(GameObject::generateObjectId(), nullptr, effectInstance);
 
                                 auto animationSetPtr = animationSetCache->get(animationSet);
-                                auto spriteTexture = imageCache->get(animationSetPtr->getImageFileName());
                                 item->setAnimationSet(animationSetPtr);
                                 item->changeAnimation(animationName);
                                 item->setBoundingBox(boundingBox);
@@ -258,7 +256,6 @@ namespace FactoryHelpers {
                                         }
 
                                         auto animationSetPtr = animationSetCache->get(animationSet);
-                                        auto spriteTexture = imageCache->get(animationSetPtr->getImageFileName());
 
                                         auto instance = std::make_shared<Enemy>(GameObject::generateObjectId(), nullptr);
                                         instance->setAnimationSet(animationSetPtr);
@@ -373,17 +370,18 @@ namespace FactoryHelpers {
                                 static_cast<float>(boundingBoxObject["originY"].asDouble())
                             );
 
-                            auto instance = std::make_shared<Particle>(static_cast<float>(maximumAge));
-
                             auto animationSetPtr = animationSetCache->get(animationSet);
-                            auto spriteTexture = imageCache->get(animationSetPtr->getImageFileName());
+                            ParticleTemplate particleTemplate;
+
+                            particleTemplate.texture = animationSetPtr->getTexture();
+                            particleTemplate.boundingBox = boundingBox;
+                            particleTemplate.maximumAge = static_cast<float>(maximumAge);
 
-                            instance->setAnimationSet(animationSetPtr);
-                            instance->setSpriteTexture(spriteTexture);
-                            instance->setBoundingBox(boundingBox);
-                            instance->setCurrentAnimation(animationName);
+                            if(animationSetPtr->has(animationName)) {
+                                particleTemplate.animation = animationSetPtr->get(animationName);
+                            }
 
-                            factoryPtr->registerPrototype(name, instance);
+                            factoryPtr->registerTemplate(name, particleTemplate);
                         }
                     }
 
@@ -457,7 +455,6 @@ namespace FactoryHelpers {
 
                                         auto instance = std::make_shared<hikari::Projectile>();
                                         auto animationSetPtr = animationSetCache->get(animationSet);
-                                        auto spriteTexture = imageCache->get(animationSetPtr->getImageFileName());
                                         instance->setAnimationSet(animationSetPtr);
                                         instance->setGravitated(isGravitated);
                                         instance->setPhasing(isPhasing);
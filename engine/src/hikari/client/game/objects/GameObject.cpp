@@ -42,6 +42,10 @@ namespace hikari {
         }
     }
 
+    void GameObject::renewId() {
+        id = generateObjectId();
+    }
+
     void GameObject::onActivated() {
 
     }
@@ -5,10 +5,12 @@
 #include "hikari/client/game/objects/HeroDamagedMobilityState.hpp"
 #include "hikari/client/game/objects/PalettedAnimatedSprite.hpp"
 #include "hikari/client/game/objects/Entity.hpp"
+#include "hikari/client/game/SpriteBatch.hpp"
 #include "hikari/client/game/events/EventBus.hpp"
 #include "hikari/client/game/events/EventData.hpp"
 #include "hikari/client/game/events/EntityDeathEventData.hpp"
 #include "hikari/client/game/events/EntityStateChangeEventData.hpp"
+#include "hikari/client/game/events/EventPool.hpp"
 #include "hikari/core/game/Animation.hpp"
 #include "hikari/core/game/map/Room.hpp"
 #include "hikari/core/math/NESNumber.hpp"
@@ -20,6 +22,24 @@
 
 namespace hikari {
 
+    const char * Hero::ANIMATION_NAMES[Hero::ANIMATION_COUNT] = {
+        "damaged-standing",
+        "morphing",
+        "teleporting",
+        "climbing-shooting",
+        "climbing-top",
+        "climbing",
+        "running-stopping",
+        "standing-shooting",
+        "standing",
+        "running-accelerating",
+        "running-shooting",
+        "running",
+        "sliding",
+        "jumping-shooting",
+        "jumping"
+    };
+
     Hero::Hero(int id, std::shared_ptr<Room> room)
         : Entity(id, room)
         , isDecelerating(false)
@@ -48,6 +68,7 @@ namespace hikari {
         , temporaryMobilityState(nullptr)
         , shootingState(nullptr)
         , nextShootingState(nullptr)
+        , animationHandles(ANIMATION_COUNT, AnimationSet::INVALID_HANDLE)
     {
         setDeathType(EntityDeathType::Hero);
 
@@ -65,7 +86,7 @@ namespace hikari {
             this->isAirborn = false;
 
             if(auto events = this->getEventBus().lock()) {
-                events->triggerEvent(EventDataPtr(new EntityStateChangeEventData(getId(), "landed")));
+                events->triggerEvent(makeEvent<EntityStateChangeEventData>(getId(), "landed"));
             }
 
 #ifdef HIKARI_DEBUG_HERO_PHYSICS
@@ -127,7 +148,7 @@ namespace hikari {
 
                 // Only emit event when plunging in to a body of water.
                 if(auto events = this->getEventBus().lock()) {
-                    events->triggerEvent(EventDataPtr(new EntityStateChangeEventData(getId(), "water")));
+                    events->triggerEvent(makeEvent<EntityStateChangeEventData>(getId(), "water"));
                 }
             }
         }
@@ -414,62 +435,76 @@ namespace hikari {
         }
     }
 
+    void Hero::setAnimationSet(const std::shared_ptr<AnimationSet> & newAnimationSet) {
+        Entity::setAnimationSet(newAnimationSet);
+
+        if(newAnimationSet) {
+            for(int i = 0; i < ANIMATION_COUNT; ++i) {
+                animationHandles[i] = newAnimationSet->getHandle(ANIMATION_NAMES[i]);
+            }
+        }
+    }
+
+    void Hero::useAnimation(AnimationId animation) {
+        changeAnimation(animationHandles[animation]);
+    }
+
     void Hero::chooseAnimation() {
         if(isStunned) {
-            changeAnimation("damaged-standing");
+            useAnimation(ANIMATION_DAMAGED_STANDING);
         }
         else if(isTeleporting) {
             if(isMorphing) {
-                changeAnimation("morphing");
+                useAnimation(ANIMATION_MORPHING);
             } else {
-                changeAnimation("teleporting");
+                useAnimation(ANIMATION_TELEPORTING);
             }
         } else {
             if(isClimbing) {
                 if(isShooting) {
-                    changeAnimation("climbing-shooting");
+                    useAnimation(ANIMATION_CLIMBING_SHOOTING);
                 } else {
                     if(isTouchingLadderTop) {
-                        changeAnimation("climbing-top");
+                        useAnimation(ANIMATION_CLIMBING_TOP);
                     } else {
-                        changeAnimation("climbing");
+                        useAnimation(ANIMATION_CLIMBING);
                     }
                 }
             }
             // Idle animations
             if(isStanding) {
                 if(isDecelerating) {
-                    changeAnimation("running-stopping");
+                    useAnimation(ANIMATION_RUNNING_STOPPING);
                 } else {
                     if(isShooting) {
-                        changeAnimation("standing-shooting");
+                        useAnimation(ANIMATION_STANDING_SHOOTING);
                     } else {
-                        changeAnimation("standing");
+                        useAnimation(ANIMATION_STANDING);
                     }
                 }
             }
             // Walking animations
             else if(isWalking) {
                 if(!isFullyAccelerated) {
-                    changeAnimation("running-accelerating");
+                    useAnimation(ANIMATION_RUNNING_ACCELERATING);
                 } else {
                     if(isShooting) {
-                        changeAnimation("running-shooting");
+                        useAnimation(ANIMATION_RUNNING_SHOOTING);
                     } else {
-                        changeAnimation("running");
+                        useAnimation(ANIMATION_RUNNING);
                     }
                 }
             }
             // Sliding
             else if(isSliding) {
-                changeAnimation("sliding");
+                useAnimation(ANIMATION_SLIDING);
             }
             // Falling or Jumping
             else if(isAirborn) {
                 if(isShooting) {
-                    changeAnimation("jumping-shooting");
+                    useAnimation(ANIMATION_JUMPING_SHOOTING);
                 } else {
-                    changeAnimation("jumping");
+                    useAnimation(ANIMATION_JUMPING);
                 }
             }
         }
@@ -481,6 +516,12 @@ namespace hikari {
         }
     }
 
+    void Hero::render(SpriteBatch &batch) {
+        if(isVisible) {
+            Entity::render(batch);
+        }
+    }
+
     void Hero::handleCollision(Movable& body, CollisionInfo& info) {
         if(info.isCollisionY && info.directionY == Directions::Down) {
             isAirborn = false;
@@ -4,6 +4,7 @@
 #include "hikari/client/game/objects/PalettedAnimatedSprite.hpp"
 #include "hikari/client/game/events/EventBus.hpp"
 #include "hikari/client/game/events/EntityDamageEventData.hpp"
+#include "hikari/client/game/events/EventPool.hpp"
 #include "hikari/core/game/SpriteAnimator.hpp"
 #include "hikari/core/game/Direction.hpp"
 #include "hikari/core/math/NESNumber.hpp"
@@ -54,7 +55,7 @@ namespace hikari {
         hero.getAnimatedSprite()->unpause();
 
         if(auto events = hero.getEventBus().lock()) {
-            events->triggerEvent(EventDataPtr(new EntityDamageEventData(hero.getId(), 0.0f)));
+            events->triggerEvent(makeEvent<EntityDamageEventData>(hero.getId(), 0.0f));
         }
     }
 
@@ -5,6 +5,7 @@
 #include "hikari/client/game/events/EventBus.hpp"
 #include "hikari/client/game/events/EventData.hpp"
 #include "hikari/client/game/events/EntityStateChangeEventData.hpp"
+#include "hikari/client/game/events/EventPool.hpp"
 
 namespace hikari {
 
@@ -48,7 +49,7 @@ namespace hikari {
         hero.stopShooting();
 
         if(auto events = hero.getEventBus().lock()) {
-            events->triggerEvent(EventDataPtr(new EntityStateChangeEventData(hero.getId(), "sliding")));
+            events->triggerEvent(makeEvent<EntityStateChangeEventData>(hero.getId(), "sliding"));
         }
     }
 
@@ -3,6 +3,7 @@
 #include "hikari/client/game/events/EventBus.hpp"
 #include "hikari/client/game/events/EventData.hpp"
 #include "hikari/client/game/events/EntityStateChangeEventData.hpp"
+#include "hikari/client/game/events/EventPool.hpp"
 
 namespace hikari {
 
@@ -37,7 +38,7 @@ namespace hikari {
             if(morphingCounter == 0.0f) {
                 hero.chooseAnimation();
                 if(auto events = hero.getEventBus().lock()) {
-                    events->triggerEvent(EventDataPtr(new EntityStateChangeEventData(hero.getId(), "teleporting")));
+                    events->triggerEvent(makeEvent<EntityStateChangeEventData>(hero.getId(), "teleporting"));
                 }
             }
 
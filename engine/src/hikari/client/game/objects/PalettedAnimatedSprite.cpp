@@ -1,5 +1,6 @@
 #include "hikari/client/game/objects/PalettedAnimatedSprite.hpp"
 
+#include "hikari/client/game/SpriteBatch.hpp"
 #include "hikari/core/util/FileSystem.hpp"
 
 #include <SFML/Graphics/Image.hpp>
@@ -7,10 +8,24 @@
 #include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
+#include <algorithm>
 #include <iostream>
 
 namespace hikari {
 
+    namespace {
+
+        /**
+         * The palette shader takes the palette index from the red channel of
+         * the vertex color, so sprites with different palettes can still be
+         * drawn together.
+         */
+        sf::Color encodePaletteIndex(int index) {
+            return sf::Color(static_cast<sf::Uint8>(std::max(0, std::min(index, 255))), 255, 255, 255);
+        }
+
+    }
+
     std::unique_ptr<sf::Shader> PalettedAnimatedSprite::pixelShader(nullptr);
     std::unique_ptr<sf::Image> PalettedAnimatedSprite::colorTableImage(nullptr);
     std::unique_ptr<sf::Texture> PalettedAnimatedSprite::colorTableTexture(nullptr);
@@ -96,6 +111,14 @@ namespace hikari {
 
     }
 
+    void PalettedAnimatedSprite::copyFrom(const PalettedAnimatedSprite & proto) {
+        AnimatedSprite::copyFrom(proto);
+
+        paletteIndex = proto.paletteIndex;
+        usePalette = proto.usePalette;
+        useSharedPalette = proto.useSharedPalette;
+    }
+
     void PalettedAnimatedSprite::update(float dt) {
         AnimatedSprite::update(dt);
     }
@@ -103,15 +126,29 @@ namespace hikari {
     void PalettedAnimatedSprite::render(sf::RenderTarget &target) const {
         if(isUsingPalette()) {
             if(pixelShader) {
-                pixelShader->setParameter("paletteIndex",
-                    static_cast<float>(isUsingSharedPalette() ? sharedPaletteIndex : paletteIndex));
-                target.draw(sprite, pixelShader.get());
+                sf::Sprite palettedSprite(sprite);
+                palettedSprite.setColor(encodePaletteIndex(getCurrentPaletteIndex()));
+                target.draw(palettedSprite, pixelShader.get());
             }
         } else {
             AnimatedSprite::render(target);
         }
     }
 
+    void PalettedAnimatedSprite::render(SpriteBatch &batch) const {
+        if(isUsingPalette()) {
+            if(pixelShader) {
+                batch.draw(sprite, *pixelShader, encodePaletteIndex(getCurrentPaletteIndex()));
+            }
+        } else {
+            AnimatedSprite::render(batch);
+        }
+    }
+
+    int PalettedAnimatedSprite::getCurrentPaletteIndex() const {
+        return isUsingSharedPalette() ? sharedPaletteIndex : paletteIndex;
+    }
+
     int PalettedAnimatedSprite::getPaletteIndex() const {
         return paletteIndex;
     }
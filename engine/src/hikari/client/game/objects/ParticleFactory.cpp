@@ -1,6 +1,4 @@
 #include "hikari/client/game/objects/ParticleFactory.hpp"
-#include "hikari/client/game/objects/GameObject.hpp"
-#include "hikari/client/game/objects/Particle.hpp"
 
 #include "hikari/core/game/AnimationLoader.hpp"
 #include "hikari/core/util/AnimationSetCache.hpp"
@@ -12,7 +10,7 @@ namespace hikari {
         : Service()
         , animationSetCache(animationSetCache)
         , imageCache(imageCache)
-        , prototypeRegistry()
+        , templateRegistry()
     {
          
     }
@@ -21,22 +19,21 @@ namespace hikari {
 
     }
 
-    std::unique_ptr<Particle> ParticleFactory::create(const std::string& ParticleType) {
-        auto prototype = prototypeRegistry.find(ParticleType);
+    const ParticleTemplate * ParticleFactory::findTemplate(const std::string & templateName) const {
+        auto found = templateRegistry.find(templateName);
 
-        if(prototype != std::end(prototypeRegistry)) {
-            return (*prototype).second->clone();
-        } else {
-            // TODO: Return a "default" item so no nullptrs will be made?
-            return std::unique_ptr<Particle>(nullptr);
+        if(found != std::end(templateRegistry)) {
+            return &(*found).second;
         }
+
+        return nullptr;
     }
 
-    void ParticleFactory::registerPrototype(const std::string & prototypeName, const std::shared_ptr<Particle> & instance) {
-        if(prototypeRegistry.find(prototypeName) == std::end(prototypeRegistry)) {
-            prototypeRegistry.insert(std::make_pair(prototypeName, instance));
+    void ParticleFactory::registerTemplate(const std::string & templateName, const ParticleTemplate & particleTemplate) {
+        if(templateRegistry.find(templateName) == std::end(templateRegistry)) {
+            templateRegistry.insert(std::make_pair(templateName, particleTemplate));
         } else {
             // Already registered; exception?
         }
     }
-} // hikari
\ No newline at end of file
+} // hikari
@@ -1,8 +1,10 @@
 #include "hikari/client/game/objects/Projectile.hpp"
 #include "hikari/client/game/objects/Motion.hpp"
 #include "hikari/client/game/objects/motions/LinearMotion.hpp"
+#include "hikari/client/game/SpriteBatch.hpp"
 #include "hikari/client/game/events/EventBus.hpp"
 #include "hikari/client/game/events/EntityDeathEventData.hpp"
+#include "hikari/client/game/events/EventPool.hpp"
 #include "hikari/core/game/SpriteAnimator.hpp"
 #include "hikari/core/math/Vector2.hpp"
 #include "hikari/core/util/Log.hpp"
@@ -39,10 +41,23 @@ namespace hikari {
         return std::unique_ptr<Projectile>(new Projectile(*this));
     }
 
+    void Projectile::recycle(const Projectile & proto) {
+        Entity::recycle(proto);
+
+        motion.reset();
+        inert = false;
+        parentId = proto.parentId;
+        reflectionType = proto.reflectionType;
+    }
+
     void Projectile::render(sf::RenderTarget &target) {
         Entity::render(target);
     }
 
+    void Projectile::render(SpriteBatch &batch) {
+        Entity::render(batch);
+    }
+
     void Projectile::update(float dt) {
         Entity::update(dt);
 
@@ -130,7 +145,7 @@ namespace hikari {
         HIKARI_LOG(debug2) << "Projectile::onDeath()";
         if(auto eventManagetPtr = getEventBus().lock()) {
             // TODO: May want to triggerEvent() instead; test and see.
-            eventManagetPtr->queueEvent(EventDataPtr(new EntityDeathEventData(getId(), EntityDeathEventData::Projectile)));
+            eventManagetPtr->queueEvent(makeEvent<EntityDeathEventData>(getId(), EntityDeathEventData::Projectile));
         }
     }
 
@@ -24,20 +24,20 @@ namespace hikari {
 
     }
 
-    std::unique_ptr<Projectile> ProjectileFactory::create(const std::string& ProjectileType) {
-        auto prototype = prototypeRegistry.find(ProjectileType);
+    std::shared_ptr<Projectile> ProjectileFactory::create(const std::string& ProjectileType) {
+        auto pool = prototypeRegistry.find(ProjectileType);
 
-        if(prototype != std::end(prototypeRegistry)) {
-            return (*prototype).second->clone();
+        if(pool != std::end(prototypeRegistry)) {
+            return (*pool).second->acquire();
         } else {
             // TODO: Return a "default" item so no nullptrs will be made?
-            return std::unique_ptr<Projectile>(nullptr);
+            return std::shared_ptr<Projectile>(nullptr);
         }
     }
 
     void ProjectileFactory::registerPrototype(const std::string & prototypeName, const std::shared_ptr<Projectile> & instance) {
         if(prototypeRegistry.find(prototypeName) == std::end(prototypeRegistry)) {
-            prototypeRegistry.insert(std::make_pair(prototypeName, instance));
+            prototypeRegistry.insert(std::make_pair(prototypeName, std::make_shared<ObjectPool<Projectile>>(instance)));
         } else {
             // Already registered; exception?
         }
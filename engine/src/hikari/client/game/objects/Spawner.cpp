@@ -33,6 +33,14 @@ namespace hikari {
 
     }
 
+    void Spawner::prepare(GameWorld & world) {
+
+    }
+
+    void Spawner::onSpawnRemoved(int objectId) {
+
+    }
+
     void Spawner::attachEventListeners(EventBus & EventBus) {
 
     }
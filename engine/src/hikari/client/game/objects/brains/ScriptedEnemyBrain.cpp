@@ -1,12 +1,95 @@
 #include "hikari/client/game/objects/brains/ScriptedEnemyBrain.hpp"
+#include "hikari/client/game/objects/WarmPool.hpp"
+#include "hikari/client/scripting/BehaviorUpdateBatch.hpp"
 #include "hikari/client/scripting/SquirrelService.hpp"
 
 #include "hikari/core/util/Log.hpp"
+#include "hikari/core/util/Profiler.hpp"
 
 #include <algorithm>
+#include <vector>
 
 namespace hikari {
 
+    namespace {
+        bool isSameObject(const Sqrat::Object & a, const Sqrat::Object & b) {
+            const HSQOBJECT & objectA = a.GetObject();
+            const HSQOBJECT & objectB = b.GetObject();
+
+            return objectA._type == objectB._type && objectA._unVal.pRefCounted == objectB._unVal.pRefCounted;
+        }
+
+        Sqrat::Object findMethod(const Sqrat::Object & classObject, const char * name) {
+            Sqrat::Object method = classObject.GetSlot(name);
+
+            if(method.GetType() == OT_CLOSURE || method.GetType() == OT_NATIVECLOSURE) {
+                return method;
+            }
+
+            return Sqrat::Object();
+        }
+
+        /**
+         * Finds a method, unless the class inherits it unchanged from a base
+         * class. Subclasses share the base class' closure for any method they
+         * don't override, so comparing the closures themselves is enough.
+         */
+        Sqrat::Object findOverriddenMethod(const Sqrat::Object & classObject, const Sqrat::Object & baseClass, const char * name) {
+            Sqrat::Object method = findMethod(classObject, name);
+
+            if(!baseClass.IsNull() && isSameObject(method, baseClass.GetSlot(name))) {
+                return Sqrat::Object();
+            }
+
+            return method;
+        }
+
+        Sqrat::Function makeProxy(HSQUIRRELVM vm, const Sqrat::Object & instance, const Sqrat::Object & method) {
+            if(method.IsNull()) {
+                return Sqrat::Function();
+            }
+
+            return Sqrat::Function(vm, instance.GetObject(), method.GetObject());
+        }
+    }
+
+    /**
+     * Everything about a script class which is the same for every instance:
+     * the class itself and its methods, resolved once by the prototype and
+     * shared with all of its clones, plus spare instances to bind: ones
+     * constructed ahead of time and ones left behind by destroyed brains. The
+     * latter are only reset when they're bound again, so that destroying a
+     * brain never has to call into the VM.
+     *
+     * Hooks the class inherits unchanged from EnemyBehavior do nothing, so they
+     * are left null and never called.
+     */
+    struct ScriptedEnemyBrain::ScriptClass {
+        struct WarmInstance {
+            Sqrat::Object object;
+            bool needsReset;
+        };
+
+        Sqrat::Object classObject;
+        Sqrat::Object constructor;
+        Sqrat::Object attach;
+        Sqrat::Object detach;
+        Sqrat::Object update;
+        Sqrat::Object onActivated;
+        Sqrat::Object onDeactivated;
+        Sqrat::Object applyConfig;
+        Sqrat::Object handleWorldCollision;
+        Sqrat::Object handleObjectTouch;
+        std::vector<HSQMEMBERHANDLE> fields;
+        WarmPool<WarmInstance> warmInstances;
+
+        ScriptClass()
+            : warmInstances(MAX_WARM_INSTANCES)
+        {
+        }
+    };
+
+    const char * ScriptedEnemyBrain::FUNCTION_NAME_CONSTRUCTOR = "constructor";
     const char * ScriptedEnemyBrain::FUNCTION_NAME_ATTACH = "attachHost";
     const char * ScriptedEnemyBrain::FUNCTION_NAME_DETACH = "detachHost";
     const char * ScriptedEnemyBrain::FUNCTION_NAME_APPLYCONFIG = "applyConfig";
@@ -16,10 +99,13 @@ namespace hikari {
     const char * ScriptedEnemyBrain::FUNCTION_NAME_ONACTIVATED = "onActivated";
     const char * ScriptedEnemyBrain::FUNCTION_NAME_ONDEACTIVATED = "onDeactivated";
     const char * ScriptedEnemyBrain::BASE_CLASS_NAME = "EnemyBehavior";
+    const std::size_t ScriptedEnemyBrain::MAX_WARM_INSTANCES = 8;
 
     ScriptedEnemyBrain::ScriptedEnemyBrain(SquirrelService& squirrel, const std::string& scriptClassName, const Sqrat::Table& classConfig)
         : vm(squirrel.getVmInstance())
+        , updateBatch(&squirrel.getBehaviorUpdateBatch())
         , scriptClassName(scriptClassName)
+        , scriptClass()
         , instance()
         , classConfig(classConfig)
     {
@@ -27,6 +113,8 @@ namespace hikari {
             this->classConfig = Sqrat::Table(vm);
         }
 
+        scriptClass = resolveScriptClass();
+
         if(!bindScriptClassInstance()) {
             // throw?
             HIKARI_LOG(error) << "ScriptedEnemyBrain failed to bind.";
@@ -35,7 +123,9 @@ namespace hikari {
 
     ScriptedEnemyBrain::ScriptedEnemyBrain(const ScriptedEnemyBrain & proto)
         : vm(proto.vm)
+        , updateBatch(proto.updateBatch)
         , scriptClassName(proto.scriptClassName)
+        , scriptClass(proto.scriptClass)
         , instance()
         , classConfig(proto.classConfig)
     {
@@ -50,53 +140,155 @@ namespace hikari {
     }
 
     ScriptedEnemyBrain::~ScriptedEnemyBrain() {
+        // Hand the instance back so the next clone can skip constructing one.
+        // It still refers to its old host, so it's reset before it's bound.
+        if(scriptClass && !instance.IsNull()) {
+            ScriptClass::WarmInstance used;
+            used.object = instance;
+            used.needsReset = true;
+
+            scriptClass->warmInstances.give(used);
+        }
+    }
 
+    std::shared_ptr<ScriptedEnemyBrain::ScriptClass> ScriptedEnemyBrain::resolveScriptClass() const {
+        if(scriptClassName.empty()) {
+            return nullptr;
+        }
+
+        Sqrat::Object classObject = Sqrat::RootTable(vm).GetSlot(scriptClassName.c_str());
+
+        if(classObject.GetType() != OT_CLASS) {
+            HIKARI_LOG(debug2) << "Could not find a constructor for '" << scriptClassName << "'.";
+            return nullptr;
+        }
+
+        Sqrat::Object baseClass = Sqrat::RootTable(vm).GetSlot(BASE_CLASS_NAME);
+
+        auto resolved = std::make_shared<ScriptClass>();
+        resolved->classObject = classObject;
+        resolved->constructor = findMethod(classObject, FUNCTION_NAME_CONSTRUCTOR);
+
+        // Attaching and detaching do real work in the base class, so they are
+        // always called.
+        resolved->attach = findMethod(classObject, FUNCTION_NAME_ATTACH);
+        resolved->detach = findMethod(classObject, FUNCTION_NAME_DETACH);
+        resolved->update = findOverriddenMethod(classObject, baseClass, FUNCTION_NAME_UPDATE);
+        resolved->onActivated = findOverriddenMethod(classObject, baseClass, FUNCTION_NAME_ONACTIVATED);
+        resolved->onDeactivated = findOverriddenMethod(classObject, baseClass, FUNCTION_NAME_ONDEACTIVATED);
+        resolved->applyConfig = findOverriddenMethod(classObject, baseClass, FUNCTION_NAME_APPLYCONFIG);
+        resolved->handleWorldCollision = findOverriddenMethod(classObject, baseClass, FUNCTION_NAME_HANDLECOLLISION);
+        resolved->handleObjectTouch = findOverriddenMethod(classObject, baseClass, FUNCTION_NAME_HANDLEOBJECTTOUCH);
+
+        // Remember where the instance variables are, so used instances can
+        // be put back to their defaults.
+        sq_pushobject(vm, classObject.GetObject());
+        sq_pushnull(vm);
+
+        while(SQ_SUCCEEDED(sq_next(vm, -2))) {
+            HSQMEMBERHANDLE handle;
+
+            // Drop the value; getting the handle pops the key.
+            sq_pop(vm, 1);
+
+            if(SQ_SUCCEEDED(sq_getmemberhandle(vm, -3, &handle))) {
+                if(!handle._static) {
+                    resolved->fields.push_back(handle);
+                }
+            } else {
+                sq_pop(vm, 1);
+            }
+        }
+
+        sq_pop(vm, 2);
+
+        return resolved;
+    }
+
+    Sqrat::Object ScriptedEnemyBrain::createInstance() const {
+        // Create an instance of the class, and run its constructor
+        Sqrat::PushVar(vm, scriptClass->classObject);
+        sq_createinstance(vm, -1);
+        Sqrat::Object newInstance = Sqrat::Var<Sqrat::Object>(vm, -1).value;
+        sq_pop(vm, 2);
+
+        if(Sqrat::Error::Instance().Occurred(vm)) {
+            HIKARI_LOG(error) << "Error creating instance for '" << scriptClassName << "'. " << Sqrat::Error::Instance().Message(vm);
+        }
+
+        if(!newInstance.IsNull()) {
+            construct(newInstance);
+        }
+
+        return newInstance;
+    }
+
+    void ScriptedEnemyBrain::construct(const Sqrat::Object & target) const {
+        if(!scriptClass->constructor.IsNull()) {
+            const Sqrat::Object & configRef = classConfig;
+
+            makeProxy(vm, target, scriptClass->constructor).Execute(configRef);
+
+            if(Sqrat::Error::Instance().Occurred(vm)) {
+                HIKARI_LOG(error) << "Error executing constructor for '" << scriptClassName << "'. " << Sqrat::Error::Instance().Message(vm);
+            }
+        }
+    }
+
+    void ScriptedEnemyBrain::resetInstance(const Sqrat::Object & target) const {
+        HIKARI_PROFILE_ZONE("ScriptedEnemyBrain::resetInstance");
+
+        const auto & fields = scriptClass->fields;
+
+        for(auto it = std::begin(fields), end = std::end(fields); it != end; it++) {
+            sq_pushobject(vm, target.GetObject());
+            sq_pushobject(vm, scriptClass->classObject.GetObject());
+
+            // Copy the class' default value into the instance
+            if(SQ_SUCCEEDED(sq_getbyhandle(vm, -1, &(*it)))) {
+                sq_setbyhandle(vm, -3, &(*it));
+            }
+
+            sq_pop(vm, 2);
+        }
+
+        construct(target);
     }
 
     bool ScriptedEnemyBrain::bindScriptClassInstance() {
         bool isValid = true;
 
-        if(scriptClassName.empty()) {
+        if(!scriptClass) {
             isValid = false;
         } else {
             try {
-                Sqrat::Object classObject = Sqrat::RootTable(vm).GetSlot(scriptClassName.c_str());
+                ScriptClass::WarmInstance warmInstance;
 
-                if(!classObject.IsNull()) {
-                    Sqrat::Object& configRef = classConfig;
+                if(scriptClass->warmInstances.take(warmInstance)) {
+                    instance = warmInstance.object;
 
-                    // Create an instance of the class, and run its constructor
-                    Sqrat::PushVar(vm, classObject);
-                    sq_createinstance(vm, -1);
-                    instance = Sqrat::Var<Sqrat::Object>(vm, -1).value;
-
-                    if(Sqrat::Error::Instance().Occurred(vm)) {
-                        HIKARI_LOG(error) << "Error creating instance for '" << scriptClassName << "'. " << Sqrat::Error::Instance().Message(vm);
-                    }
-
-                    Sqrat::Function(instance, "constructor").Execute(configRef);
-                    sq_pop(vm, 2);
-
-                    if(Sqrat::Error::Instance().Occurred(vm)) {
-                        HIKARI_LOG(error) << "Error executing constructor for '" << scriptClassName << "'. " << Sqrat::Error::Instance().Message(vm);
+                    if(warmInstance.needsReset) {
+                        resetInstance(instance);
                     }
+                } else {
+                    instance = createInstance();
+                }
 
-                    if(!instance.IsNull()) {
-                        proxyAttach = Sqrat::Function(instance, FUNCTION_NAME_ATTACH);
-                        proxyDetach = Sqrat::Function(instance, FUNCTION_NAME_DETACH);
-                        proxyUpdate = Sqrat::Function(instance, FUNCTION_NAME_UPDATE);
-                        proxyOnActivated = Sqrat::Function(instance, FUNCTION_NAME_ONACTIVATED);
-                        proxyOnDeactivated = Sqrat::Function(instance, FUNCTION_NAME_ONDEACTIVATED);
-                        proxyApplyConfig = Sqrat::Function(instance, FUNCTION_NAME_APPLYCONFIG);
-                        proxyHandleWorldCollision = Sqrat::Function(instance, FUNCTION_NAME_HANDLECOLLISION);
-                        proxyHandleObjectTouch = Sqrat::Function(instance, FUNCTION_NAME_HANDLEOBJECTTOUCH);
-                    } else {
-                        HIKARI_LOG(error) << "Constructor for '" << scriptClassName << "' did not return the correct object type.";
-                    }
+                if(!instance.IsNull()) {
+                    proxyAttach = makeProxy(vm, instance, scriptClass->attach);
+                    proxyDetach = makeProxy(vm, instance, scriptClass->detach);
+                    proxyUpdate = makeProxy(vm, instance, scriptClass->update);
+                    proxyOnActivated = makeProxy(vm, instance, scriptClass->onActivated);
+                    proxyOnDeactivated = makeProxy(vm, instance, scriptClass->onDeactivated);
+                    proxyApplyConfig = makeProxy(vm, instance, scriptClass->applyConfig);
+                    proxyHandleWorldCollision = makeProxy(vm, instance, scriptClass->handleWorldCollision);
+                    proxyHandleObjectTouch = makeProxy(vm, instance, scriptClass->handleObjectTouch);
                 } else {
-                    HIKARI_LOG(debug2) << "Could not find a constructor for '" << scriptClassName << "'.";
+                    isValid = false;
+                    HIKARI_LOG(error) << "Constructor for '" << scriptClassName << "' did not return the correct object type.";
                 }
             } catch(...) {
+                isValid = false;
                 HIKARI_LOG(error) << "Could not create an instance of '" << scriptClassName << "'.";
             }
         }
@@ -104,11 +296,42 @@ namespace hikari {
         return isValid;
     }
 
+    void ScriptedEnemyBrain::prewarm(std::size_t count) {
+        HIKARI_PROFILE_ZONE("ScriptedEnemyBrain::prewarm");
+
+        if(!scriptClass) {
+            return;
+        }
+
+        auto & warmInstances = scriptClass->warmInstances;
+        const std::size_t target = std::min(count, warmInstances.getCapacity());
+
+        while(warmInstances.getSize() < target) {
+            ScriptClass::WarmInstance warmInstance;
+            warmInstance.object = createInstance();
+            warmInstance.needsReset = false;
+
+            if(warmInstance.object.IsNull()) {
+                break;
+            }
+
+            warmInstances.give(warmInstance);
+        }
+    }
+
+    void ScriptedEnemyBrain::reset() {
+        if(scriptClass && !instance.IsNull()) {
+            resetInstance(instance);
+        }
+    }
+
     std::unique_ptr<EnemyBrain> ScriptedEnemyBrain::clone() const {
         return std::unique_ptr<EnemyBrain>(new ScriptedEnemyBrain(*this));
     }
 
     void ScriptedEnemyBrain::attach(Enemy* host) {
+        HIKARI_PROFILE_ZONE("ScriptedEnemyBrain::attach");
+
         EnemyBrain::attach(host);
 
         Sqrat::Table instanceConfig(vm);
@@ -123,6 +346,8 @@ namespace hikari {
     }
 
     void ScriptedEnemyBrain::detach() {
+        HIKARI_PROFILE_ZONE("ScriptedEnemyBrain::detach");
+
         if(!proxyDetach.IsNull()) {
             proxyDetach.Execute();
 
@@ -133,18 +358,28 @@ namespace hikari {
     }
 
     void ScriptedEnemyBrain::onActivated() {
+        HIKARI_PROFILE_ZONE("ScriptedEnemyBrain::onActivated");
+
         if(!proxyOnActivated.IsNull()) {
             proxyOnActivated.Execute();
         }
     }
 
     void ScriptedEnemyBrain::onDeactivated() {
+        HIKARI_PROFILE_ZONE("ScriptedEnemyBrain::onDeactivated");
+
         if(!proxyOnDeactivated.IsNull()) {
             proxyOnDeactivated.Execute();
         }
     }
 
     void ScriptedEnemyBrain::handleCollision(Movable& body, CollisionInfo& info) {
+        HIKARI_PROFILE_ZONE("ScriptedEnemyBrain::handleCollision");
+
+        if(proxyHandleWorldCollision.IsNull()) {
+            return;
+        }
+
         if(info.isCollisionX) {
             proxyHandleWorldCollision.Execute(info.directionX);
         } else if(info.isCollisionY) {
@@ -153,18 +388,30 @@ namespace hikari {
     }
 
     void ScriptedEnemyBrain::handleObjectTouch(int otherId) {
+        HIKARI_PROFILE_ZONE("ScriptedEnemyBrain::handleObjectTouch");
+
         if(!proxyHandleObjectTouch.IsNull()) {
             proxyHandleObjectTouch.Execute(otherId);
         }
     }
 
     void ScriptedEnemyBrain::update(float dt) {
-        if(!proxyUpdate.IsNull()) {
+        HIKARI_PROFILE_ZONE("ScriptedEnemyBrain::update");
+
+        if(proxyUpdate.IsNull()) {
+            return;
+        }
+
+        if(updateBatch && updateBatch->isOpen()) {
+            updateBatch->add(instance);
+        } else {
             proxyUpdate.Execute(dt);
         }
     }
 
     void ScriptedEnemyBrain::applyConfig(const Sqrat::Table & classConfig) {
+        HIKARI_PROFILE_ZONE("ScriptedEnemyBrain::applyConfig");
+
         if(!proxyApplyConfig.IsNull()) {
             proxyApplyConfig.Execute(classConfig);
         }
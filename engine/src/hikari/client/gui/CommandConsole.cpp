@@ -1,9 +1,14 @@
 #include "hikari/client/gui/CommandConsole.hpp"
 #include "hikari/core/gui/ImageFont.hpp"
 
+#include <iterator>
+#include <sstream>
+
 namespace hikari {
 namespace gui {
 
+    const unsigned int CommandConsole::MAX_HISTORY_LENGTH = 64;
+
     CommandConsole::CommandConsole(const std::shared_ptr<hikari::ImageFont> &font)
         : visible(true) 
         , state(StateClosed)
@@ -34,9 +39,51 @@ namespace gui {
     }
 
     void CommandConsole::commitCommand() {
-        // TODO: Execute command
-        commandHistory.push_back(commandBuffer);
+        appendToHistory(commandBuffer);
+
+        std::istringstream words(commandBuffer);
+        CommandArguments arguments(
+            (std::istream_iterator<std::string>(words)),
+            std::istream_iterator<std::string>()
+        );
+
         commandBuffer.clear();
+
+        if(!arguments.empty()) {
+            const std::string name = arguments.front();
+            arguments.erase(std::begin(arguments));
+
+            auto command = commands.find(name);
+
+            if(command != std::end(commands)) {
+                command->second(arguments, *this);
+            } else {
+                print("Unknown command: " + name);
+            }
+        }
+    }
+
+    void CommandConsole::addCommand(const std::string & name, const CommandHandler & handler) {
+        commands[name] = handler;
+    }
+
+    void CommandConsole::removeCommand(const std::string & name) {
+        commands.erase(name);
+    }
+
+    void CommandConsole::print(const std::string & line) {
+        appendToHistory(line);
+    }
+
+    void CommandConsole::appendToHistory(const std::string & line) {
+        commandHistory.push_back(line);
+
+        if(commandHistory.size() > MAX_HISTORY_LENGTH) {
+            commandHistory.erase(
+                std::begin(commandHistory),
+                std::end(commandHistory) - MAX_HISTORY_LENGTH
+            );
+        }
     }
 
     const bool CommandConsole::isOpen() const {
@@ -51,6 +98,11 @@ namespace gui {
         }
     }
 
+    void CommandConsole::close() {
+        state = StateClosed;
+        background.setPosition(background.getPosition().x, -102.0f);
+    }
+
     const bool CommandConsole::isVisible() const {
         return visible;
     }
@@ -0,0 +1,77 @@
+#include "hikari/client/gui/ConsoleCommands.hpp"
+#include "hikari/client/gui/CommandConsole.hpp"
+#include "hikari/client/game/events/EventBusImpl.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <vector>
+
+namespace hikari {
+namespace gui {
+
+    namespace {
+
+        const std::size_t DEFAULT_EVENT_TYPE_COUNT = 5;
+
+        double toMillis(std::uint64_t nanoseconds) {
+            return static_cast<double>(nanoseconds) / 1000000.0;
+        }
+
+    }
+
+    void registerEventBusCommands(CommandConsole & console, const std::string & name, const std::weak_ptr<EventBusImpl> & eventBus) {
+        console.addCommand(name, [eventBus](const CommandConsole::CommandArguments & arguments, CommandConsole & output) {
+            auto bus = eventBus.lock();
+
+            if(!bus) {
+                output.print("Event bus is gone.");
+                return;
+            }
+
+            const bool showAll = !arguments.empty() && arguments.front() == "all";
+
+            if(!arguments.empty() && arguments.front() == "reset") {
+                bus->resetStatistics();
+                output.print("Event statistics reset.");
+                return;
+            }
+
+            const EventBusImpl::StatisticsMap & statistics = bus->getStatistics();
+            std::vector<const EventBusImpl::EventTypeStatistics*> sorted;
+            sorted.reserve(statistics.size());
+
+            for(auto it = std::begin(statistics); it != std::end(statistics); ++it) {
+                sorted.push_back(&it->second);
+            }
+
+            std::sort(std::begin(sorted), std::end(sorted), [](const EventBusImpl::EventTypeStatistics * a, const EventBusImpl::EventTypeStatistics * b) {
+                return a->totalNanoseconds > b->totalNanoseconds;
+            });
+
+            if(!showAll && sorted.size() > DEFAULT_EVENT_TYPE_COUNT) {
+                sorted.resize(DEFAULT_EVENT_TYPE_COUNT);
+            }
+
+            std::ostringstream line;
+            line << bus->getQueuedEventCount() << " queued, " << statistics.size() << " types";
+            output.print(line.str());
+
+            for(auto it = std::begin(sorted); it != std::end(sorted); ++it) {
+                const EventBusImpl::EventTypeStatistics & entry = **it;
+
+                line.str("");
+                line << std::fixed << std::setprecision(2)
+                     << " " << entry.count << "x "
+                     << toMillis(entry.totalNanoseconds) << "ms max "
+                     << toMillis(entry.maxNanoseconds) << "ms";
+
+                output.print(entry.name);
+                output.print(line.str());
+            }
+        });
+    }
+
+} // hikari::gui
+} // hikari
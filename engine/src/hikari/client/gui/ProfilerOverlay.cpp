@@ -0,0 +1,94 @@
+#include "hikari/client/gui/ProfilerOverlay.hpp"
+#include "hikari/core/util/Profiler.hpp"
+
+#include <guichan/color.hpp>
+#include <guichan/font.hpp>
+#include <guichan/graphics.hpp>
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace hikari {
+namespace gui {
+
+    const unsigned int ProfilerOverlay::DEFAULT_WIDTH = 256;
+    const unsigned int ProfilerOverlay::DEFAULT_BACKGROUND_COLOR = 0x000000;
+    const unsigned int ProfilerOverlay::DEFAULT_FOREGROUND_COLOR = 0xfcfcfc;
+    const int ProfilerOverlay::DEFAULT_BACKGROUND_ALPHA = 192;
+    const unsigned int ProfilerOverlay::SAMPLE_FRAME_COUNT = 60;
+    const unsigned int ProfilerOverlay::MAX_ZONE_LINES = 10;
+
+    ProfilerOverlay::ProfilerOverlay(const Profiler & profiler)
+        : gcn::Widget()
+        , profiler(profiler)
+    {
+        setWidth(DEFAULT_WIDTH);
+        gcn::Color background(DEFAULT_BACKGROUND_COLOR);
+        background.a = DEFAULT_BACKGROUND_ALPHA;
+
+        setBackgroundColor(background);
+        setForegroundColor(gcn::Color(DEFAULT_FOREGROUND_COLOR));
+    }
+
+    ProfilerOverlay::~ProfilerOverlay() {
+
+    }
+
+    void ProfilerOverlay::draw(gcn::Graphics* graphics) {
+        std::vector<std::string> lines;
+        std::ostringstream line;
+        line << std::fixed << std::setprecision(2);
+
+        const std::size_t frameCount = std::min<std::size_t>(SAMPLE_FRAME_COUNT, profiler.getFrameCount());
+
+        if(frameCount == 0) {
+            lines.push_back("Profiler: no frames");
+        } else {
+            std::uint64_t totalFrameTime = 0;
+            std::uint64_t maxFrameTime = 0;
+
+            for(std::size_t age = 0; age < frameCount; ++age) {
+                const std::uint64_t duration = profiler.getFrame(age).duration;
+                totalFrameTime += duration;
+                maxFrameTime = std::max(maxFrameTime, duration);
+            }
+
+            const double averageMillis = static_cast<double>(totalFrameTime) / frameCount / 1000000.0;
+
+            line << "FPS " << std::setprecision(1) << (averageMillis > 0.0 ? 1000.0 / averageMillis : 0.0)
+                 << std::setprecision(2) << " " << averageMillis << "ms"
+                 << " max " << (static_cast<double>(maxFrameTime) / 1000000.0) << "ms";
+            lines.push_back(line.str());
+
+            const std::vector<Profiler::ZoneSummary> summaries = profiler.summarize(frameCount);
+            const std::size_t zoneLines = std::min<std::size_t>(summaries.size(), MAX_ZONE_LINES);
+
+            for(std::size_t i = 0; i < zoneLines; ++i) {
+                const Profiler::ZoneSummary & summary = summaries[i];
+
+                line.str("");
+                line << std::string(summary.depth, ' ') << summary.name << " "
+                     << (static_cast<double>(summary.totalDuration) / frameCount / 1000000.0);
+                lines.push_back(line.str());
+            }
+        }
+
+        const int lineHeight = getFont()->getHeight();
+        setHeight(static_cast<int>(lines.size()) * lineHeight + 2);
+
+        graphics->setColor(getBackgroundColor());
+        graphics->fillRectangle(0, 0, getWidth(), getHeight());
+
+        graphics->setFont(getFont());
+        graphics->setColor(getForegroundColor());
+
+        for(std::size_t i = 0; i < lines.size(); ++i) {
+            graphics->drawText(lines[i], 1, 1 + static_cast<int>(i) * lineHeight);
+        }
+    }
+
+} // hikari::gui
+} // hikari
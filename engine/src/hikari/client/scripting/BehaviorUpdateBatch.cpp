@@ -0,0 +1,84 @@
+#include "hikari/client/scripting/BehaviorUpdateBatch.hpp"
+
+#include "hikari/core/util/Log.hpp"
+#include "hikari/core/util/Profiler.hpp"
+
+namespace hikari {
+
+    const char * BehaviorUpdateBatch::DISPATCH_FUNCTION_NAME = "updateBehaviors";
+
+    BehaviorUpdateBatch::BehaviorUpdateBatch(HSQUIRRELVM vm)
+        : vm(vm)
+        , instances(vm)
+        , dispatchFunction()
+        , capacity(0)
+        , count(0)
+        , open(false)
+    {
+
+    }
+
+    bool BehaviorUpdateBatch::bindDispatchFunction() {
+        if(dispatchFunction.IsNull()) {
+            // The function is defined by the scripting environment, which is
+            // loaded after the service is created, so look it up on first use.
+            Sqrat::Object internalTable = Sqrat::RootTable(vm).GetSlot("hikari").GetSlot("internal");
+
+            if(!internalTable.IsNull()) {
+                dispatchFunction = Sqrat::Function(internalTable, DISPATCH_FUNCTION_NAME);
+            }
+        }
+
+        return !dispatchFunction.IsNull();
+    }
+
+    void BehaviorUpdateBatch::begin() {
+        count = 0;
+        open = true;
+    }
+
+    bool BehaviorUpdateBatch::isOpen() const {
+        return open;
+    }
+
+    void BehaviorUpdateBatch::add(const Sqrat::Object & instance) {
+        if(count < capacity) {
+            instances.SetValue(count, instance);
+        } else {
+            instances.Append(instance);
+            capacity++;
+        }
+
+        count++;
+    }
+
+    void BehaviorUpdateBatch::dispatch(float dt) {
+        HIKARI_PROFILE_ZONE("BehaviorUpdateBatch::dispatch");
+
+        open = false;
+
+        if(count == 0) {
+            return;
+        }
+
+        if(bindDispatchFunction()) {
+            // The script clears each slot as it goes, so the array doesn't
+            // keep instances alive after their brains are gone.
+            dispatchFunction.Execute(instances, count, dt);
+
+            if(Sqrat::Error::Instance().Occurred(vm)) {
+                HIKARI_LOG(error) << "Error dispatching behavior updates: " << Sqrat::Error::Instance().Message(vm);
+            }
+        } else {
+            HIKARI_LOG(error) << "Could not find ::hikari.internal." << DISPATCH_FUNCTION_NAME << "; updating behaviors one by one.";
+
+            for(SQInteger i = 0; i < count; ++i) {
+                Sqrat::Function(instances.GetSlot(i), "update").Execute(dt);
+                instances.SetValue(i, nullptr);
+            }
+        }
+
+        count = 0;
+    }
+
+} // hikari
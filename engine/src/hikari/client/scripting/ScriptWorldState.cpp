@@ -0,0 +1,55 @@
+#include "hikari/client/scripting/ScriptWorldState.hpp"
+
+namespace hikari {
+
+    const char * ScriptWorldState::TABLE_NAME = "world";
+    const char * ScriptWorldState::KEY_HERO_ID = "heroId";
+    const char * ScriptWorldState::KEY_HERO_X = "heroX";
+    const char * ScriptWorldState::KEY_HERO_Y = "heroY";
+    const char * ScriptWorldState::KEY_HERO_BOTTOM_Y = "heroBottomY";
+    const char * ScriptWorldState::KEY_IS_HERO_SHOOTING = "isHeroShooting";
+
+    ScriptWorldState::ScriptWorldState(HSQUIRRELVM vm)
+        : vm(vm)
+        , table()
+        , keyHeroId(makeKey(KEY_HERO_ID))
+        , keyHeroX(makeKey(KEY_HERO_X))
+        , keyHeroY(makeKey(KEY_HERO_Y))
+        , keyHeroBottomY(makeKey(KEY_HERO_BOTTOM_Y))
+        , keyIsHeroShooting(makeKey(KEY_IS_HERO_SHOOTING))
+    {
+        Sqrat::RootTable root(vm);
+        Sqrat::Object existing = root.GetSlot(TABLE_NAME);
+
+        if(existing.GetType() == OT_TABLE) {
+            table = Sqrat::Table(existing);
+        } else {
+            table = Sqrat::Table(vm);
+            root.Bind(TABLE_NAME, table);
+        }
+
+        // Make sure every slot exists before the first frame is published.
+        publish(-1, 0.0f, 0.0f, 0.0f, false);
+    }
+
+    Sqrat::Object ScriptWorldState::makeKey(const char * name) const {
+        HSQOBJECT key;
+
+        sq_pushstring(vm, name, -1);
+        sq_getstackobj(vm, -1, &key);
+
+        Sqrat::Object keyObject(key, vm);
+        sq_pop(vm, 1);
+
+        return keyObject;
+    }
+
+    void ScriptWorldState::publish(int heroId, float heroX, float heroY, float heroBottomY, bool isHeroShooting) {
+        setSlot(keyHeroId, heroId);
+        setSlot(keyHeroX, heroX);
+        setSlot(keyHeroY, heroY);
+        setSlot(keyHeroBottomY, heroBottomY);
+        setSlot(keyIsHeroShooting, isHeroShooting);
+    }
+
+} // hikari
@@ -1,5 +1,6 @@
 #include "hikari/client/scripting/SquirrelService.hpp"
 #include "hikari/client/scripting/AudioServiceScriptProxy.hpp"
+#include "hikari/client/scripting/BehaviorUpdateBatch.hpp"
 #include "hikari/client/scripting/GameProgressScriptProxy.hpp"
 #include "hikari/client/scripting/GamePlayStateScriptProxy.hpp"
 #include "hikari/client/game/objects/GameObject.hpp"
@@ -44,13 +45,18 @@ namespace hikari {
         : Service()
         , initialStackSize(initialStackSize)
         , vm(nullptr)
+        , behaviorUpdateBatch()
     {
         initVirtualMachine();
         initStandardLibraries();
         initBindings();
+
+        behaviorUpdateBatch.reset(new BehaviorUpdateBatch(vm));
     }
 
     SquirrelService::~SquirrelService() {
+        // The batch holds on to VM objects, so it has to go first.
+        behaviorUpdateBatch.reset();
         deinitVirtualMachine();
     }
 
@@ -174,7 +180,9 @@ namespace hikari {
                 .Prop(_SC("direction"), &Entity::getDirection, &Entity::setDirection)
                 .Prop(_SC("faction"), &Entity::getFaction, &Entity::setFaction)
                 .Prop(_SC("zIndex"), &Entity::getZIndex, &Entity::setZIndex)
-                .Func(_SC("changeAnimation"), &Entity::changeAnimation)
+                .Func(_SC("changeAnimation"), static_cast<void (Entity::*)(const std::string&)>(&Entity::changeAnimation))
+                .Func(_SC("changeAnimationByHandle"), static_cast<void (Entity::*)(AnimationHandle)>(&Entity::changeAnimation))
+                .Func(_SC("getAnimationHandle"), &Entity::getAnimationHandle)
                 .Func(_SC("getActiveShotCount"), &Entity::getActiveShotCount)
                 .Func(_SC("fireWeapon"), &Entity::fireWeapon)
                 .Func(_SC("setHitBoxShield"), &Entity::setHitBoxShield)
@@ -201,6 +209,10 @@ namespace hikari {
         return vm;
     }
 
+    BehaviorUpdateBatch & SquirrelService::getBehaviorUpdateBatch() {
+        return *behaviorUpdateBatch;
+    }
+
     void SquirrelService::runScriptFile(const std::string & fileName) {
         if(vm) {
             auto fileContents = FileSystem::readFileAsString(fileName);
@@ -59,14 +59,18 @@ namespace hikari {
             // Extract name and image file path
             std::string name = root[PROPERTY_NAME].asString();
             std::string imageFileName = root[PROPERTY_IMAGE_FILE_NAME].asString();
-            std::shared_ptr<sf::Texture> texture;
+            TextureRegion region;
 
             if(auto cache = imageCache.lock()) {
-                texture = cache->get(imageFileName);
+                region = cache->getRegion(imageFileName);
             }
 
+            // The image may be packed into an atlas page, in which case every
+            // frame has to be moved to where the image ended up.
+            const Point2D<int> sourceOffset(region.bounds.left, region.bounds.top);
+
             std::shared_ptr<AnimationSet> resultSet =
-                std::shared_ptr<AnimationSet>(new AnimationSet(name, imageFileName, texture));
+                std::shared_ptr<AnimationSet>(new AnimationSet(name, imageFileName, region.texture));
 
             // Extract animations
             const Json::Value animations = root[PROPERTY_ANIMATIONS];
@@ -77,7 +81,7 @@ namespace hikari {
                 const Json::Value animationJson = animations[animationName];
 
                 if(animationJson.isObject()) {
-                    std::shared_ptr<Animation> animation = loadFromJson(animationJson);
+                    std::shared_ptr<Animation> animation = loadFromJson(animationJson, sourceOffset);
 
                     if(animation) {
                         // TODO: Check to see if any of these fail
@@ -104,11 +108,11 @@ namespace hikari {
         }
     }
 
-    std::shared_ptr<Animation> AnimationLoader::loadFromJsonObject(const Json::Value &json) {
-        return loadFromJson(json);
+    std::shared_ptr<Animation> AnimationLoader::loadFromJsonObject(const Json::Value &json, const Point2D<int> &sourceOffset) {
+        return loadFromJson(json, sourceOffset);
     }
 
-    std::shared_ptr<Animation> AnimationLoader::loadFromJson(const Json::Value &json) {
+    std::shared_ptr<Animation> AnimationLoader::loadFromJson(const Json::Value &json, const Point2D<int> &sourceOffset) {
         //Json::Value root = JsonUtils::loadJson(fileName);
 
         if(!json.isNull()) {
@@ -135,8 +139,8 @@ namespace hikari {
                     const Json::Value jsonFrame = jsonFrames[i];
 
                     Rectangle2D<int> rectangle;
-                    rectangle.setX(jsonFrame.get(PROPERTY_FRAME_X, 0).asInt());
-                    rectangle.setY(jsonFrame.get(PROPERTY_FRAME_Y, 0).asInt());
+                    rectangle.setX(jsonFrame.get(PROPERTY_FRAME_X, 0).asInt() + sourceOffset.getX());
+                    rectangle.setY(jsonFrame.get(PROPERTY_FRAME_Y, 0).asInt() + sourceOffset.getY());
                     rectangle.setWidth(jsonFrame.get(PROPERTY_FRAME_WIDTH, 0).asInt());
                     rectangle.setHeight(jsonFrame.get(PROPERTY_FRAME_HEIGHT, 0).asInt());
 
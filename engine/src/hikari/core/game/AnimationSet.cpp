@@ -3,12 +3,19 @@
 namespace hikari {
 
     const AnimationPtr AnimationSet::NULL_ANIMATION = AnimationPtr();
+    const AnimationHandle AnimationSet::INVALID_HANDLE = -1;
+
+    namespace {
+        const std::string NO_NAME = "";
+    }
 
     AnimationSet::AnimationSet(const std::string& name, const std::string& imageFileName, const std::shared_ptr<sf::Texture> & texture)
         : name(name)
         , imageFileName(imageFileName)
         , texture(texture)
-        , animationMap() {
+        , animations()
+        , animationNames()
+        , handleMap() {
 
     }
 
@@ -29,29 +36,63 @@ namespace hikari {
             return false;
         }
 
-        animationMap.insert(
-            std::make_pair(name, animation)
+        const AnimationHandle handle = static_cast<AnimationHandle>(animations.size());
+
+        animations.push_back(animation);
+        animationNames.push_back(name);
+
+        handleMap.insert(
+            std::make_pair(name, handle)
         );
 
         return true;
     }
 
     bool AnimationSet::has(const std::string& name) const {
-        return animationMap.find(name) != animationMap.end();
+        return handleMap.find(name) != handleMap.end();
     }
 
     bool AnimationSet::remove(const std::string& name) {
-        animationMap.erase(name);
+        auto found = handleMap.find(name);
+
+        if(found != handleMap.end()) {
+            // Leave the slot empty so other handles stay valid.
+            animations[found->second].reset();
+            animationNames[found->second].clear();
+            handleMap.erase(found);
+        }
 
         return true;
     }
 
     const AnimationPtr& AnimationSet::get(const std::string& name) {
-        if(has(name)) {
-            return animationMap.find(name)->second;
+        return get(getHandle(name));
+    }
+
+    AnimationHandle AnimationSet::getHandle(const std::string& name) const {
+        auto found = handleMap.find(name);
+
+        if(found != handleMap.end()) {
+            return found->second;
+        }
+
+        return INVALID_HANDLE;
+    }
+
+    const AnimationPtr& AnimationSet::get(AnimationHandle handle) const {
+        if(handle >= 0 && static_cast<std::size_t>(handle) < animations.size()) {
+            return animations[handle];
         }
 
         return NULL_ANIMATION;
     }
 
-} // hikari
\ No newline at end of file
+    const std::string& AnimationSet::getName(AnimationHandle handle) const {
+        if(handle >= 0 && static_cast<std::size_t>(handle) < animationNames.size()) {
+            return animationNames[handle];
+        }
+
+        return NO_NAME;
+    }
+
+} // hikari
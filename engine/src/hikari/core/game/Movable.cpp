@@ -95,6 +95,26 @@ namespace hikari {
 
     }
 
+    void Movable::copyState(const Movable & proto) {
+        gravityApplicationCounter = proto.gravityApplicationCounter;
+        gravityApplicationThreshold = proto.gravityApplicationThreshold;
+        onGroundNow = proto.onGroundNow;
+        onGroundLastFrame = proto.onGroundLastFrame;
+        topBlockedFlag = proto.topBlockedFlag;
+        rightBlockedFlag = proto.rightBlockedFlag;
+        bottomBlockedFlag = proto.bottomBlockedFlag;
+        leftBlockedFlag = proto.leftBlockedFlag;
+        affectedByGravity = proto.affectedByGravity;
+        collidesWithWorld = proto.collidesWithWorld;
+        treatPlatformAsGround = proto.treatPlatformAsGround;
+        applyHorizontalVelocity = proto.applyHorizontalVelocity;
+        applyVerticalVelocity = proto.applyVerticalVelocity;
+        ambientVelocity = proto.ambientVelocity;
+        velocity = proto.velocity;
+        boundingBox = proto.boundingBox;
+        collisionInfo = proto.collisionInfo;
+    }
+
     Movable::~Movable() {
 
     }
@@ -12,6 +12,7 @@ namespace hikari {
     WorldCollisionResolver::WorldCollisionResolver()
         : world(nullptr)
         , tileBounds(0, 0, 0, 0)
+        , nearbyObstacles()
     {
     }
 
@@ -46,8 +47,6 @@ namespace hikari {
 
                 collisionInfo.isCollisionX = false;
 
-                const auto obstacles = world->getObstacles();
-                const std::size_t obstacleCount = obstacles.size();
                 const BoundingBoxF sweepBox(
                     static_cast<float>(x),
                     static_cast<float>(yMin),
@@ -55,6 +54,10 @@ namespace hikari {
                     static_cast<float>(yMax - yMin)
                 );
 
+                world->queryObstacles(sweepBox, nearbyObstacles);
+                const auto & obstacles = nearbyObstacles;
+                const std::size_t obstacleCount = obstacles.size();
+
                 for(std::size_t i = 0; i < obstacleCount; ++i) {
                     const auto & obstacleBounds = obstacles[i]->getBoundingBox();
 
@@ -108,8 +111,6 @@ namespace hikari {
 
                 collisionInfo.isCollisionY = false;
 
-                const auto obstacles = world->getObstacles();
-                const std::size_t obstacleCount = obstacles.size();
                 const BoundingBoxF sweepBox(
                     static_cast<float>(xMin),
                     static_cast<float>(y),
@@ -117,6 +118,10 @@ namespace hikari {
                     1.0f
                 );
 
+                world->queryObstacles(sweepBox, nearbyObstacles);
+                const auto & obstacles = nearbyObstacles;
+                const std::size_t obstacleCount = obstacles.size();
+
                 for(std::size_t i = 0; i < obstacleCount; ++i) {
                     const auto & obstacleBounds = obstacles[i]->getBoundingBox();
 
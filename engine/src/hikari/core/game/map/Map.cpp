@@ -19,11 +19,35 @@ namespace hikari {
         , bossCorridorRoomIndex(bossCorridorRoomIndex)
         , bossChamberRoomIndex(bossChamberRoomIndex)
         , tileset(tileset)
-        , rooms(rooms) 
+        , rooms(rooms)
+        , roomsMutex()
+        , roomRectangles()
+        , roomProvider()
+        , roomPreloader()
     {
         constructRoomRects();
     }
 
+    Map::Map(const TileDataPtr &tileset, const int &gridSize, const std::string & musicName, const std::string & bossEntity,
+            const std::vector< Rectangle2D<int> > &roomRectangles, const RoomProvider &roomProvider, const RoomPreloader &roomPreloader,
+            unsigned int startingRoomIndex, unsigned int midpointRoomIndex, unsigned int bossCorridorRoomIndex, unsigned int bossChamberRoomIndex)
+        : gridSize(gridSize)
+        , musicName(musicName)
+        , bossEntity(bossEntity)
+        , startingRoomIndex(startingRoomIndex)
+        , midpointRoomIndex(midpointRoomIndex)
+        , bossCorridorRoomIndex(bossCorridorRoomIndex)
+        , bossChamberRoomIndex(bossChamberRoomIndex)
+        , tileset(tileset)
+        , rooms(roomRectangles.size())
+        , roomsMutex()
+        , roomRectangles(roomRectangles)
+        , roomProvider(roomProvider)
+        , roomPreloader(roomPreloader)
+    {
+
+    }
+
     TileDataPtr Map::getTileset() const {
         return tileset;
     }
@@ -40,19 +64,19 @@ namespace hikari {
         return bossEntity;
     }
 
-    RoomPtr Map::getStartingRoom() const {
+    RoomPtr Map::getStartingRoom() {
         return getRoom(startingRoomIndex);
     }
 
-    RoomPtr Map::getMidpointRoom() const {
+    RoomPtr Map::getMidpointRoom() {
         return getRoom(midpointRoomIndex);
     }
 
-    RoomPtr Map::getBossCorridorRoom() const {
+    RoomPtr Map::getBossCorridorRoom() {
         return getRoom(bossCorridorRoomIndex);
     }
 
-    RoomPtr Map::getBossChamberRoom() const {
+    RoomPtr Map::getBossChamberRoom() {
         return getRoom(bossChamberRoomIndex);
     }
 
@@ -60,13 +84,34 @@ namespace hikari {
         return rooms.size();
     }
 
-    const RoomPtr Map::getRoom(unsigned int index) const {
+    RoomPtr Map::getRoom(unsigned int index) {
         if(index < getRoomCount()) {
-            return rooms.at(index);
+            std::lock_guard<std::mutex> lock(roomsMutex);
+            RoomPtr & room = rooms.at(index);
+
+            if(!room && roomProvider) {
+                room = roomProvider(index);
+            }
+
+            return room;
         }
         return RoomPtr();
     }
 
+    bool Map::isRoomLoaded(unsigned int index) const {
+        if(index < getRoomCount()) {
+            std::lock_guard<std::mutex> lock(roomsMutex);
+            return static_cast<bool>(rooms.at(index));
+        }
+        return false;
+    }
+
+    void Map::waitForRooms() {
+        if(roomPreloader) {
+            roomPreloader();
+        }
+    }
+
     const Rectangle2D<int>& Map::getRoomRect(unsigned int index) const {
         if(index < getRoomCount()) {
             return roomRectangles.at(index);
@@ -3,7 +3,11 @@
 #include "hikari/core/game/map/Door.hpp"
 #include "hikari/core/game/map/Force.hpp"
 #include "hikari/core/game/map/Room.hpp"
+#include "hikari/core/game/map/RoomBlueprint.hpp"
+#include "hikari/core/game/map/RoomStreamer.hpp"
+#include "hikari/core/game/map/RoomStreamWorker.hpp"
 #include "hikari/core/game/map/RoomTransition.hpp"
+#include "hikari/core/game/map/StageReader.hpp"
 #include "hikari/core/game/map/Tileset.hpp"
 #include "hikari/client/game/objects/Spawner.hpp"
 #include "hikari/client/game/objects/ItemSpawner.hpp"
@@ -13,6 +17,7 @@
 #include "hikari/client/scripting/SquirrelUtils.hpp"
 #include "hikari/core/geom/BoundingBox.hpp"
 #include "hikari/core/util/AnimationSetCache.hpp"
+#include "hikari/core/util/FileSystem.hpp"
 #include "hikari/core/util/ImageCache.hpp"
 #include "hikari/core/util/StringUtils.hpp"
 #include "hikari/core/util/TilesetCache.hpp"
@@ -27,88 +32,86 @@
 
 namespace hikari {
 
-    const char* MapLoader::PROP_TILESET = "tileset";
-    const char* MapLoader::PROP_GRIDSIZE = "gridsize";
-    const char* MapLoader::PROP_MUSICNAME = "musicName";
-    const char* MapLoader::PROP_ROOMS = "rooms";
-    const char* MapLoader::PROP_SPECIAL_ROOMS = "specialRooms";
-    const char* MapLoader::PROP_SPECIAL_ROOM_STARTING = "starting";
-    const char* MapLoader::PROP_SPECIAL_ROOM_MIDPOINT = "midpoint";
-    const char* MapLoader::PROP_SPECIAL_ROOM_BOSS_CORRIDOR = "bossCorridor";
-    const char* MapLoader::PROP_SPECIAL_ROOM_BOSS_CHAMBER = "bossChamber";
-    const char* MapLoader::PROP_BOSS_ENTITY = "bossEntity";
-    const char* MapLoader::PROP_ROOM_ID = "id";
-    const char* MapLoader::PROP_ROOM_X = "x";
-    const char* MapLoader::PROP_ROOM_Y = "y";
-    const char* MapLoader::PROP_ROOM_HERO_SPAWN_X = "heroSpawnX";
-    const char* MapLoader::PROP_ROOM_HERO_SPAWN_Y = "heroSpawnY";
-    const char* MapLoader::PROP_ROOM_WIDTH = "width";
-    const char* MapLoader::PROP_ROOM_HEIGHT = "height";
-    const char* MapLoader::PROP_ROOM_BG_COLOR = "backgroundColor";
-    const char* MapLoader::PROP_ROOM_CAMERABOUNDS = "cameraBounds";
-    const char* MapLoader::PROP_ROOM_CAMERABOUNDS_X = "x";
-    const char* MapLoader::PROP_ROOM_CAMERABOUNDS_Y = "y";
-    const char* MapLoader::PROP_ROOM_CAMERABOUNDS_WIDTH = "width";
-    const char* MapLoader::PROP_ROOM_CAMERABOUNDS_HEIGHT = "height";
-    const char* MapLoader::PROP_ROOM_TILE = "tile";
-    const char* MapLoader::PROP_ROOM_TILEATTRIBUTES = "attr";
-    const char* MapLoader::PROP_ROOM_ENEMIES = "enemies";
-    const char* MapLoader::PROP_ROOM_ENEMIES_TYPE = "type";
-    const char* MapLoader::PROP_ROOM_ENEMIES_POSITION = "position";
-    const char* MapLoader::PROP_ROOM_ENEMIES_POSITION_X = "x";
-    const char* MapLoader::PROP_ROOM_ENEMIES_POSITION_Y = "y";
-    const char* MapLoader::PROP_ROOM_ENEMIES_DIRECTION = "direction";
-    const char* MapLoader::PROP_ROOM_ITEMS = "items";
-    const char* MapLoader::PROP_ROOM_ITEMS_TYPE = "type";
-    const char* MapLoader::PROP_ROOM_ITEMS_X = "x";
-    const char* MapLoader::PROP_ROOM_ITEMS_Y = "y";
-    const char* MapLoader::PROP_ROOM_TRANSITIONS = "transitions";
-    const char* MapLoader::PROP_ROOM_DOORS = "doors";
-    const char* MapLoader::PROP_ROOM_DOORS_X = "x";
-    const char* MapLoader::PROP_ROOM_DOORS_Y = "y";
-    const char* MapLoader::PROP_ROOM_DOORS_WIDTH = "width";
-    const char* MapLoader::PROP_ROOM_DOORS_HEIGHT = "height";
-    const char* MapLoader::PROP_ROOM_DOORS_ENTRANCE = "entrance";
-    const char* MapLoader::PROP_ROOM_DOORS_EXIT = "exit";
-    const char* MapLoader::PROP_ROOM_BLOCKSEQUENCES = "blockSequences";
-    const char* MapLoader::PROP_ROOM_BLOCKSEQUENCES_X = "x";
-    const char* MapLoader::PROP_ROOM_BLOCKSEQUENCES_Y = "y";
-    const char* MapLoader::PROP_ROOM_BLOCKSEQUENCES_WIDTH = "width";
-    const char* MapLoader::PROP_ROOM_BLOCKSEQUENCES_HEIGHT = "height";
-    const char* MapLoader::PROP_ROOM_BLOCKSEQUENCES_BLOCKS = "blocks";
-    const char* MapLoader::PROP_ROOM_BLOCKSEQUENCES_SEQUENCE = "sequence";
-    const char* MapLoader::PROP_ROOM_BLOCKSEQUENCES_INTERVAL = "interval";
-    const char* MapLoader::PROP_ROOM_BLOCKSEQUENCES_MAXIMUM_BLOCK_AGE = "maximumBlockAge";
-    const char* MapLoader::PROP_ROOM_BLOCKSEQUENCES_ENTITY = "entity";
-    const char* MapLoader::PROP_ROOM_BLOCKSEQUENCES_SPAWN_SOUND = "spawnSound";
-
-    const int MapLoader::DEFAULT_HERO_SPAWN_X = 0;
-    const int MapLoader::DEFAULT_HERO_SPAWN_Y = 0;
-
     MapLoader::MapLoader(const std::shared_ptr<AnimationSetCache> & animationSetCache,
         const std::shared_ptr<ImageCache> & imageCache,
         const std::shared_ptr<TilesetCache> &tilesetCache
     )
         : animationSetCache(animationSetCache)
         , imageCache(imageCache)
-        , tilesetCache(tilesetCache) {
+        , tilesetCache(tilesetCache)
+        , compiler()
+        , roomStreamWorker(std::make_shared<RoomStreamWorker>()) {
 
     }
 
     MapLoader::~MapLoader() { }
 
     MapPtr MapLoader::loadFromJson(const Json::Value &json) const {
-        validateMapStructure(json);
+        compiler.validateMapStructure(json);
         return constructMap(json);
     }
 
-    MapPtr MapLoader::constructMap(const Json::Value &json) const {
-        // Parse map attributes
-        std::string tilesetName = json[PROP_TILESET].asString();
-        int gridSize = json[PROP_GRIDSIZE].asInt();
-        std::string musicName = json.get(PROP_MUSICNAME, "None").asString();
-        int roomCount = json[PROP_ROOMS].size();
+    MapPtr MapLoader::loadFromStage(const std::shared_ptr<const StageReader> &stage) const {
+        const unsigned int roomCount = stage->getRoomCount();
+        std::vector<Rectangle2D<int>> roomRectangles;
+
+        roomRectangles.reserve(roomCount);
+
+        for(unsigned int i = 0; i < roomCount; ++i) {
+            roomRectangles.push_back(stage->getRoomRect(i));
+        }
+
+        return constructStreamedMap(stage->getInfo(), roomRectangles, [stage](unsigned int index) {
+            return stage->readRoom(index);
+        });
+    }
 
+    MapPtr MapLoader::loadFromFile(const std::string &fileName) const {
+        if(!StringUtils::endsWith(fileName, StageFormat::FILE_EXTENSION)) {
+            throw std::runtime_error("\"" + fileName + "\" isn't a compiled stage. Maps are compiled with tools/stage-compiler.");
+        }
+
+        return loadFromStage(std::make_shared<const StageReader>(FileSystem::readFileAsCharBuffer(fileName)));
+    }
+
+    MapPtr MapLoader::constructStreamedMap(const StageInfo &info, const std::vector<Rectangle2D<int>> &roomRectangles,
+        const RoomStreamer::RoomSource &source) const
+    {
+        auto self = shared_from_this();
+        auto streamer = std::make_shared<RoomStreamer>(
+            source,
+            [self](RoomBlueprint &blueprint) {
+                return self->finishRoom(blueprint);
+            },
+            roomRectangles.size(),
+            roomStreamWorker
+        );
+
+        // The stage always begins in the starting room, so get it going now
+        streamer->prefetch(static_cast<unsigned int>(info.startingRoomIndex));
+
+        return MapPtr(
+            new Map(
+                loadTileset(info.tilesetName),
+                info.gridSize,
+                info.musicName,
+                info.bossEntity,
+                roomRectangles,
+                [streamer](unsigned int index) {
+                    return streamer->getRoom(index);
+                },
+                [streamer]() {
+                    streamer->waitForPrefetches();
+                },
+                info.startingRoomIndex,
+                info.midpointRoomIndex,
+                info.bossCorridorRoomIndex,
+                info.bossChamberRoomIndex
+            )
+        );
+    }
+
+    TileDataPtr MapLoader::loadTileset(const std::string &tilesetName) const {
         TileDataPtr tileset = nullptr;
 
         try {
@@ -117,101 +120,56 @@ namespace hikari {
             HIKARI_LOG(fatal) << "Couldn't load a tileset while constructing a map. (" << err.what() << ")";
         }
 
+        return tileset;
+    }
+
+    MapPtr MapLoader::constructMap(const Json::Value &json) const {
+        const StageInfo info = compiler.readStageInfo(json);
+        auto blueprints = compiler.prepareRooms(json);
+
         // Parse rooms
         std::vector<RoomPtr> rooms;
-        for(int i = 0; i < roomCount; ++i) {
-            rooms.push_back(constructRoom(json[PROP_ROOMS][i], gridSize));
+        for(auto it = std::begin(blueprints), end = std::end(blueprints); it != end; it++) {
+            rooms.push_back(finishRoom(**it));
         }
 
-        //
-        // Determine special room indicies
-        //
-        int startingRoomIndex = 0;
-        int midpointRoomIndex = 0;
-        int bossCorridorIndex = 0;
-        int bossChamberIndex  = 0;
-
-        auto specialRoomIndicies = json[PROP_SPECIAL_ROOMS];
-
-        if(!specialRoomIndicies.isNull()) {
-            startingRoomIndex = specialRoomIndicies.get(PROP_SPECIAL_ROOM_STARTING,      0).asInt();
-            midpointRoomIndex = specialRoomIndicies.get(PROP_SPECIAL_ROOM_MIDPOINT,      0).asInt();
-            bossCorridorIndex = specialRoomIndicies.get(PROP_SPECIAL_ROOM_BOSS_CORRIDOR, 0).asInt();
-            bossChamberIndex  = specialRoomIndicies.get(PROP_SPECIAL_ROOM_BOSS_CHAMBER,  0).asInt();
-        }
-
-        std::string bossEntity = json.get(PROP_BOSS_ENTITY, "None").asString();
-
         return MapPtr(
             new Map(
-                tileset,
-                gridSize,
-                musicName,
-                bossEntity,
+                loadTileset(info.tilesetName),
+                info.gridSize,
+                info.musicName,
+                info.bossEntity,
                 rooms,
-                startingRoomIndex,
-                midpointRoomIndex,
-                bossCorridorIndex,
-                bossChamberIndex
+                info.startingRoomIndex,
+                info.midpointRoomIndex,
+                info.bossCorridorRoomIndex,
+                info.bossChamberRoomIndex
             )
         );
     }
 
-    RoomPtr MapLoader::constructRoom(const Json::Value &json, int gridSize) const {
-        int id              = json[PROP_ROOM_ID].asInt();
-        int x               = json[PROP_ROOM_X].asInt();
-        int y               = json[PROP_ROOM_Y].asInt();
-        int width           = json[PROP_ROOM_WIDTH].asInt();
-        int height          = json[PROP_ROOM_HEIGHT].asInt();
-        int backgroundColor = json.get(PROP_ROOM_BG_COLOR, Room::DEFAULT_BG_COLOR).asInt();
-        int heroSpawnX      = json.get(PROP_ROOM_HERO_SPAWN_X, DEFAULT_HERO_SPAWN_X).asInt();
-        int heroSpawnY      = json.get(PROP_ROOM_HERO_SPAWN_Y, DEFAULT_HERO_SPAWN_Y).asInt();
-        int transitionCount = json[PROP_ROOM_TRANSITIONS].size();
-        int enemyCount      = json[PROP_ROOM_ENEMIES].size();
-        int itemCount       = json[PROP_ROOM_ITEMS].size();
-        int blockSequenceCount = 0;
-        bool hasDoors       = json.isMember(PROP_ROOM_DOORS);
-        const std::string bossEntity = json.get(PROP_BOSS_ENTITY, Room::DEFAULT_BOSS_ENTITY_NAME).asString();
-
-        Point2D<int> heroSpawnPosition = Point2D<int>(heroSpawnX, heroSpawnY);
-        Rectangle2D<int> cameraBounds = constructCameraBounds(json[PROP_ROOM_CAMERABOUNDS], x, y, gridSize);
-
-        //
-        // Store tiles and attributes
-        //
-        std::vector<int> tile(width * height, 0);
-        std::vector<int> attr(width * height, 0);
-
-        const auto & tileArray = json[PROP_ROOM_TILE];
-        const auto & attrArray = json[PROP_ROOM_TILEATTRIBUTES];
-
-        for(int ty = 0; ty < height; ++ty) {
-            for(int tx = 0; tx < width; ++tx) {
-                int offset = tx + (ty * width);
-                tile[offset] = tileArray[offset].asInt();
-                attr[offset] = attrArray[offset].asInt();
-            }
-        }
+    RoomPtr MapLoader::finishRoom(RoomBlueprint &blueprint) const {
+        const int x = blueprint.x;
+        const int y = blueprint.y;
+        const std::size_t enemyCount = blueprint.enemies.size();
+        const std::size_t itemCount = blueprint.items.size();
 
         // The origin of the room, in pixels, for relative object offsets.
-        int roomOriginX = x * gridSize;
-        int roomOriginY = y * gridSize;
-
-        HIKARI_LOG(debug4) << "Room origin: (" << roomOriginX << ", " << roomOriginY << ")";
+        int roomOriginX = x * blueprint.gridSize;
+        int roomOriginY = y * blueprint.gridSize;
 
         //
         // Construct spawners
         //
         std::vector<std::shared_ptr<Spawner>> spawners;
-
-        const auto & enemySpawnerArray = json[PROP_ROOM_ENEMIES];
+        spawners.reserve(enemyCount + itemCount);
 
         if(enemyCount > 0) {
             HIKARI_LOG(debug) << "Found " << enemyCount << " enemy declarations.";
-            for(int enemyIndex = 0; enemyIndex < enemyCount; ++enemyIndex) {
+            for(std::size_t enemyIndex = 0; enemyIndex < enemyCount; ++enemyIndex) {
                 spawners.emplace_back(
                     constructSpawner(
-                        enemySpawnerArray[enemyIndex],
+                        blueprint.enemies[enemyIndex],
                         SPAWN_ENEMY,
                         roomOriginX,
                         roomOriginY
@@ -220,14 +178,12 @@ namespace hikari {
             }
         }
 
-        const auto & itemSpawnerArray = json[PROP_ROOM_ITEMS];
-
         if(itemCount > 0) {
             HIKARI_LOG(debug) << "Found " << itemCount << " item declarations.";
-            for(int itemIndex = 0; itemIndex < itemCount; ++itemIndex) {
+            for(std::size_t itemIndex = 0; itemIndex < itemCount; ++itemIndex) {
                 spawners.emplace_back(
                     constructSpawner(
-                        itemSpawnerArray[itemIndex],
+                        blueprint.items[itemIndex],
                         SPAWN_ITEM,
                         roomOriginX,
                         roomOriginY
@@ -236,110 +192,51 @@ namespace hikari {
             }
         }
 
-        //
-        // Construct forces
-        //
-        std::vector<std::shared_ptr<Force>> forces;
-
-        const auto & forceArray = json["forces"];
-
-        if(forceArray.size() > 0) {
-            HIKARI_LOG(debug) << "Found " << forceArray.size() << " force declarations.";
-            for(std::size_t forceIndex = 0; forceIndex < forceArray.size(); ++forceIndex) {
-                forces.emplace_back(
-                    constructForce(
-                        forceArray[forceIndex],
-                        roomOriginX,
-                        roomOriginY
-                    )
-                );
-            }
-        }
-
-        //
-        // Construct transitions
-        //
-        std::vector<RoomTransition> transitions;
-        for(int i = 0; i < transitionCount; ++i) {
-            transitions.emplace_back(constructTransition(json[PROP_ROOM_TRANSITIONS][i]));
-        }
-
-        //
-        // Construct block sequences
-        //
-        std::vector<BlockSequenceDescriptor> blockSequences;
-
-        if(json[PROP_ROOM_BLOCKSEQUENCES].isArray()) {
-            blockSequenceCount = json[PROP_ROOM_BLOCKSEQUENCES].size();
-        }
-
-        for(int i = 0; i < blockSequenceCount; ++i) {
-            blockSequences.emplace_back(
-                constructBlockSequence(
-                    json[PROP_ROOM_BLOCKSEQUENCES][i],
-                    roomOriginX,
-                    roomOriginY,
-                    gridSize
-                )
-            );
-        }
-
         //
         // Construct doors
         //
         std::unique_ptr<Door> entranceDoor;
         std::unique_ptr<Door> exitDoor;
 
-        if(hasDoors) {
-            HIKARI_LOG(debug4) << "The room has doors array.";
-            const auto & doorsJson = json[PROP_ROOM_DOORS];
-
-            if(doorsJson.size() > 0) {
-                if(doorsJson.isMember(PROP_ROOM_DOORS_ENTRANCE)) {
-                    HIKARI_LOG(debug4) << "The room has an entrance.";
-                    entranceDoor = constructDoor(doorsJson[PROP_ROOM_DOORS_ENTRANCE], x, y);
-                }
+        if(blueprint.entranceDoor.present) {
+            entranceDoor = constructDoor(blueprint.entranceDoor, x, y);
+        }
 
-                if(doorsJson.isMember(PROP_ROOM_DOORS_EXIT)) {
-                    HIKARI_LOG(debug4) << "The room has an exit.";
-                    exitDoor = constructDoor(doorsJson[PROP_ROOM_DOORS_EXIT], x, y);
-                }
-            } else {
-                HIKARI_LOG(debug4) << "The room has no door definitions.";
-            }
+        if(blueprint.exitDoor.present) {
+            exitDoor = constructDoor(blueprint.exitDoor, x, y);
         }
 
         RoomPtr result(
             new Room(
-                id,
+                blueprint.id,
                 x,
                 y,
-                width,
-                height,
-                gridSize,
-                backgroundColor,
-                heroSpawnPosition,
-                cameraBounds,
-                std::move(tile),
-                std::move(attr),
-                std::move(transitions),
+                blueprint.width,
+                blueprint.height,
+                blueprint.gridSize,
+                blueprint.backgroundColor,
+                blueprint.heroSpawnPosition,
+                blueprint.cameraBounds,
+                std::move(blueprint.tile),
+                std::move(blueprint.attr),
+                std::move(blueprint.transitions),
                 std::move(spawners),
-                std::move(forces),
-                std::move(blockSequences),
+                std::move(blueprint.forces),
+                std::move(blueprint.blockSequences),
                 std::move(entranceDoor),
                 std::move(exitDoor),
-                bossEntity
+                blueprint.bossEntity
             )
         );
 
         return result;
     }
 
-    std::unique_ptr<Door> MapLoader::constructDoor(const Json::Value & json, int offsetX, int offsetY) const {
-        int x = json.get(PROP_ROOM_DOORS_X, 0).asInt();
-        int y = json.get(PROP_ROOM_DOORS_Y, 0).asInt();
-        int width = json.get(PROP_ROOM_DOORS_WIDTH, 1).asInt();
-        int height = json.get(PROP_ROOM_DOORS_HEIGHT, 3).asInt();
+    std::unique_ptr<Door> MapLoader::constructDoor(const DoorBlueprint & door, int offsetX, int offsetY) const {
+        int x = door.x;
+        int y = door.y;
+        int width = door.width;
+        int height = door.height;
 
         std::unique_ptr<Door> doorInstance(new Door(x + offsetX, y + offsetY, width, height));
 
@@ -351,75 +248,41 @@ namespace hikari {
         return doorInstance;
     }
 
-    SpawnerPtr MapLoader::constructSpawner(const Json::Value &json, SpawnType type, int offsetX, int offsetY) const {
+    SpawnerPtr MapLoader::constructSpawner(const SpawnerBlueprint &blueprint, SpawnType type, int offsetX, int offsetY) const {
         auto spawner = std::shared_ptr<Spawner>(nullptr);
 
         HIKARI_LOG(debug4) << "constructSpawner offset: (" << offsetX << ", " << offsetY << ")";
 
+        const int x = blueprint.position.getX() + offsetX;
+        const int y = blueprint.position.getY() + offsetY;
+
         switch(type) {
             case SPAWN_ITEM:
             {
-                auto type         = json[PROP_ROOM_ENEMIES_TYPE].asString();
-                auto x            = json[PROP_ROOM_ENEMIES_POSITION_X].asInt();
-                auto y            = json[PROP_ROOM_ENEMIES_POSITION_Y].asInt();
-                auto dirString    = json.get(PROP_ROOM_ENEMIES_DIRECTION, "None").asString();
-                auto direction    = (dirString == "Up" ? Directions::Up :
-                                        (dirString == "Right" ? Directions::Right :
-                                            (dirString == "Down" ? Directions::Down :
-                                                (dirString == "Left" ? Directions::Left :
-                                                    Directions::None)
-                                                )
-                                            )
-                                        );
-
-                x += offsetX;
-                y += offsetY;
-
-                spawner.reset(new ItemSpawner(type));
+                spawner.reset(new ItemSpawner(blueprint.type));
                 spawner->setPosition(Vector2<float>(static_cast<float>(x), static_cast<float>(y)));
-                spawner->setDirection(direction);
+                spawner->setDirection(blueprint.direction);
 
                 return spawner;
             }
 
             case SPAWN_ENEMY:
             {
-                auto type         = json[PROP_ROOM_ENEMIES_TYPE].asString();
-                auto x            = json[PROP_ROOM_ENEMIES_POSITION_X].asInt();
-                auto y            = json[PROP_ROOM_ENEMIES_POSITION_Y].asInt();
-                auto dirString    = json.get(PROP_ROOM_ENEMIES_DIRECTION, "None").asString();
-                auto direction    = (dirString == "Up" ? Directions::Up :
-                                        (dirString == "Right" ? Directions::Right :
-                                            (dirString == "Down" ? Directions::Down :
-                                                (dirString == "Left" ? Directions::Left :
-                                                    Directions::None)
-                                                )
-                                            )
-                                        );
-                auto spawnLimit   = json.get("spawnLimit", 1).asUInt();
-                auto spawnRate    = static_cast<float>(json.get("spawnRate", 1.0).asDouble());
-
-                x += offsetX;
-                y += offsetY;
-
                 HIKARI_LOG(debug4) << "Spawning enemy at (" << x << ", " << y << ")";
 
-                auto enemySpawner = std::make_shared<EnemySpawner>(type, spawnLimit, spawnRate);
+                auto enemySpawner = std::make_shared<EnemySpawner>(blueprint.type, blueprint.spawnLimit, blueprint.spawnRate);
                 enemySpawner->setPosition(Vector2<float>(static_cast<float>(x), static_cast<float>(y)));
-                enemySpawner->setDirection(direction);
+                enemySpawner->setDirection(blueprint.direction);
 
-                if(json.isMember("continuous")) {
-                    bool isContinuous = json["continuous"].asBool();
-                    enemySpawner->setContinuous(isContinuous);
+                if(blueprint.hasContinuous) {
+                    enemySpawner->setContinuous(blueprint.continuous);
                 }
 
-                if(json.isMember("config")) {
-                    auto configJson = json["config"];
-
+                if(blueprint.hasConfig) {
                     Sqrat::Table configTable(Sqrat::DefaultVM::Get());
 
-                    if(!configJson.isNull()) {
-                        configTable = SquirrelUtils::jsonToSquirrel(Sqrat::DefaultVM::Get(), configJson);
+                    if(!blueprint.config.isNull()) {
+                        configTable = SquirrelUtils::jsonToSquirrel(Sqrat::DefaultVM::Get(), blueprint.config);
                     }
 
                     enemySpawner->setInstanceConfig(configTable);
@@ -436,183 +299,4 @@ namespace hikari {
         return spawner;
     }
 
-    ForcePtr MapLoader::constructForce(const Json::Value &json, int offsetX, int offsetY) const {
-        HIKARI_LOG(debug4) << "constructForce offset: (" << offsetX << ", " << offsetY << ")";
-
-        auto x = json["x"].asInt();
-        auto y = json["y"].asInt();
-        auto width = json["width"].asInt();
-        auto height = json["height"].asInt();
-        auto vX = json.get("velocityX", 0.0f).asFloat();
-        auto vY = json.get("velocityY", 0.0f).asFloat();
-
-        auto force = std::make_shared<Force>(
-            BoundingBox<float>(
-                static_cast<float>(x),
-                static_cast<float>(y),
-                static_cast<float>(width),
-                static_cast<float>(height)
-            ),
-            Vector2<float>(vX, vY)
-        );
-
-        return force;
-    }
-
-    RoomTransition MapLoader::constructTransition(const Json::Value &json) const {
-        bool isDoor = json.get("door", false).asBool();
-        bool ladderOnly = json.get("ladderOnly", false).asBool();
-
-        // TODO: Do we need this?
-        int from = -1;
-
-        int to = json["to"].asInt();
-        int width = json["width"].asInt();
-        int height = json["height"].asInt();
-        int x = json["x"].asInt();
-        int y = json["y"].asInt();
-        RoomTransition::Direction dir;
-
-        std::string dirString = json["direction"].asString();
-
-        if(dirString == "forward") {
-            dir = RoomTransition::DirectionForward;
-        } else if(dirString == "backward") {
-            dir = RoomTransition::DirectionBackward;
-        } else if(dirString == "up") {
-            dir = RoomTransition::DirectionUp;
-        } else if(dirString == "down") {
-            dir = RoomTransition::DirectionDown;
-        } else {
-            // All other values are "transport" equivalents.
-            dir = RoomTransition::DirectionTeleport;
-        }
-
-        return RoomTransition(from, to, width, height, x, y, dir, isDoor, ladderOnly);
-    }
-
-    BlockSequenceDescriptor MapLoader::constructBlockSequence(const Json::Value &json,
-        int roomX, int roomY, int gridSize) const {
-        const int x = roomX + json[PROP_ROOM_BLOCKSEQUENCES_X].asInt() * gridSize;
-        const int y = roomY + json[PROP_ROOM_BLOCKSEQUENCES_Y].asInt() * gridSize;
-        const int width = json[PROP_ROOM_BLOCKSEQUENCES_WIDTH].asInt() * gridSize;
-        const int height = json[PROP_ROOM_BLOCKSEQUENCES_HEIGHT].asInt() * gridSize;
-
-        const float spawnInterval = json.get(
-            PROP_ROOM_BLOCKSEQUENCES_INTERVAL,
-            BlockSequenceDescriptor::DEFAULT_SPAWN_INTERVAL
-        ).asFloat();
-        const float maximumBlockAge = json.get(
-            PROP_ROOM_BLOCKSEQUENCES_MAXIMUM_BLOCK_AGE,
-            BlockSequenceDescriptor::DEFAULT_MAXIMUM_BLOCK_AGE
-        ).asFloat();
-
-        const std::string entityName = json.get(
-            PROP_ROOM_BLOCKSEQUENCES_ENTITY,
-            BlockSequenceDescriptor::DEFAULT_BLOCK_ENTITY
-        ).asString();
-        const std::string spawnSound = json.get(
-            PROP_ROOM_BLOCKSEQUENCES_SPAWN_SOUND,
-            BlockSequenceDescriptor::DEFAULT_SPAWN_SOUND
-        ).asString();
-
-        std::vector<Point2D<int>> blockPositions;
-        std::vector<BlockTiming> timing;
-
-        const auto & blockJson = json[PROP_ROOM_BLOCKSEQUENCES_BLOCKS];
-
-        if(blockJson.isArray()) {
-            const std::size_t length = blockJson.size();
-
-            for(std::size_t i = 0; i < length; ++i) {
-                const auto & block = blockJson[i];
-                int blockX = x + block[PROP_ROOM_BLOCKSEQUENCES_X].asInt() * gridSize;
-                int blockY = y + block[PROP_ROOM_BLOCKSEQUENCES_Y].asInt() * gridSize;
-
-                blockPositions.push_back(Point2D<int>(blockX, blockY));
-            }
-        }
-
-        const auto & sequenceJson = json[PROP_ROOM_BLOCKSEQUENCES_SEQUENCE];
-
-        if(sequenceJson.isArray()) {
-            const std::size_t length = sequenceJson.size();
-
-            for(std::size_t i = 0; i < length; ++i) {
-                const auto & blockIndiciesJson = sequenceJson[i];
-
-                std::vector<int> indicies;
-
-                for(std::size_t index = 0; index < blockIndiciesJson.size(); ++index) {
-                    const auto & id = blockIndiciesJson[index].asInt();
-                    indicies.push_back(id);
-                }
-
-                timing.push_back(BlockTiming(indicies));
-            }
-        }
-
-        return BlockSequenceDescriptor(
-            Rectangle2D<int>(x, y, width, height),
-            blockPositions,
-            timing,
-            spawnInterval,
-            maximumBlockAge,
-            entityName,
-            spawnSound
-        );
-    }
-
-    Rectangle2D<int> MapLoader::constructCameraBounds(const Json::Value &json,
-            int roomX, int roomY, int gridSize) const {
-        int x = (roomX + json[PROP_ROOM_CAMERABOUNDS_X].asInt()) * gridSize;
-        int y = (roomY + json[PROP_ROOM_CAMERABOUNDS_Y].asInt()) * gridSize;
-        int width = json[PROP_ROOM_CAMERABOUNDS_WIDTH].asInt() * gridSize;
-        int height = json[PROP_ROOM_CAMERABOUNDS_HEIGHT].asInt() * gridSize;
-
-        return Rectangle2D<int>(x, y, width, height);
-    }
-
-    bool MapLoader::validateMapStructure(const Json::Value &json) const {
-        bool isValid = true;
-
-        // Root must be an object
-        if(!json.isObject()) {
-            isValid = false;
-        }
-
-        // Root must contain a string property called "tileset"
-        if(!json[PROP_TILESET].isString()) {
-            isValid = false;
-        }
-
-        if(!json[PROP_GRIDSIZE].isNumeric()) {
-            isValid = false;
-        }
-
-        // Root must contain an array property called "rooms"
-        if(!json[PROP_ROOMS].isArray()) {
-            isValid = false;
-        }
-
-        // Validate rooms here
-
-        if(!isValid) {
-            throw std::runtime_error("JSON structure is not a valid Map.");
-        }
-
-        return isValid;
-    }
-
-    bool MapLoader::validateRoomStructure(const Json::Value &json) const {
-        bool isValid = true;
-
-        // Root must be an object
-        if(!json.isObject()) {
-            isValid = false;
-        }
-
-        return isValid;
-    }
-
 } // hikari
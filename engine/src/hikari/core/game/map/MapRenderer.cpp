@@ -3,9 +3,10 @@
 #include "hikari/core/game/map/Force.hpp"
 #include "hikari/core/game/map/Room.hpp"
 #include "hikari/core/game/map/Tileset.hpp"
+#include "hikari/core/util/Profiler.hpp"
 #include <SFML/Graphics.hpp>
 #include <algorithm>
-#include <cmath>
+#include <utility>
 
 #ifdef _DEBUG
 #include <iostream>
@@ -17,21 +18,48 @@ namespace hikari {
     bool MapRenderer::isDebugDoorRenderingEnabled = false;
     bool MapRenderer::isDebugForceRenderingEnabled = false;
     const int MapRenderer::TILE_OVERDRAW = 1;
+    const int MapRenderer::TILE_LAYER_MARGIN = 16;
+
+    namespace {
+        //
+        // Tile areas store their right and bottom edges in width and height
+        // (see MapRenderer::cullTiles).
+        //
+        bool containsArea(const Rectangle2D<int> &outer, const Rectangle2D<int> &inner) {
+            return inner.getX() >= outer.getX() && inner.getY() >= outer.getY()
+                && inner.getWidth() <= outer.getWidth() && inner.getHeight() <= outer.getHeight();
+        }
+
+        //
+        // Compares by control block rather than by address. A weak_ptr keeps
+        // its control block alive, so a destroyed room can't be mistaken for
+        // a new one that was allocated in the same place.
+        //
+        bool isSameRoom(const std::weak_ptr<Room> &a, const RoomPtr &b) {
+            return !a.owner_before(b) && !b.owner_before(a);
+        }
+    }
+
+    MapRenderer::TileLayer::TileLayer(const RoomPtr &room)
+        : room(room)
+        , vertices(sf::Quads)
+        , tileArea()
+        , tilesetRevision(0)
+        , animatedQuads()
+    {
+
+    }
 
     MapRenderer::MapRenderer(const RoomPtr &room, const TileDataPtr &tileData)
         : room(room)
         , tileData(tileData)
-        , tileSprite()
         , backgroundShape()
         , debugLadderShape()
         , debugForceShape()
         , visibleScreenArea()
         , visibleTileArea()
+        , tileLayers()
     {
-        if(tileData) {
-            tileSprite.setTexture(*(tileData->getTexture()));
-        }
-
         debugLadderShape.setFillColor(sf::Color(128, 128, 0, 96));
         debugLadderShape.setOutlineColor(sf::Color(255, 255, 255, 128));
         debugLadderShape.setOutlineThickness(1.0f);
@@ -43,7 +71,16 @@ namespace hikari {
 
     void MapRenderer::setRoom(const RoomPtr &room) {
         if(this->room != room) {
+            const RoomPtr previousRoom = this->room;
             this->room = room;
+
+            tileLayers.erase(
+                std::remove_if(std::begin(tileLayers), std::end(tileLayers), [&](const TileLayer &layer) {
+                    return layer.room.expired() || !(isSameRoom(layer.room, room) || isSameRoom(layer.room, previousRoom));
+                }),
+                std::end(tileLayers)
+            );
+
             buildBackgroundRectangle();
             cullTiles();
         }
@@ -55,7 +92,7 @@ namespace hikari {
 
     void MapRenderer::setTileData(const TileDataPtr &tileData) {
         this->tileData = tileData;
-        tileSprite.setTexture(*(tileData->getTexture()));
+        tileLayers.clear();
         cullTiles();
     }
 
@@ -64,30 +101,26 @@ namespace hikari {
     }
 
     void MapRenderer::renderBackground(sf::RenderTarget &target) {
+        HIKARI_PROFILE_ZONE("MapRenderer::renderBackground");
         target.draw(backgroundShape);
     }
 
     void MapRenderer::renderForeground(sf::RenderTarget &target) {
-        int tileIndex = Room::NO_TILE;
-        int tileAttributes = TileAttribute::NO_ATTRIBUTES;
-
-        for(int y = visibleTileArea.getY(); y < visibleTileArea.getHeight(); ++y) {
-            for(int x = visibleTileArea.getX(); x < visibleTileArea.getWidth(); ++x) {
-                tileIndex = room->getTileAt(x, y);
-                tileAttributes = room->getAttributeAt(x, y);
-
-                if(tileIndex == Room::NO_TILE) {
-                    continue;
-                }
+        HIKARI_PROFILE_ZONE("MapRenderer::renderForeground");
+        if(tileData) {
+            TileLayer & layer = getTileLayer();
 
-                applyTileToSprite(tileIndex, x, y);
-                applyTileAttributes(tileAttributes);
+            if(!containsArea(layer.tileArea, visibleTileArea)) {
+                rebuildTileLayer(layer);
+            } else if(layer.tilesetRevision != tileData->getRevision()) {
+                refreshAnimatedTiles(layer);
+            }
 
-                // TODO: Not sure about this... it may make the jittering MORE obvious...?
-                const auto & unQuantizedPosition = tileSprite.getPosition();
-                tileSprite.setPosition(std::ceil(unQuantizedPosition.x), std::ceil(unQuantizedPosition.y));
+            if(layer.vertices.getVertexCount() > 0) {
+                sf::RenderStates states;
+                states.texture = tileData->getTexture().get();
 
-                target.draw(tileSprite);
+                target.draw(layer.vertices, states);
             }
         }
 
@@ -217,35 +250,107 @@ namespace hikari {
         cullTiles();
     }
 
-    inline void MapRenderer::applyTileToSprite(const int &tileIndex, const int &x, const int &y) {
-        const sf::IntRect& rect = tileData->getTileRect(tileIndex);
+    MapRenderer::TileLayer & MapRenderer::getTileLayer() {
+        for(auto it = std::begin(tileLayers), end = std::end(tileLayers); it != end; it++) {
+            if(isSameRoom(it->room, room)) {
+                return *it;
+            }
+        }
+
+        tileLayers.push_back(TileLayer(room));
+        return tileLayers.back();
+    }
+
+    void MapRenderer::rebuildTileLayer(TileLayer &layer) {
+        layer.vertices.clear();
+        layer.animatedQuads.clear();
+        layer.tilesetRevision = tileData->getRevision();
+
+        // Build a margin around the visible tiles so the view can scroll a
+        // while before the layer has to be built again.
+        layer.tileArea.setX(std::max(visibleTileArea.getX() - TILE_LAYER_MARGIN, room->getX()));
+        layer.tileArea.setY(std::max(visibleTileArea.getY() - TILE_LAYER_MARGIN, room->getY()));
+        layer.tileArea.setWidth(std::min(visibleTileArea.getWidth() + TILE_LAYER_MARGIN, room->getX() + room->getWidth()));
+        layer.tileArea.setHeight(std::min(visibleTileArea.getHeight() + TILE_LAYER_MARGIN, room->getY() + room->getHeight()));
+
+        const Rectangle2D<int> & tileArea = layer.tileArea;
+        int tileIndex = Room::NO_TILE;
+        int tileAttributes = TileAttribute::NO_ATTRIBUTES;
+
+        for(int y = tileArea.getY(); y < tileArea.getHeight(); ++y) {
+            for(int x = tileArea.getX(); x < tileArea.getWidth(); ++x) {
+                tileIndex = room->getTileAt(x, y);
+                tileAttributes = room->getAttributeAt(x, y);
+
+                if(tileIndex == Room::NO_TILE) {
+                    continue;
+                }
+
+                const unsigned int firstVertex = layer.vertices.getVertexCount();
+                layer.vertices.resize(firstVertex + 4);
+
+                sf::Vertex * quad = &layer.vertices[firstVertex];
+                applyTileToQuad(quad, x, y);
+                applyTileAttributes(quad, tileIndex, tileAttributes);
+
+                if(tileData->isTileAnimated(tileIndex)) {
+                    AnimatedQuad animatedQuad;
+                    animatedQuad.tileIndex = tileIndex;
+                    animatedQuad.attributes = tileAttributes;
+                    animatedQuad.firstVertex = firstVertex;
+
+                    layer.animatedQuads.push_back(animatedQuad);
+                }
+            }
+        }
+    }
 
-        tileSprite.setTextureRect(rect);
-        tileSprite.setPosition(
-            static_cast<float>(x * tileData->getTileSize()),
-            static_cast<float>(y * tileData->getTileSize())
-        );
+    void MapRenderer::refreshAnimatedTiles(TileLayer &layer) {
+        layer.tilesetRevision = tileData->getRevision();
+
+        std::for_each(std::begin(layer.animatedQuads), std::end(layer.animatedQuads), [this, &layer](const AnimatedQuad & animatedQuad) {
+            applyTileAttributes(&layer.vertices[animatedQuad.firstVertex], animatedQuad.tileIndex, animatedQuad.attributes);
+        });
     }
 
-    inline void MapRenderer::applyTileAttributes(const int &attributes) {
-        //tileSprite.FlipX(false);
-        //tileSprite.FlipY(false);
-        tileSprite.setRotation(0.0f);
-        tileSprite.setOrigin(0.0f, 0.0f);
+    inline void MapRenderer::applyTileToQuad(sf::Vertex *quad, const int &x, const int &y) {
+        const float tileSize = static_cast<float>(tileData->getTileSize());
+        const float left = static_cast<float>(x) * tileSize;
+        const float top = static_cast<float>(y) * tileSize;
+
+        quad[0].position = sf::Vector2f(left, top);
+        quad[1].position = sf::Vector2f(left + tileSize, top);
+        quad[2].position = sf::Vector2f(left + tileSize, top + tileSize);
+        quad[3].position = sf::Vector2f(left, top + tileSize);
+    }
+
+    inline void MapRenderer::applyTileAttributes(sf::Vertex *quad, const int &tileIndex, const int &attributes) {
+        const sf::IntRect& rect = tileData->getTileRect(tileIndex);
+        float left = static_cast<float>(rect.left);
+        float top = static_cast<float>(rect.top);
+        float right = static_cast<float>(rect.left + rect.width);
+        float bottom = static_cast<float>(rect.top + rect.height);
 
+        // Flipping mirrors the texture, so swap its edges; rotation is applied after.
         if((attributes & TileAttribute::FLIP_HORIZONTAL) == TileAttribute::FLIP_HORIZONTAL) {
-            //tileSprite.FlipX(true);
+            std::swap(left, right);
         }
 
         if((attributes & TileAttribute::FLIP_VERTICAL) == TileAttribute::FLIP_VERTICAL) {
-            //tileSprite.FlipY(true);
+            std::swap(top, bottom);
         }
 
         if((attributes & TileAttribute::ROTATE_BY_90) == TileAttribute::ROTATE_BY_90) {
-            float tileRotationOffset = static_cast<float>(tileData->getTileSize() * 0.5f);
-            tileSprite.setOrigin(tileRotationOffset, tileRotationOffset);
-            tileSprite.setRotation(90.0f);
-            tileSprite.move(tileRotationOffset, tileRotationOffset);
+            // Rotating clockwise moves each texture corner one vertex along.
+            quad[0].texCoords = sf::Vector2f(left, bottom);
+            quad[1].texCoords = sf::Vector2f(left, top);
+            quad[2].texCoords = sf::Vector2f(right, top);
+            quad[3].texCoords = sf::Vector2f(right, bottom);
+        } else {
+            quad[0].texCoords = sf::Vector2f(left, top);
+            quad[1].texCoords = sf::Vector2f(right, top);
+            quad[2].texCoords = sf::Vector2f(right, bottom);
+            quad[3].texCoords = sf::Vector2f(left, bottom);
         }
     }
 
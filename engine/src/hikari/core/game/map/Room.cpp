@@ -1,16 +1,37 @@
 #include "hikari/core/game/map/Room.hpp"
-#include "hikari/core/game/map/Door.hpp"
 #include "hikari/core/game/map/Force.hpp"
-#include "hikari/core/game/map/Tileset.hpp"
+#include "hikari/core/game/map/TileAttribute.hpp"
 #include "hikari/core/util/Log.hpp"
 #include <memory>
 #include <algorithm>
-#include <list>
 
 namespace hikari {
 
     const std::string Room::DEFAULT_BOSS_ENTITY_NAME = "None";
 
+    //
+    // Size (in pixels) of a cell in the ladder, force and transition grids.
+    // Eight tiles, so a hero-sized query touches at most four cells.
+    //
+    const float Room::FEATURE_INDEX_CELL_SIZE = 128.0f;
+
+    namespace {
+
+        //
+        // Keeps the candidates from a grid query which really overlap the
+        // region; the grid only narrows things down to nearby cells.
+        //
+        void keepIntersecting(const std::vector<BoundingBox<float>> & featureBounds, const BoundingBox<float> & bounds, std::vector<int> & results) {
+            results.erase(
+                std::remove_if(std::begin(results), std::end(results), [&](int index) {
+                    return !featureBounds[index].intersects(bounds);
+                }),
+                std::end(results)
+            );
+        }
+
+    }
+
     Room::Room(int id, int x, int y, int width, int height, int gridSize, int backgroundColor,
             const Point2D<int> & heroSpawnPosition,
             const Rectangle2D<int> & cameraBounds,
@@ -40,11 +61,18 @@ namespace hikari {
         , spawners(spawners)
         , forces(forces)
         , blockSequences(blockSequences)
+        , ladders()
+        , forceBounds()
+        , transitionBounds()
+        , ladderIndex(FEATURE_INDEX_CELL_SIZE)
+        , forceIndex(FEATURE_INDEX_CELL_SIZE)
+        , transitionIndex(FEATURE_INDEX_CELL_SIZE)
         , entranceDoor(entranceDoor)
         , exitDoor(exitDoor)
         , bossEntityName(bossEntityName)
     {
         traceLadders();
+        indexFeatures();
     }
 
     Room::~Room() {
@@ -107,6 +135,37 @@ namespace hikari {
         }
     }
 
+    void Room::indexFeatures() {
+        for(std::size_t i = 0; i < ladders.size(); ++i) {
+            ladderIndex.update(static_cast<int>(i), ladders[i]);
+        }
+
+        // Force bounds never change once loaded, so they can be copied out.
+        forceBounds.reserve(forces.size());
+
+        for(std::size_t i = 0; i < forces.size(); ++i) {
+            forceBounds.push_back(forces[i]->getBounds());
+            forceIndex.update(static_cast<int>(i), forceBounds.back());
+        }
+
+        transitionBounds.reserve(transitions.size());
+
+        for(std::size_t i = 0; i < transitions.size(); ++i) {
+            const RoomTransition & transition = transitions[i];
+
+            transitionBounds.push_back(
+                BoundingBox<float>(
+                    static_cast<float>((getX() + transition.getX()) * getGridSize()),
+                    static_cast<float>((getY() + transition.getY()) * getGridSize()),
+                    static_cast<float>(transition.getWidth() * getGridSize()),
+                    static_cast<float>(transition.getHeight() * getGridSize())
+                )
+            );
+
+            transitionIndex.update(static_cast<int>(i), transitionBounds.back());
+        }
+    }
+
     const int Room::getId() const {
         return id;
     }
@@ -183,6 +242,10 @@ namespace hikari {
         return transitions;
     }
 
+    const std::vector<BoundingBox<float>> & Room::getTransitionBounds() const {
+        return transitionBounds;
+    }
+
     const std::vector<std::shared_ptr<Spawner>>& Room::getSpawners() const {
         return spawners;
     }
@@ -195,10 +258,25 @@ namespace hikari {
         return blockSequences;
     }
 
-    const std::list<BoundingBox<float>> & Room::getLadders() const {
+    const std::vector<BoundingBox<float>> & Room::getLadders() const {
         return ladders;
     }
 
+    void Room::queryLadders(const BoundingBox<float> & bounds, std::vector<int> & results) const {
+        ladderIndex.query(bounds, results);
+        keepIntersecting(ladders, bounds, results);
+    }
+
+    void Room::queryForces(const BoundingBox<float> & bounds, std::vector<int> & results) const {
+        forceIndex.query(bounds, results);
+        keepIntersecting(forceBounds, bounds, results);
+    }
+
+    void Room::queryTransitions(const BoundingBox<float> & bounds, std::vector<int> & results) const {
+        transitionIndex.query(bounds, results);
+        keepIntersecting(transitionBounds, bounds, results);
+    }
+
     std::vector<std::weak_ptr<Spawner>> Room::getSpawnerList() const {
         std::vector<std::weak_ptr<Spawner>> output;
         output.resize(spawners.size());
@@ -0,0 +1,84 @@
+#include "hikari/core/game/map/RoomStreamWorker.hpp"
+#include "hikari/core/game/map/RoomStreamer.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+namespace hikari {
+
+    // Shared with the thread so it can still stop cleanly if the worker is
+    // destroyed from the thread itself and has to detach it.
+    struct RoomStreamWorker::Jobs {
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::deque<std::weak_ptr<RoomStreamer>> queue;
+        bool stopping;
+
+        Jobs()
+            : mutex()
+            , condition()
+            , queue()
+            , stopping(false)
+        {
+        }
+    };
+
+    RoomStreamWorker::RoomStreamWorker()
+        : jobs(std::make_shared<Jobs>())
+        , thread()
+    {
+        thread = std::thread(&RoomStreamWorker::work, jobs);
+    }
+
+    RoomStreamWorker::~RoomStreamWorker() {
+        {
+            std::lock_guard<std::mutex> lock(jobs->mutex);
+            jobs->stopping = true;
+            jobs->queue.clear();
+        }
+
+        jobs->condition.notify_all();
+
+        if(thread.get_id() == std::this_thread::get_id()) {
+            thread.detach();
+        } else {
+            thread.join();
+        }
+    }
+
+    void RoomStreamWorker::schedule(const std::weak_ptr<RoomStreamer> & streamer) {
+        {
+            std::lock_guard<std::mutex> lock(jobs->mutex);
+            jobs->queue.push_back(streamer);
+        }
+
+        jobs->condition.notify_one();
+    }
+
+    void RoomStreamWorker::work(std::shared_ptr<Jobs> jobs) {
+        std::unique_lock<std::mutex> lock(jobs->mutex);
+
+        for(;;) {
+            jobs->condition.wait(lock, [&jobs]() {
+                return jobs->stopping || !jobs->queue.empty();
+            });
+
+            if(jobs->stopping) {
+                return;
+            }
+
+            std::weak_ptr<RoomStreamer> job = jobs->queue.front();
+            jobs->queue.pop_front();
+
+            lock.unlock();
+
+            if(auto streamer = job.lock()) {
+                streamer->prepareNext();
+            }
+
+            lock.lock();
+        }
+    }
+
+} // hikari
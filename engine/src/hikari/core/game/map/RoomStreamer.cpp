@@ -0,0 +1,147 @@
+#include "hikari/core/game/map/RoomStreamer.hpp"
+#include "hikari/core/game/map/RoomBlueprint.hpp"
+#include "hikari/core/game/map/RoomStreamWorker.hpp"
+#include "hikari/core/util/Log.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace hikari {
+
+    RoomStreamer::RoomStreamer(const RoomSource & source, const RoomFinisher & finisher,
+        unsigned int roomCount, const std::shared_ptr<RoomStreamWorker> & worker)
+        : source(source)
+        , finisher(finisher)
+        , roomCount(roomCount)
+        , worker(worker)
+        , mutex()
+        , condition()
+        , queue()
+        , requested()
+        , prepared()
+        , working(false)
+        , workingIndex(0)
+    {
+
+    }
+
+    void RoomStreamer::prefetch(unsigned int index) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            if(index >= roomCount || !requested.insert(index).second) {
+                return;
+            }
+
+            queue.push_back(index);
+        }
+
+        worker->schedule(shared_from_this());
+    }
+
+    void RoomStreamer::waitForPrefetches() {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        condition.wait(lock, [this]() {
+            return queue.empty() && !working;
+        });
+    }
+
+    RoomPtr RoomStreamer::getRoom(unsigned int index) {
+        if(index >= roomCount) {
+            return RoomPtr();
+        }
+
+        std::unique_ptr<RoomBlueprint> blueprint;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+
+            requested.insert(index);
+
+            // Not started yet; it's quicker to build it here than to wait.
+            auto queued = std::find(std::begin(queue), std::end(queue), index);
+
+            if(queued != std::end(queue)) {
+                queue.erase(queued);
+                condition.notify_all();
+            }
+
+            condition.wait(lock, [this, index]() {
+                return !(working && workingIndex == index);
+            });
+
+            auto found = prepared.find(index);
+
+            if(found != std::end(prepared)) {
+                blueprint = std::move(found->second);
+                prepared.erase(found);
+            }
+        }
+
+        if(!blueprint) {
+            blueprint = prepare(index);
+        } else {
+            HIKARI_LOG(debug2) << "Using prefetched room " << index;
+        }
+
+        if(!blueprint) {
+            return RoomPtr();
+        }
+
+        // Finishing may move the transitions out of the blueprint.
+        std::vector<unsigned int> linkedRooms;
+
+        for(auto it = std::begin(blueprint->transitions), end = std::end(blueprint->transitions); it != end; it++) {
+            if(it->getToRegion() >= 0) {
+                linkedRooms.push_back(static_cast<unsigned int>(it->getToRegion()));
+            }
+        }
+
+        RoomPtr room = finisher(*blueprint);
+
+        // Get the rooms we're most likely to visit next ready
+        std::for_each(std::begin(linkedRooms), std::end(linkedRooms), [this](unsigned int linkedRoom) {
+            prefetch(linkedRoom);
+        });
+
+        return room;
+    }
+
+    std::unique_ptr<RoomBlueprint> RoomStreamer::prepare(unsigned int index) const {
+        try {
+            return source(index);
+        } catch(std::exception & ex) {
+            HIKARI_LOG(error) << "Failed to prepare room " << index << ": " << ex.what();
+        }
+
+        return std::unique_ptr<RoomBlueprint>();
+    }
+
+    void RoomStreamer::prepareNext() {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        // getRoom() may have taken it already.
+        if(queue.empty()) {
+            return;
+        }
+
+        const unsigned int index = queue.front();
+        queue.pop_front();
+        working = true;
+        workingIndex = index;
+
+        lock.unlock();
+        auto blueprint = prepare(index);
+        lock.lock();
+
+        if(blueprint) {
+            prepared[index] = std::move(blueprint);
+        }
+
+        working = false;
+        condition.notify_all();
+    }
+
+} // hikari
@@ -0,0 +1,484 @@
+#include "hikari/core/game/map/StageCompiler.hpp"
+#include "hikari/core/game/map/Force.hpp"
+#include "hikari/core/game/map/Room.hpp"
+#include "hikari/core/game/map/RoomBlueprint.hpp"
+#include "hikari/core/game/map/RoomTransition.hpp"
+#include "hikari/core/game/map/StageWriter.hpp"
+#include "hikari/client/game/objects/BlockSequenceDescriptor.hpp"
+#include "hikari/client/game/objects/BlockTiming.hpp"
+#include "hikari/core/geom/BoundingBox.hpp"
+#include "hikari/core/util/Log.hpp"
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace hikari {
+
+    const char* StageCompiler::PROP_TILESET = "tileset";
+    const char* StageCompiler::PROP_GRIDSIZE = "gridsize";
+    const char* StageCompiler::PROP_MUSICNAME = "musicName";
+    const char* StageCompiler::PROP_ROOMS = "rooms";
+    const char* StageCompiler::PROP_SPECIAL_ROOMS = "specialRooms";
+    const char* StageCompiler::PROP_SPECIAL_ROOM_STARTING = "starting";
+    const char* StageCompiler::PROP_SPECIAL_ROOM_MIDPOINT = "midpoint";
+    const char* StageCompiler::PROP_SPECIAL_ROOM_BOSS_CORRIDOR = "bossCorridor";
+    const char* StageCompiler::PROP_SPECIAL_ROOM_BOSS_CHAMBER = "bossChamber";
+    const char* StageCompiler::PROP_BOSS_ENTITY = "bossEntity";
+    const char* StageCompiler::PROP_ROOM_ID = "id";
+    const char* StageCompiler::PROP_ROOM_X = "x";
+    const char* StageCompiler::PROP_ROOM_Y = "y";
+    const char* StageCompiler::PROP_ROOM_HERO_SPAWN_X = "heroSpawnX";
+    const char* StageCompiler::PROP_ROOM_HERO_SPAWN_Y = "heroSpawnY";
+    const char* StageCompiler::PROP_ROOM_WIDTH = "width";
+    const char* StageCompiler::PROP_ROOM_HEIGHT = "height";
+    const char* StageCompiler::PROP_ROOM_BG_COLOR = "backgroundColor";
+    const char* StageCompiler::PROP_ROOM_CAMERABOUNDS = "cameraBounds";
+    const char* StageCompiler::PROP_ROOM_CAMERABOUNDS_X = "x";
+    const char* StageCompiler::PROP_ROOM_CAMERABOUNDS_Y = "y";
+    const char* StageCompiler::PROP_ROOM_CAMERABOUNDS_WIDTH = "width";
+    const char* StageCompiler::PROP_ROOM_CAMERABOUNDS_HEIGHT = "height";
+    const char* StageCompiler::PROP_ROOM_TILE = "tile";
+    const char* StageCompiler::PROP_ROOM_TILEATTRIBUTES = "attr";
+    const char* StageCompiler::PROP_ROOM_ENEMIES = "enemies";
+    const char* StageCompiler::PROP_ROOM_ENEMIES_TYPE = "type";
+    const char* StageCompiler::PROP_ROOM_ENEMIES_POSITION = "position";
+    const char* StageCompiler::PROP_ROOM_ENEMIES_POSITION_X = "x";
+    const char* StageCompiler::PROP_ROOM_ENEMIES_POSITION_Y = "y";
+    const char* StageCompiler::PROP_ROOM_ENEMIES_DIRECTION = "direction";
+    const char* StageCompiler::PROP_ROOM_ITEMS = "items";
+    const char* StageCompiler::PROP_ROOM_ITEMS_TYPE = "type";
+    const char* StageCompiler::PROP_ROOM_ITEMS_X = "x";
+    const char* StageCompiler::PROP_ROOM_ITEMS_Y = "y";
+    const char* StageCompiler::PROP_ROOM_TRANSITIONS = "transitions";
+    const char* StageCompiler::PROP_ROOM_DOORS = "doors";
+    const char* StageCompiler::PROP_ROOM_DOORS_X = "x";
+    const char* StageCompiler::PROP_ROOM_DOORS_Y = "y";
+    const char* StageCompiler::PROP_ROOM_DOORS_WIDTH = "width";
+    const char* StageCompiler::PROP_ROOM_DOORS_HEIGHT = "height";
+    const char* StageCompiler::PROP_ROOM_DOORS_ENTRANCE = "entrance";
+    const char* StageCompiler::PROP_ROOM_DOORS_EXIT = "exit";
+    const char* StageCompiler::PROP_ROOM_BLOCKSEQUENCES = "blockSequences";
+    const char* StageCompiler::PROP_ROOM_BLOCKSEQUENCES_X = "x";
+    const char* StageCompiler::PROP_ROOM_BLOCKSEQUENCES_Y = "y";
+    const char* StageCompiler::PROP_ROOM_BLOCKSEQUENCES_WIDTH = "width";
+    const char* StageCompiler::PROP_ROOM_BLOCKSEQUENCES_HEIGHT = "height";
+    const char* StageCompiler::PROP_ROOM_BLOCKSEQUENCES_BLOCKS = "blocks";
+    const char* StageCompiler::PROP_ROOM_BLOCKSEQUENCES_SEQUENCE = "sequence";
+    const char* StageCompiler::PROP_ROOM_BLOCKSEQUENCES_INTERVAL = "interval";
+    const char* StageCompiler::PROP_ROOM_BLOCKSEQUENCES_MAXIMUM_BLOCK_AGE = "maximumBlockAge";
+    const char* StageCompiler::PROP_ROOM_BLOCKSEQUENCES_ENTITY = "entity";
+    const char* StageCompiler::PROP_ROOM_BLOCKSEQUENCES_SPAWN_SOUND = "spawnSound";
+
+    const int StageCompiler::DEFAULT_HERO_SPAWN_X = 0;
+    const int StageCompiler::DEFAULT_HERO_SPAWN_Y = 0;
+
+    StageCompiler::StageCompiler() { }
+
+    std::vector<char> StageCompiler::compile(const Json::Value &json) const {
+        validateMapStructure(json);
+
+        const StageInfo info = readStageInfo(json);
+        const Json::Value & roomsJson = json[PROP_ROOMS];
+        const int roomCount = roomsJson.size();
+
+        StageWriter writer(info);
+
+        for(int i = 0; i < roomCount; ++i) {
+            writer.addRoom(*prepareRoom(roomsJson[i], info.gridSize));
+        }
+
+        return writer.write();
+    }
+
+    StageInfo StageCompiler::readStageInfo(const Json::Value &json) const {
+        StageInfo info;
+
+        info.tilesetName = json[PROP_TILESET].asString();
+        info.gridSize = json[PROP_GRIDSIZE].asInt();
+        info.musicName = json.get(PROP_MUSICNAME, "None").asString();
+        info.bossEntity = json.get(PROP_BOSS_ENTITY, "None").asString();
+
+        //
+        // Determine special room indicies
+        //
+        const auto & specialRoomIndicies = json[PROP_SPECIAL_ROOMS];
+
+        if(!specialRoomIndicies.isNull()) {
+            info.startingRoomIndex     = specialRoomIndicies.get(PROP_SPECIAL_ROOM_STARTING,      0).asInt();
+            info.midpointRoomIndex     = specialRoomIndicies.get(PROP_SPECIAL_ROOM_MIDPOINT,      0).asInt();
+            info.bossCorridorRoomIndex = specialRoomIndicies.get(PROP_SPECIAL_ROOM_BOSS_CORRIDOR, 0).asInt();
+            info.bossChamberRoomIndex  = specialRoomIndicies.get(PROP_SPECIAL_ROOM_BOSS_CHAMBER,  0).asInt();
+        }
+
+        return info;
+    }
+
+    std::unique_ptr<RoomBlueprint> StageCompiler::prepareRoom(const Json::Value &json, int gridSize) const {
+        std::unique_ptr<RoomBlueprint> blueprint(new RoomBlueprint());
+
+        int x               = json[PROP_ROOM_X].asInt();
+        int y               = json[PROP_ROOM_Y].asInt();
+        int width           = json[PROP_ROOM_WIDTH].asInt();
+        int height          = json[PROP_ROOM_HEIGHT].asInt();
+        int heroSpawnX      = json.get(PROP_ROOM_HERO_SPAWN_X, DEFAULT_HERO_SPAWN_X).asInt();
+        int heroSpawnY      = json.get(PROP_ROOM_HERO_SPAWN_Y, DEFAULT_HERO_SPAWN_Y).asInt();
+        int transitionCount = json[PROP_ROOM_TRANSITIONS].size();
+        int blockSequenceCount = 0;
+
+        blueprint->id                = json[PROP_ROOM_ID].asInt();
+        blueprint->x                 = x;
+        blueprint->y                 = y;
+        blueprint->width             = width;
+        blueprint->height            = height;
+        blueprint->gridSize          = gridSize;
+        blueprint->backgroundColor   = json.get(PROP_ROOM_BG_COLOR, Room::DEFAULT_BG_COLOR).asInt();
+        blueprint->heroSpawnPosition = Point2D<int>(heroSpawnX, heroSpawnY);
+        blueprint->cameraBounds      = constructCameraBounds(json[PROP_ROOM_CAMERABOUNDS], x, y, gridSize);
+        blueprint->bossEntity        = json.get(PROP_BOSS_ENTITY, "None").asString();
+
+        //
+        // Store tiles and attributes
+        //
+        std::vector<int> & tile = blueprint->tile;
+        std::vector<int> & attr = blueprint->attr;
+
+        tile.assign(width * height, 0);
+        attr.assign(width * height, 0);
+
+        const auto & tileArray = json[PROP_ROOM_TILE];
+        const auto & attrArray = json[PROP_ROOM_TILEATTRIBUTES];
+
+        for(int ty = 0; ty < height; ++ty) {
+            for(int tx = 0; tx < width; ++tx) {
+                int offset = tx + (ty * width);
+                tile[offset] = tileArray[offset].asInt();
+                attr[offset] = attrArray[offset].asInt();
+            }
+        }
+
+        // The origin of the room, in pixels, for relative object offsets.
+        int roomOriginX = x * gridSize;
+        int roomOriginY = y * gridSize;
+
+        HIKARI_LOG(debug4) << "Room origin: (" << roomOriginX << ", " << roomOriginY << ")";
+
+        //
+        // Spawners and doors are built in finishRoom()
+        //
+        const auto & enemyArray = json[PROP_ROOM_ENEMIES];
+        const auto & itemArray = json[PROP_ROOM_ITEMS];
+
+        for(std::size_t enemyIndex = 0; enemyIndex < enemyArray.size(); ++enemyIndex) {
+            blueprint->enemies.push_back(readSpawner(enemyArray[static_cast<int>(enemyIndex)]));
+        }
+
+        for(std::size_t itemIndex = 0; itemIndex < itemArray.size(); ++itemIndex) {
+            blueprint->items.push_back(readSpawner(itemArray[static_cast<int>(itemIndex)]));
+        }
+
+        if(json.isMember(PROP_ROOM_DOORS)) {
+            HIKARI_LOG(debug4) << "The room has doors array.";
+            const auto & doorsJson = json[PROP_ROOM_DOORS];
+
+            if(doorsJson.size() > 0) {
+                if(doorsJson.isMember(PROP_ROOM_DOORS_ENTRANCE)) {
+                    HIKARI_LOG(debug4) << "The room has an entrance.";
+                    blueprint->entranceDoor = readDoor(doorsJson[PROP_ROOM_DOORS_ENTRANCE]);
+                }
+
+                if(doorsJson.isMember(PROP_ROOM_DOORS_EXIT)) {
+                    HIKARI_LOG(debug4) << "The room has an exit.";
+                    blueprint->exitDoor = readDoor(doorsJson[PROP_ROOM_DOORS_EXIT]);
+                }
+            } else {
+                HIKARI_LOG(debug4) << "The room has no door definitions.";
+            }
+        }
+
+        //
+        // Construct forces
+        //
+        const auto & forceArray = json["forces"];
+
+        if(forceArray.size() > 0) {
+            HIKARI_LOG(debug) << "Found " << forceArray.size() << " force declarations.";
+            for(std::size_t forceIndex = 0; forceIndex < forceArray.size(); ++forceIndex) {
+                blueprint->forces.emplace_back(
+                    constructForce(
+                        forceArray[forceIndex],
+                        roomOriginX,
+                        roomOriginY
+                    )
+                );
+            }
+        }
+
+        //
+        // Construct transitions
+        //
+        for(int i = 0; i < transitionCount; ++i) {
+            blueprint->transitions.emplace_back(constructTransition(json[PROP_ROOM_TRANSITIONS][i]));
+        }
+
+        //
+        // Construct block sequences
+        //
+        if(json[PROP_ROOM_BLOCKSEQUENCES].isArray()) {
+            blockSequenceCount = json[PROP_ROOM_BLOCKSEQUENCES].size();
+        }
+
+        for(int i = 0; i < blockSequenceCount; ++i) {
+            blueprint->blockSequences.emplace_back(
+                constructBlockSequence(
+                    json[PROP_ROOM_BLOCKSEQUENCES][i],
+                    roomOriginX,
+                    roomOriginY,
+                    gridSize
+                )
+            );
+        }
+
+        return blueprint;
+    }
+
+    std::vector<std::unique_ptr<RoomBlueprint>> StageCompiler::prepareRooms(const Json::Value &json) const {
+        const StageInfo info = readStageInfo(json);
+        const Json::Value & roomsJson = json[PROP_ROOMS];
+        const int roomCount = roomsJson.size();
+
+        std::vector<std::unique_ptr<RoomBlueprint>> rooms;
+        rooms.reserve(roomCount);
+
+        for(int i = 0; i < roomCount; ++i) {
+            rooms.push_back(prepareRoom(roomsJson[i], info.gridSize));
+        }
+
+        return rooms;
+    }
+
+    DoorBlueprint StageCompiler::readDoor(const Json::Value & json) const {
+        DoorBlueprint door;
+
+        door.present = true;
+        door.x = json.get(PROP_ROOM_DOORS_X, 0).asInt();
+        door.y = json.get(PROP_ROOM_DOORS_Y, 0).asInt();
+        door.width = json.get(PROP_ROOM_DOORS_WIDTH, 1).asInt();
+        door.height = json.get(PROP_ROOM_DOORS_HEIGHT, 3).asInt();
+
+        return door;
+    }
+
+    SpawnerBlueprint StageCompiler::readSpawner(const Json::Value &json) const {
+        SpawnerBlueprint spawner;
+
+        auto dirString = json.get(PROP_ROOM_ENEMIES_DIRECTION, "None").asString();
+
+        spawner.type       = json[PROP_ROOM_ENEMIES_TYPE].asString();
+        spawner.position   = Point2D<int>(
+                                json[PROP_ROOM_ENEMIES_POSITION_X].asInt(),
+                                json[PROP_ROOM_ENEMIES_POSITION_Y].asInt()
+                             );
+        spawner.direction  = (dirString == "Up" ? Directions::Up :
+                                (dirString == "Right" ? Directions::Right :
+                                    (dirString == "Down" ? Directions::Down :
+                                        (dirString == "Left" ? Directions::Left :
+                                            Directions::None)
+                                        )
+                                    )
+                                );
+        spawner.spawnLimit = json.get("spawnLimit", 1).asUInt();
+        spawner.spawnRate  = static_cast<float>(json.get("spawnRate", 1.0).asDouble());
+
+        if(json.isMember("continuous")) {
+            spawner.hasContinuous = true;
+            spawner.continuous = json["continuous"].asBool();
+        }
+
+        if(json.isMember("config")) {
+            spawner.hasConfig = true;
+            spawner.config = json["config"];
+        }
+
+        return spawner;
+    }
+
+    std::shared_ptr<Force> StageCompiler::constructForce(const Json::Value &json, int offsetX, int offsetY) const {
+        HIKARI_LOG(debug4) << "constructForce offset: (" << offsetX << ", " << offsetY << ")";
+
+        auto x = json["x"].asInt();
+        auto y = json["y"].asInt();
+        auto width = json["width"].asInt();
+        auto height = json["height"].asInt();
+        auto vX = json.get("velocityX", 0.0f).asFloat();
+        auto vY = json.get("velocityY", 0.0f).asFloat();
+
+        auto force = std::make_shared<Force>(
+            BoundingBox<float>(
+                static_cast<float>(x),
+                static_cast<float>(y),
+                static_cast<float>(width),
+                static_cast<float>(height)
+            ),
+            Vector2<float>(vX, vY)
+        );
+
+        return force;
+    }
+
+    RoomTransition StageCompiler::constructTransition(const Json::Value &json) const {
+        bool isDoor = json.get("door", false).asBool();
+        bool ladderOnly = json.get("ladderOnly", false).asBool();
+
+        // TODO: Do we need this?
+        int from = -1;
+
+        int to = json["to"].asInt();
+        int width = json["width"].asInt();
+        int height = json["height"].asInt();
+        int x = json["x"].asInt();
+        int y = json["y"].asInt();
+        RoomTransition::Direction dir;
+
+        std::string dirString = json["direction"].asString();
+
+        if(dirString == "forward") {
+            dir = RoomTransition::DirectionForward;
+        } else if(dirString == "backward") {
+            dir = RoomTransition::DirectionBackward;
+        } else if(dirString == "up") {
+            dir = RoomTransition::DirectionUp;
+        } else if(dirString == "down") {
+            dir = RoomTransition::DirectionDown;
+        } else {
+            // All other values are "transport" equivalents.
+            dir = RoomTransition::DirectionTeleport;
+        }
+
+        return RoomTransition(from, to, width, height, x, y, dir, isDoor, ladderOnly);
+    }
+
+    BlockSequenceDescriptor StageCompiler::constructBlockSequence(const Json::Value &json,
+        int roomX, int roomY, int gridSize) const {
+        const int x = roomX + json[PROP_ROOM_BLOCKSEQUENCES_X].asInt() * gridSize;
+        const int y = roomY + json[PROP_ROOM_BLOCKSEQUENCES_Y].asInt() * gridSize;
+        const int width = json[PROP_ROOM_BLOCKSEQUENCES_WIDTH].asInt() * gridSize;
+        const int height = json[PROP_ROOM_BLOCKSEQUENCES_HEIGHT].asInt() * gridSize;
+
+        const float spawnInterval = json.get(
+            PROP_ROOM_BLOCKSEQUENCES_INTERVAL,
+            BlockSequenceDescriptor::DEFAULT_SPAWN_INTERVAL
+        ).asFloat();
+        const float maximumBlockAge = json.get(
+            PROP_ROOM_BLOCKSEQUENCES_MAXIMUM_BLOCK_AGE,
+            BlockSequenceDescriptor::DEFAULT_MAXIMUM_BLOCK_AGE
+        ).asFloat();
+
+        const std::string entityName = json.get(
+            PROP_ROOM_BLOCKSEQUENCES_ENTITY,
+            BlockSequenceDescriptor::DEFAULT_BLOCK_ENTITY
+        ).asString();
+        const std::string spawnSound = json.get(
+            PROP_ROOM_BLOCKSEQUENCES_SPAWN_SOUND,
+            BlockSequenceDescriptor::DEFAULT_SPAWN_SOUND
+        ).asString();
+
+        std::vector<Point2D<int>> blockPositions;
+        std::vector<BlockTiming> timing;
+
+        const auto & blockJson = json[PROP_ROOM_BLOCKSEQUENCES_BLOCKS];
+
+        if(blockJson.isArray()) {
+            const std::size_t length = blockJson.size();
+
+            for(std::size_t i = 0; i < length; ++i) {
+                const auto & block = blockJson[i];
+                int blockX = x + block[PROP_ROOM_BLOCKSEQUENCES_X].asInt() * gridSize;
+                int blockY = y + block[PROP_ROOM_BLOCKSEQUENCES_Y].asInt() * gridSize;
+
+                blockPositions.push_back(Point2D<int>(blockX, blockY));
+            }
+        }
+
+        const auto & sequenceJson = json[PROP_ROOM_BLOCKSEQUENCES_SEQUENCE];
+
+        if(sequenceJson.isArray()) {
+            const std::size_t length = sequenceJson.size();
+
+            for(std::size_t i = 0; i < length; ++i) {
+                const auto & blockIndiciesJson = sequenceJson[i];
+
+                std::vector<int> indicies;
+
+                for(std::size_t index = 0; index < blockIndiciesJson.size(); ++index) {
+                    const auto & id = blockIndiciesJson[index].asInt();
+                    indicies.push_back(id);
+                }
+
+                timing.push_back(BlockTiming(indicies));
+            }
+        }
+
+        return BlockSequenceDescriptor(
+            Rectangle2D<int>(x, y, width, height),
+            blockPositions,
+            timing,
+            spawnInterval,
+            maximumBlockAge,
+            entityName,
+            spawnSound
+        );
+    }
+
+    Rectangle2D<int> StageCompiler::constructCameraBounds(const Json::Value &json,
+            int roomX, int roomY, int gridSize) const {
+        int x = (roomX + json[PROP_ROOM_CAMERABOUNDS_X].asInt()) * gridSize;
+        int y = (roomY + json[PROP_ROOM_CAMERABOUNDS_Y].asInt()) * gridSize;
+        int width = json[PROP_ROOM_CAMERABOUNDS_WIDTH].asInt() * gridSize;
+        int height = json[PROP_ROOM_CAMERABOUNDS_HEIGHT].asInt() * gridSize;
+
+        return Rectangle2D<int>(x, y, width, height);
+    }
+
+    bool StageCompiler::validateMapStructure(const Json::Value &json) const {
+        bool isValid = true;
+
+        // Root must be an object
+        if(!json.isObject()) {
+            isValid = false;
+        }
+
+        // Root must contain a string property called "tileset"
+        if(!json[PROP_TILESET].isString()) {
+            isValid = false;
+        }
+
+        if(!json[PROP_GRIDSIZE].isNumeric()) {
+            isValid = false;
+        }
+
+        // Root must contain an array property called "rooms"
+        if(!json[PROP_ROOMS].isArray()) {
+            isValid = false;
+        }
+
+        // Validate rooms here
+
+        if(!isValid) {
+            throw std::runtime_error("JSON structure is not a valid Map.");
+        }
+
+        return isValid;
+    }
+
+    bool StageCompiler::validateRoomStructure(const Json::Value &json) const {
+        bool isValid = true;
+
+        // Root must be an object
+        if(!json.isObject()) {
+            isValid = false;
+        }
+
+        return isValid;
+    }
+
+} // hikari
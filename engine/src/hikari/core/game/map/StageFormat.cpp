@@ -0,0 +1,22 @@
+#include "hikari/core/game/map/StageFormat.hpp"
+
+namespace hikari {
+
+    const char StageFormat::MAGIC[4] = { 'H', 'K', 'S', 'T' };
+    const std::uint32_t StageFormat::VERSION = 1;
+    const char * StageFormat::FILE_EXTENSION = ".stage";
+
+    StageInfo::StageInfo()
+        : tilesetName()
+        , gridSize(0)
+        , musicName("None")
+        , bossEntity("None")
+        , startingRoomIndex(0)
+        , midpointRoomIndex(0)
+        , bossCorridorRoomIndex(0)
+        , bossChamberRoomIndex(0)
+    {
+
+    }
+
+} // hikari
@@ -0,0 +1,292 @@
+#include "hikari/core/game/map/StageReader.hpp"
+#include "hikari/core/game/map/Force.hpp"
+#include "hikari/core/game/map/RoomBlueprint.hpp"
+
+#include <json/reader.h>
+
+#include <cstring>
+#include <stdexcept>
+
+namespace hikari {
+
+    namespace {
+        const char * CORRUPT_STAGE_MESSAGE = "Stage data is corrupt.";
+
+        Rectangle2D<int> toRectangle(const StageFormat::RectRecord & record) {
+            return Rectangle2D<int>(record.x, record.y, record.width, record.height);
+        }
+    }
+
+    StageReader::StageReader(std::vector<char> && data)
+        : data(std::move(data))
+        , header()
+        , info()
+    {
+        if(this->data.size() < sizeof(header)) {
+            throw std::runtime_error("Stage data is too short.");
+        }
+
+        std::memcpy(&header, &this->data[0], sizeof(header));
+
+        if(std::memcmp(header.magic, StageFormat::MAGIC, sizeof(header.magic)) != 0) {
+            throw std::runtime_error("Stage data has an unknown format.");
+        }
+
+        if(header.version != StageFormat::VERSION) {
+            throw std::runtime_error("Stage data was written for another version.");
+        }
+
+        static const std::uint32_t recordSizes[StageFormat::SECTION_COUNT] = {
+            sizeof(char),
+            sizeof(StageFormat::RoomRecord),
+            sizeof(std::int16_t),
+            sizeof(std::int16_t),
+            sizeof(StageFormat::TransitionRecord),
+            sizeof(StageFormat::ForceRecord),
+            sizeof(StageFormat::SpawnerRecord),
+            sizeof(StageFormat::BlockSequenceRecord),
+            sizeof(StageFormat::PointRecord),
+            sizeof(StageFormat::Range),
+            sizeof(std::int32_t)
+        };
+
+        for(int section = 0; section < StageFormat::SECTION_COUNT; ++section) {
+            const StageFormat::SectionEntry & entry = header.sections[section];
+            const std::uint64_t end = static_cast<std::uint64_t>(entry.offset)
+                + static_cast<std::uint64_t>(entry.count) * entry.recordSize;
+
+            if(entry.recordSize != recordSizes[section] || end > this->data.size()) {
+                throw std::runtime_error(CORRUPT_STAGE_MESSAGE);
+            }
+        }
+
+        info.tilesetName = readString(header.tilesetName);
+        info.gridSize = header.gridSize;
+        info.musicName = readString(header.musicName);
+        info.bossEntity = readString(header.bossEntity);
+        info.startingRoomIndex = header.startingRoomIndex;
+        info.midpointRoomIndex = header.midpointRoomIndex;
+        info.bossCorridorRoomIndex = header.bossCorridorRoomIndex;
+        info.bossChamberRoomIndex = header.bossChamberRoomIndex;
+    }
+
+    template <typename T>
+    T StageReader::readRecord(StageFormat::Section section, std::uint32_t index) const {
+        const StageFormat::SectionEntry & entry = header.sections[section];
+
+        if(index >= entry.count) {
+            throw std::runtime_error(CORRUPT_STAGE_MESSAGE);
+        }
+
+        T record;
+        std::memcpy(&record, &data[entry.offset + index * sizeof(T)], sizeof(T));
+        return record;
+    }
+
+    void StageReader::checkRange(StageFormat::Section section, std::uint32_t first, std::uint32_t count) const {
+        if(static_cast<std::uint64_t>(first) + count > header.sections[section].count) {
+            throw std::runtime_error(CORRUPT_STAGE_MESSAGE);
+        }
+    }
+
+    std::string StageReader::readString(const StageFormat::StringRef & ref) const {
+        checkRange(StageFormat::SECTION_STRINGS, ref.offset, ref.length);
+
+        const char * first = &data[0] + header.sections[StageFormat::SECTION_STRINGS].offset + ref.offset;
+        return std::string(first, first + ref.length);
+    }
+
+    void StageReader::readSpawners(const StageFormat::Range & range, std::vector<SpawnerBlueprint> & blueprints) const {
+        checkRange(StageFormat::SECTION_SPAWNERS, range.first, range.count);
+        blueprints.resize(range.count);
+
+        for(std::uint32_t i = 0; i < range.count; ++i) {
+            const auto record = readRecord<StageFormat::SpawnerRecord>(StageFormat::SECTION_SPAWNERS, range.first + i);
+            SpawnerBlueprint & blueprint = blueprints[i];
+
+            blueprint.type = readString(record.type);
+            blueprint.position = Point2D<int>(record.position.x, record.position.y);
+            blueprint.direction = record.direction;
+            blueprint.spawnLimit = record.spawnLimit;
+            blueprint.spawnRate = record.spawnRate;
+            blueprint.hasContinuous = (record.flags & StageFormat::SPAWNER_HAS_CONTINUOUS) != 0;
+            blueprint.continuous = (record.flags & StageFormat::SPAWNER_CONTINUOUS) != 0;
+            blueprint.hasConfig = (record.flags & StageFormat::SPAWNER_HAS_CONFIG) != 0;
+
+            // Configs are free-form, so they're the one thing kept as JSON.
+            if(blueprint.hasConfig && record.config.length > 0) {
+                checkRange(StageFormat::SECTION_STRINGS, record.config.offset, record.config.length);
+
+                const char * first = &data[0] + header.sections[StageFormat::SECTION_STRINGS].offset + record.config.offset;
+                Json::Reader reader;
+
+                if(!reader.parse(first, first + record.config.length, blueprint.config, false)) {
+                    throw std::runtime_error(CORRUPT_STAGE_MESSAGE);
+                }
+            }
+        }
+    }
+
+    void StageReader::readDoor(const StageFormat::DoorRecord & record, DoorBlueprint & blueprint) const {
+        blueprint.present = record.present != 0;
+        blueprint.x = record.bounds.x;
+        blueprint.y = record.bounds.y;
+        blueprint.width = record.bounds.width;
+        blueprint.height = record.bounds.height;
+    }
+
+    const StageInfo & StageReader::getInfo() const {
+        return info;
+    }
+
+    unsigned int StageReader::getRoomCount() const {
+        return header.sections[StageFormat::SECTION_ROOMS].count;
+    }
+
+    Rectangle2D<int> StageReader::getRoomRect(unsigned int index) const {
+        const auto room = readRecord<StageFormat::RoomRecord>(StageFormat::SECTION_ROOMS, index);
+        const int gridSize = info.gridSize;
+
+        return Rectangle2D<int>(room.x * gridSize, room.y * gridSize, room.width * gridSize, room.height * gridSize);
+    }
+
+    std::unique_ptr<RoomBlueprint> StageReader::readRoom(unsigned int index) const {
+        const auto room = readRecord<StageFormat::RoomRecord>(StageFormat::SECTION_ROOMS, index);
+        std::unique_ptr<RoomBlueprint> blueprint(new RoomBlueprint());
+
+        if(room.width < 0 || room.height < 0) {
+            throw std::runtime_error(CORRUPT_STAGE_MESSAGE);
+        }
+
+        blueprint->id                = room.id;
+        blueprint->x                 = room.x;
+        blueprint->y                 = room.y;
+        blueprint->width             = room.width;
+        blueprint->height            = room.height;
+        blueprint->gridSize          = info.gridSize;
+        blueprint->backgroundColor   = room.backgroundColor;
+        blueprint->heroSpawnPosition = Point2D<int>(room.heroSpawnPosition.x, room.heroSpawnPosition.y);
+        blueprint->cameraBounds      = toRectangle(room.cameraBounds);
+        blueprint->bossEntity        = readString(room.bossEntity);
+
+        //
+        // Tile and attribute planes are copied straight out of the file
+        //
+        const std::uint32_t cellCount = static_cast<std::uint32_t>(room.width) * static_cast<std::uint32_t>(room.height);
+
+        checkRange(StageFormat::SECTION_TILES, room.firstCell, cellCount);
+        checkRange(StageFormat::SECTION_ATTRIBUTES, room.firstCell, cellCount);
+
+        const std::int16_t * tiles = reinterpret_cast<const std::int16_t *>(
+            &data[0] + header.sections[StageFormat::SECTION_TILES].offset) + room.firstCell;
+        const std::int16_t * attributes = reinterpret_cast<const std::int16_t *>(
+            &data[0] + header.sections[StageFormat::SECTION_ATTRIBUTES].offset) + room.firstCell;
+
+        blueprint->tile.assign(tiles, tiles + cellCount);
+        blueprint->attr.assign(attributes, attributes + cellCount);
+
+        //
+        // Transitions
+        //
+        checkRange(StageFormat::SECTION_TRANSITIONS, room.transitions.first, room.transitions.count);
+        blueprint->transitions.reserve(room.transitions.count);
+
+        for(std::uint32_t i = 0; i < room.transitions.count; ++i) {
+            const auto record = readRecord<StageFormat::TransitionRecord>(
+                StageFormat::SECTION_TRANSITIONS, room.transitions.first + i);
+
+            blueprint->transitions.push_back(
+                RoomTransition(
+                    -1,
+                    record.to,
+                    record.bounds.width,
+                    record.bounds.height,
+                    record.bounds.x,
+                    record.bounds.y,
+                    static_cast<RoomTransition::Direction>(record.direction),
+                    (record.flags & StageFormat::TRANSITION_DOOR) != 0,
+                    (record.flags & StageFormat::TRANSITION_LADDER_ONLY) != 0
+                )
+            );
+        }
+
+        //
+        // Forces
+        //
+        checkRange(StageFormat::SECTION_FORCES, room.forces.first, room.forces.count);
+        blueprint->forces.reserve(room.forces.count);
+
+        for(std::uint32_t i = 0; i < room.forces.count; ++i) {
+            const auto record = readRecord<StageFormat::ForceRecord>(StageFormat::SECTION_FORCES, room.forces.first + i);
+
+            blueprint->forces.push_back(
+                std::make_shared<Force>(
+                    BoundingBox<float>(record.x, record.y, record.width, record.height),
+                    Vector2<float>(record.velocityX, record.velocityY)
+                )
+            );
+        }
+
+        //
+        // Spawners and doors
+        //
+        readSpawners(room.enemies, blueprint->enemies);
+        readSpawners(room.items, blueprint->items);
+        readDoor(room.entranceDoor, blueprint->entranceDoor);
+        readDoor(room.exitDoor, blueprint->exitDoor);
+
+        //
+        // Block sequences
+        //
+        checkRange(StageFormat::SECTION_BLOCK_SEQUENCES, room.blockSequences.first, room.blockSequences.count);
+        blueprint->blockSequences.reserve(room.blockSequences.count);
+
+        for(std::uint32_t i = 0; i < room.blockSequences.count; ++i) {
+            const auto record = readRecord<StageFormat::BlockSequenceRecord>(
+                StageFormat::SECTION_BLOCK_SEQUENCES, room.blockSequences.first + i);
+
+            checkRange(StageFormat::SECTION_BLOCKS, record.blocks.first, record.blocks.count);
+            checkRange(StageFormat::SECTION_BLOCK_STEPS, record.steps.first, record.steps.count);
+
+            std::vector<Point2D<int>> blockPositions;
+            std::vector<BlockTiming> timing;
+
+            blockPositions.reserve(record.blocks.count);
+            timing.reserve(record.steps.count);
+
+            for(std::uint32_t block = 0; block < record.blocks.count; ++block) {
+                const auto position = readRecord<StageFormat::PointRecord>(
+                    StageFormat::SECTION_BLOCKS, record.blocks.first + block);
+
+                blockPositions.push_back(Point2D<int>(position.x, position.y));
+            }
+
+            for(std::uint32_t step = 0; step < record.steps.count; ++step) {
+                const auto indices = readRecord<StageFormat::Range>(
+                    StageFormat::SECTION_BLOCK_STEPS, record.steps.first + step);
+
+                checkRange(StageFormat::SECTION_BLOCK_INDICES, indices.first, indices.count);
+
+                const std::int32_t * first = reinterpret_cast<const std::int32_t *>(
+                    &data[0] + header.sections[StageFormat::SECTION_BLOCK_INDICES].offset) + indices.first;
+
+                timing.push_back(BlockTiming(std::vector<int>(first, first + indices.count)));
+            }
+
+            blueprint->blockSequences.push_back(
+                BlockSequenceDescriptor(
+                    toRectangle(record.bounds),
+                    blockPositions,
+                    timing,
+                    record.spawnInterval,
+                    record.maximumBlockAge,
+                    readString(record.entityName),
+                    readString(record.soundName)
+                )
+            );
+        }
+
+        return blueprint;
+    }
+
+} // hikari
@@ -0,0 +1,314 @@
+#include "hikari/core/game/map/StageWriter.hpp"
+#include "hikari/core/game/map/Force.hpp"
+#include "hikari/core/game/map/RoomBlueprint.hpp"
+
+#include <json/writer.h>
+
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace hikari {
+
+    namespace {
+        StageFormat::RectRecord makeRect(int x, int y, int width, int height) {
+            StageFormat::RectRecord record;
+            record.x = x;
+            record.y = y;
+            record.width = width;
+            record.height = height;
+            return record;
+        }
+
+        StageFormat::PointRecord makePoint(int x, int y) {
+            StageFormat::PointRecord record;
+            record.x = x;
+            record.y = y;
+            return record;
+        }
+
+        StageFormat::Range makeRange(std::size_t first, std::size_t end) {
+            StageFormat::Range range;
+            range.first = static_cast<std::uint32_t>(first);
+            range.count = static_cast<std::uint32_t>(end - first);
+            return range;
+        }
+
+        std::int16_t narrowCell(int value) {
+            if(value < std::numeric_limits<std::int16_t>::min() || value > std::numeric_limits<std::int16_t>::max()) {
+                throw std::runtime_error("Tile or attribute value doesn't fit in a stage file.");
+            }
+
+            return static_cast<std::int16_t>(value);
+        }
+
+        //
+        // Sections start on a 4-byte boundary so records can be copied out
+        // with aligned loads.
+        //
+        template <typename T>
+        void appendSection(std::vector<char> & output, StageFormat::Header & header,
+            StageFormat::Section section, const std::vector<T> & records)
+        {
+            while(output.size() % 4 != 0) {
+                output.push_back(0);
+            }
+
+            StageFormat::SectionEntry & entry = header.sections[section];
+            entry.offset = static_cast<std::uint32_t>(output.size());
+            entry.count = static_cast<std::uint32_t>(records.size());
+            entry.recordSize = static_cast<std::uint32_t>(sizeof(T));
+
+            if(!records.empty()) {
+                const char * bytes = reinterpret_cast<const char *>(&records[0]);
+                output.insert(std::end(output), bytes, bytes + records.size() * sizeof(T));
+            }
+        }
+    }
+
+    StageWriter::StageWriter(const StageInfo & info)
+        : info(info)
+        , strings()
+        , stringIndex()
+        , rooms()
+        , tiles()
+        , attributes()
+        , transitions()
+        , forces()
+        , spawners()
+        , blockSequences()
+        , blocks()
+        , blockSteps()
+        , blockIndices()
+        , tilesetName()
+        , musicName()
+        , bossEntity()
+    {
+        tilesetName = addString(info.tilesetName);
+        musicName = addString(info.musicName);
+        bossEntity = addString(info.bossEntity);
+    }
+
+    StageFormat::StringRef StageWriter::addString(const std::string & value) {
+        const auto found = stringIndex.find(value);
+
+        if(found != std::end(stringIndex)) {
+            return found->second;
+        }
+
+        StageFormat::StringRef ref;
+        ref.offset = static_cast<std::uint32_t>(strings.size());
+        ref.length = static_cast<std::uint32_t>(value.size());
+
+        strings.insert(std::end(strings), std::begin(value), std::end(value));
+        stringIndex[value] = ref;
+
+        return ref;
+    }
+
+    StageFormat::Range StageWriter::addSpawners(const std::vector<SpawnerBlueprint> & blueprints) {
+        const std::size_t first = spawners.size();
+
+        for(auto it = std::begin(blueprints); it != std::end(blueprints); ++it) {
+            const SpawnerBlueprint & blueprint = *it;
+            StageFormat::SpawnerRecord record;
+
+            record.type = addString(blueprint.type);
+            record.position = makePoint(blueprint.position.getX(), blueprint.position.getY());
+            record.direction = blueprint.direction;
+            record.spawnLimit = blueprint.spawnLimit;
+            record.spawnRate = blueprint.spawnRate;
+            record.flags = 0;
+            record.config = addString("");
+
+            if(blueprint.hasContinuous) {
+                record.flags |= StageFormat::SPAWNER_HAS_CONTINUOUS;
+
+                if(blueprint.continuous) {
+                    record.flags |= StageFormat::SPAWNER_CONTINUOUS;
+                }
+            }
+
+            if(blueprint.hasConfig) {
+                record.flags |= StageFormat::SPAWNER_HAS_CONFIG;
+
+                if(!blueprint.config.isNull()) {
+                    Json::FastWriter writer;
+                    record.config = addString(writer.write(blueprint.config));
+                }
+            }
+
+            spawners.push_back(record);
+        }
+
+        return makeRange(first, spawners.size());
+    }
+
+    StageFormat::DoorRecord StageWriter::makeDoor(const DoorBlueprint & blueprint) const {
+        StageFormat::DoorRecord record;
+        record.present = blueprint.present ? 1 : 0;
+        record.bounds = makeRect(blueprint.x, blueprint.y, blueprint.width, blueprint.height);
+        return record;
+    }
+
+    void StageWriter::addRoom(const RoomBlueprint & room) {
+        StageFormat::RoomRecord record;
+
+        record.id = room.id;
+        record.x = room.x;
+        record.y = room.y;
+        record.width = room.width;
+        record.height = room.height;
+        record.backgroundColor = room.backgroundColor;
+        record.heroSpawnPosition = makePoint(room.heroSpawnPosition.getX(), room.heroSpawnPosition.getY());
+        record.cameraBounds = makeRect(
+            room.cameraBounds.getX(),
+            room.cameraBounds.getY(),
+            room.cameraBounds.getWidth(),
+            room.cameraBounds.getHeight()
+        );
+        record.bossEntity = addString(room.bossEntity);
+
+        //
+        // Tile and attribute planes
+        //
+        const std::size_t cellCount = static_cast<std::size_t>(room.width) * room.height;
+
+        if(room.tile.size() != cellCount || room.attr.size() != cellCount) {
+            throw std::runtime_error("Room tile data doesn't match the room's size.");
+        }
+
+        record.firstCell = static_cast<std::uint32_t>(tiles.size());
+
+        for(std::size_t i = 0; i < cellCount; ++i) {
+            tiles.push_back(narrowCell(room.tile[i]));
+            attributes.push_back(narrowCell(room.attr[i]));
+        }
+
+        //
+        // Transitions
+        //
+        const std::size_t firstTransition = transitions.size();
+
+        for(auto it = std::begin(room.transitions); it != std::end(room.transitions); ++it) {
+            StageFormat::TransitionRecord transition;
+            transition.to = it->getToRegion();
+            transition.bounds = makeRect(it->getX(), it->getY(), it->getWidth(), it->getHeight());
+            transition.direction = it->getDirection();
+            transition.flags = (it->isDoor() ? StageFormat::TRANSITION_DOOR : 0)
+                | (it->isLadderOnly() ? StageFormat::TRANSITION_LADDER_ONLY : 0);
+
+            transitions.push_back(transition);
+        }
+
+        record.transitions = makeRange(firstTransition, transitions.size());
+
+        //
+        // Forces
+        //
+        const std::size_t firstForce = forces.size();
+
+        for(auto it = std::begin(room.forces); it != std::end(room.forces); ++it) {
+            const auto & bounds = (*it)->getBounds();
+            const auto & velocity = (*it)->getVelocity();
+            StageFormat::ForceRecord force;
+
+            force.x = bounds.getLeft();
+            force.y = bounds.getTop();
+            force.width = bounds.getWidth();
+            force.height = bounds.getHeight();
+            force.velocityX = velocity.getX();
+            force.velocityY = velocity.getY();
+
+            forces.push_back(force);
+        }
+
+        record.forces = makeRange(firstForce, forces.size());
+
+        //
+        // Spawners and doors
+        //
+        record.enemies = addSpawners(room.enemies);
+        record.items = addSpawners(room.items);
+        record.entranceDoor = makeDoor(room.entranceDoor);
+        record.exitDoor = makeDoor(room.exitDoor);
+
+        //
+        // Block sequences
+        //
+        const std::size_t firstBlockSequence = blockSequences.size();
+
+        for(auto it = std::begin(room.blockSequences); it != std::end(room.blockSequences); ++it) {
+            StageFormat::BlockSequenceRecord sequence;
+            const auto & bounds = it->getBounds();
+
+            sequence.bounds = makeRect(bounds.getX(), bounds.getY(), bounds.getWidth(), bounds.getHeight());
+            sequence.spawnInterval = it->getSpawnInterval();
+            sequence.maximumBlockAge = it->getMaximumBlockAge();
+            sequence.entityName = addString(it->getEntityName());
+            sequence.soundName = addString(it->getSoundName());
+
+            const std::size_t firstBlock = blocks.size();
+            const auto & positions = it->getBlockPositions();
+
+            for(auto position = std::begin(positions); position != std::end(positions); ++position) {
+                blocks.push_back(makePoint(position->getX(), position->getY()));
+            }
+
+            sequence.blocks = makeRange(firstBlock, blocks.size());
+
+            const std::size_t firstStep = blockSteps.size();
+            const auto & timing = it->getTiming();
+
+            for(auto step = std::begin(timing); step != std::end(timing); ++step) {
+                const std::size_t firstIndex = blockIndices.size();
+                const auto & indices = step->getBlockIndicies();
+
+                blockIndices.insert(std::end(blockIndices), std::begin(indices), std::end(indices));
+                blockSteps.push_back(makeRange(firstIndex, blockIndices.size()));
+            }
+
+            sequence.steps = makeRange(firstStep, blockSteps.size());
+
+            blockSequences.push_back(sequence);
+        }
+
+        record.blockSequences = makeRange(firstBlockSequence, blockSequences.size());
+
+        rooms.push_back(record);
+    }
+
+    std::vector<char> StageWriter::write() const {
+        StageFormat::Header header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, StageFormat::MAGIC, sizeof(header.magic));
+        header.version = StageFormat::VERSION;
+        header.gridSize = info.gridSize;
+        header.startingRoomIndex = info.startingRoomIndex;
+        header.midpointRoomIndex = info.midpointRoomIndex;
+        header.bossCorridorRoomIndex = info.bossCorridorRoomIndex;
+        header.bossChamberRoomIndex = info.bossChamberRoomIndex;
+        header.tilesetName = tilesetName;
+        header.musicName = musicName;
+        header.bossEntity = bossEntity;
+
+        std::vector<char> output(sizeof(header), 0);
+
+        appendSection(output, header, StageFormat::SECTION_STRINGS, strings);
+        appendSection(output, header, StageFormat::SECTION_ROOMS, rooms);
+        appendSection(output, header, StageFormat::SECTION_TILES, tiles);
+        appendSection(output, header, StageFormat::SECTION_ATTRIBUTES, attributes);
+        appendSection(output, header, StageFormat::SECTION_TRANSITIONS, transitions);
+        appendSection(output, header, StageFormat::SECTION_FORCES, forces);
+        appendSection(output, header, StageFormat::SECTION_SPAWNERS, spawners);
+        appendSection(output, header, StageFormat::SECTION_BLOCK_SEQUENCES, blockSequences);
+        appendSection(output, header, StageFormat::SECTION_BLOCKS, blocks);
+        appendSection(output, header, StageFormat::SECTION_BLOCK_STEPS, blockSteps);
+        appendSection(output, header, StageFormat::SECTION_BLOCK_INDICES, blockIndices);
+
+        std::memcpy(&output[0], &header, sizeof(header));
+
+        return output;
+    }
+
+} // hikari
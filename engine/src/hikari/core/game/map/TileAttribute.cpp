@@ -0,0 +1,9 @@
+#include "hikari/core/game/map/TileAttribute.hpp"
+
+namespace hikari {
+
+    bool TileAttribute::hasAttribute(const int &tile, const TileAttribute &attr) {
+        return ((tile & attr) == attr);
+    }
+
+} // hikari
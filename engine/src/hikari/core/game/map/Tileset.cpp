@@ -3,10 +3,6 @@
 
 namespace hikari {
 
-    bool TileAttribute::hasAttribute(const int &tile, const TileAttribute &attr) {
-        return ((tile & attr) == attr);
-    }
-
     Tileset::Tileset(
         const std::shared_ptr<sf::Texture> &texture, 
         const size_t& tileSize, 
@@ -16,8 +12,16 @@ namespace hikari {
         : tileSize(tileSize)
         , tiles(tiles)
         , tileAnimators(tileAnimators)
-        , texture(texture) {
+        , texture(texture)
+        , animatedTiles(tiles.size(), false)
+        , revision(0) {
+        std::for_each(tileAnimators.begin(), tileAnimators.end(), [&](const TileAnimator &animator){
+            const int index = animator.getUpdatedTileIndex();
 
+            if(index >= 0 && static_cast<std::size_t>(index) < animatedTiles.size()) {
+                animatedTiles[index] = true;
+            }
+        });
     }
 
     const size_t& Tileset::getTileSize() const {
@@ -36,10 +40,25 @@ namespace hikari {
         return texture;
     }
 
+    bool Tileset::isTileAnimated(const unsigned int &index) const {
+        return index < animatedTiles.size() && animatedTiles[index];
+    }
+
+    unsigned int Tileset::getRevision() const {
+        return revision;
+    }
+
     void Tileset::update(float delta) {
         if(tileAnimators.size() > 0) {
             std::for_each(tileAnimators.begin(), tileAnimators.end(), [&](TileAnimator &animator){
-                animator.update(delta, tiles.at(animator.getUpdatedTileIndex()));
+                sf::IntRect & tile = tiles.at(animator.getUpdatedTileIndex());
+                const sf::IntRect previous = tile;
+
+                animator.update(delta, tile);
+
+                if(tile != previous) {
+                    revision++;
+                }
             });
         }
     }
@@ -99,13 +99,18 @@ namespace hikari {
         std::vector<sf::IntRect> tiles(numberOfTiles);
         std::vector<TileAnimator> tileAnimators;
 
+        // Tiles (and their animations) are relative to the surface image,
+        // which may have been packed into an atlas page.
+        const TextureRegion surface = imageCache->getRegion(surfaceName);
+        const Point2D<int> sourceOffset(surface.bounds.left, surface.bounds.top);
+
         for(int i = 0; i < numberOfTiles; ++i) {
             const Json::Value &tileJson = json[PROPERTY_NAME_TILES][i];
 
             if(isValidTileJson(tileJson)) {
                 tiles.at(i) = sf::IntRect(
-                    tileJson[PROPERTY_NAME_X].asInt(),
-                    tileJson[PROPERTY_NAME_Y].asInt(),
+                    tileJson[PROPERTY_NAME_X].asInt() + sourceOffset.getX(),
+                    tileJson[PROPERTY_NAME_Y].asInt() + sourceOffset.getY(),
                     tileSize,
                     tileSize
                 );
@@ -113,7 +118,7 @@ namespace hikari {
                 if(isTileAnimated(tileJson)) {
                     try {
                         std::shared_ptr<Animation> tileAnimation;
-                        tileAnimation = animationLoader->loadFromJsonObject(tileJson[PROPERTY_NAME_ANIMATION]);
+                        tileAnimation = animationLoader->loadFromJsonObject(tileJson[PROPERTY_NAME_ANIMATION], sourceOffset);
 
                         if(tileAnimation) {
                             TileAnimator animator(tiles, i);
@@ -133,7 +138,7 @@ namespace hikari {
 
         return TileDataPtr(
             new Tileset(
-                imageCache->get(surfaceName),
+                surface.texture,
                 tileSize,
                 tiles,
                 tileAnimators
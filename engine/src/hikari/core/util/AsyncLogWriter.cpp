@@ -0,0 +1,182 @@
+#include "hikari/core/util/AsyncLogWriter.hpp"
+
+#include <chrono>
+#include <ostream>
+#include <sstream>
+
+namespace hikari {
+
+    const std::size_t AsyncLogWriter::DEFAULT_CAPACITY = 4096;
+    const unsigned int AsyncLogWriter::IDLE_SLEEP_MILLISECONDS = 5;
+
+    namespace {
+        std::size_t roundUpToPowerOfTwo(std::size_t value) {
+            std::size_t result = 2;
+
+            while(result < value) {
+                result <<= 1;
+            }
+
+            return result;
+        }
+    }
+
+    AsyncLogWriter::AsyncLogWriter(std::ostream & outputStream, std::size_t capacity)
+        : outputStream(outputStream)
+        , slots(roundUpToPowerOfTwo(capacity))
+        , mask(slots.size() - 1)
+        , enqueuePosition(0)
+        , dequeuePosition(0)
+        , running(false)
+        , activeProducers(0)
+        , droppedCount(0)
+        , reportedDropCount(0)
+        , batch()
+        , drainThread()
+    {
+        for(std::size_t i = 0; i < slots.size(); ++i) {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    AsyncLogWriter::~AsyncLogWriter() {
+        stop();
+    }
+
+    void AsyncLogWriter::start() {
+        if(!running.exchange(true)) {
+            drainThread = std::thread(&AsyncLogWriter::drainLoop, this);
+        }
+    }
+
+    void AsyncLogWriter::stop() {
+        if(running.exchange(false)) {
+            drainThread.join();
+        }
+
+        // A producer that saw the writer running may still be mid-push.
+        while(activeProducers.load() != 0) {
+            std::this_thread::yield();
+        }
+
+        flush();
+    }
+
+    bool AsyncLogWriter::isRunning() const {
+        return running.load();
+    }
+
+    //
+    // Bounded multi-producer queue; each slot's sequence number tells
+    // producers and the consumer whose turn it is to touch the slot.
+    //
+    bool AsyncLogWriter::push(std::string && message) {
+        std::size_t position = enqueuePosition.load(std::memory_order_relaxed);
+        Slot * slot = nullptr;
+
+        for(;;) {
+            slot = &slots[position & mask];
+
+            const std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+
+            if(difference == 0) {
+                if(enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if(difference < 0) {
+                // The consumer hasn't caught up; drop instead of waiting.
+                droppedCount.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            } else {
+                position = enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->message = std::move(message);
+        slot->sequence.store(position + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    bool AsyncLogWriter::pushIfRunning(std::string && message) {
+        // Announce the push before looking at the flag; stop() clears the flag
+        // before counting producers, so one of the two sees the other.
+        activeProducers.fetch_add(1);
+
+        if(!running.load()) {
+            activeProducers.fetch_sub(1);
+            return false;
+        }
+
+        push(std::move(message));
+        activeProducers.fetch_sub(1);
+
+        return true;
+    }
+
+    bool AsyncLogWriter::pop(std::string & message) {
+        Slot & slot = slots[dequeuePosition & mask];
+        const std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+
+        if(sequence != dequeuePosition + 1) {
+            return false;
+        }
+
+        message.swap(slot.message);
+        slot.message.clear();
+        slot.sequence.store(dequeuePosition + mask + 1, std::memory_order_release);
+        ++dequeuePosition;
+
+        return true;
+    }
+
+    bool AsyncLogWriter::writePending() {
+        std::string message;
+        batch.clear();
+
+        while(pop(message)) {
+            batch.append(message);
+            batch.push_back('\n');
+        }
+
+        const std::size_t dropped = droppedCount.load(std::memory_order_relaxed);
+
+        if(dropped != reportedDropCount) {
+            std::ostringstream notice;
+            notice << "- [WARNING]: " << (dropped - reportedDropCount) << " log message(s) dropped\n";
+            batch.append(notice.str());
+            reportedDropCount = dropped;
+        }
+
+        if(batch.empty()) {
+            return false;
+        }
+
+        outputStream.write(batch.data(), static_cast<std::streamsize>(batch.size()));
+        outputStream.flush();
+
+        return true;
+    }
+
+    void AsyncLogWriter::flush() {
+        writePending();
+    }
+
+    void AsyncLogWriter::drainLoop() {
+        while(running.load()) {
+            if(!writePending()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(IDLE_SLEEP_MILLISECONDS));
+            }
+        }
+    }
+
+    std::size_t AsyncLogWriter::getCapacity() const {
+        return slots.size();
+    }
+
+    std::size_t AsyncLogWriter::getDroppedCount() const {
+        return droppedCount.load(std::memory_order_relaxed);
+    }
+
+} // hikari
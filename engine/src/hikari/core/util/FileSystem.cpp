@@ -34,16 +34,20 @@ namespace hikari {
         std::vector<char> buffer;
 
         if(exists(fileName)) {
-            int length = 0;
             auto fs = openFileRead(fileName);
 
             fs->seekg (0, std::ios::end);
-            length = static_cast<int>(fs->tellg());
+            const std::streamoff length = fs->tellg();
             fs->seekg (0, std::ios::beg);
 
-            buffer.reserve(length);
+            // tellg() gives -1 if the stream couldn't seek; treat that like
+            // an empty file rather than resizing to a huge length.
+            if(length > 0) {
+                buffer.resize(static_cast<std::size_t>(length));
 
-            fs->read(&buffer[0], length);
+                fs->read(&buffer[0], length);
+                buffer.resize(static_cast<std::size_t>(fs->gcount()));
+            }
         }
 
         return buffer;
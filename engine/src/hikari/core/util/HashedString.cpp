@@ -1,5 +1,5 @@
 #include "hikari/core/util/HashedString.hpp"
-#include <functional>
+#include "hikari/core/util/StringHash.hpp"
 #include <string>
 #include <ostream>
 
@@ -13,8 +13,7 @@ namespace hikari {
    HashedString::HashedString(const std::string& string)
      : hash(0)
      , string(string) {
-     std::hash<std::string> hashingFunction;
-     hash = hashingFunction(string);
+     hash = rememberHashedString(string);
    }
 
    HashedString::~HashedString() { }
@@ -1,6 +1,7 @@
 #include "hikari/core/util/ImageCache.hpp"
 #include "hikari/core/util/FileSystem.hpp"
 #include "hikari/core/util/Log.hpp"
+#include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <iostream>
 #include <sstream>
@@ -16,15 +17,23 @@ namespace hikari {
     ImageCache::ImageCache(bool smoothing, bool masking, const sf::Color &mask)
         : enableSmoothing(smoothing)
         , enableMask(masking)
-        , maskColor(mask) { 
+        , maskColor(mask)
+        , atlas(nullptr)
+        , regions() { 
 
     }
 
-    ImageCache::Resource ImageCache::loadResource(const std::string &fileName) {
-        HIKARI_LOG(debug) << "Caching image: " << fileName;
+    void ImageCache::enableAtlas(unsigned int pageSize) {
+        if(!atlas) {
+            atlas.reset(new TextureAtlas(pageSize, enableSmoothing));
+        }
+    }
 
-        Resource texture(new sf::Texture());
+    const TextureAtlas * ImageCache::getAtlas() const {
+        return atlas.get();
+    }
 
+    void ImageCache::loadImage(const std::string &fileName, sf::Image &imageData) const {
         if(FileSystem::exists(fileName)) {
             auto handle = FileSystem::openFileRead(fileName);
 
@@ -37,39 +46,13 @@ namespace hikari {
 
             // Create a buffer to load image data
             std::unique_ptr<char[]> buffer(new char[static_cast<std::size_t>(length)]);
-
             handle->read(buffer.get(), length);
 
-            sf::Image imageData;
-
             // Fill an image buffer with pixel data
             if(imageData.loadFromMemory(buffer.get(), static_cast<std::size_t>(length))) {
                 if(enableMask) {
                     imageData.createMaskFromColor(maskColor);
                 }
-
-                // HIKARI_LOG(debug4) << "Image data dimensions: " << imageData.getSize().x << "x" << imageData.getSize().y << ".";
-
-                // auto pixel1 = imageData.getPixel(0, 0);
-                // auto pixel2 = imageData.getPixel(1, 0);
-
-                // HIKARI_LOG(debug4) << "Image data 1: (" << static_cast<int>(pixel1.r) << ", " << static_cast<int>(pixel1.g) << ", " << static_cast<int>(pixel1.b) << ", " << static_cast<int>(pixel1.a) << ")";
-                // HIKARI_LOG(debug4) << "Image data 2: (" << static_cast<int>(pixel2.r) << ", " << static_cast<int>(pixel2.g) << ", " << static_cast<int>(pixel2.b) << ", " << static_cast<int>(pixel2.a) << ")";
-
-                // Then copy the processed pixels to the texture
-                if(texture->create(imageData.getSize().x, imageData.getSize().y)) {
-                    texture->update(imageData);
-                    texture->setSmooth(enableSmoothing);
-                    texture->setRepeated(false);
-
-                    // HIKARI_LOG(debug4) << "Texture dimensions: " << texture->getSize().x << "x" << texture->getSize().y << ".";
-                } else {
-                    // Throw.
-                    // Couldn't create texture for some reason.
-                    std::stringstream ss;
-                    ss << "Couldn't create texture for \"" << fileName << "\".";
-                    throw std::runtime_error(ss.str().c_str());
-                }
             } else {
                 // Throw.
                 // Couldn't load image data from memory.
@@ -83,8 +66,64 @@ namespace hikari {
             ss << "Couldn't load image because file was not found. File: \"" << fileName << "\".";
             throw std::runtime_error(ss.str().c_str());
         }
+    }
+
+    ImageCache::Resource ImageCache::loadResource(const std::string &fileName) {
+        HIKARI_LOG(debug) << "Caching image: " << fileName;
+
+        Resource texture(new sf::Texture());
+        sf::Image imageData;
+
+        loadImage(fileName, imageData);
+
+        // Then copy the processed pixels to the texture
+        if(texture->create(imageData.getSize().x, imageData.getSize().y)) {
+            texture->update(imageData);
+            texture->setSmooth(enableSmoothing);
+            texture->setRepeated(false);
+        } else {
+            // Throw.
+            // Couldn't create texture for some reason.
+            std::stringstream ss;
+            ss << "Couldn't create texture for \"" << fileName << "\".";
+            throw std::runtime_error(ss.str().c_str());
+        }
 
         return texture;
     }
 
-} // hikari
\ No newline at end of file
+    TextureRegion ImageCache::getRegion(const std::string &fileName) {
+        auto it = regions.find(fileName);
+
+        if(it != std::end(regions)) {
+            return it->second;
+        }
+
+        TextureRegion region;
+
+        if(atlas) {
+            sf::Image imageData;
+            loadImage(fileName, imageData);
+
+            if(atlas->add(imageData, region)) {
+                HIKARI_LOG(debug) << "Packed image into atlas: " << fileName;
+            }
+        }
+
+        // Too big for the atlas (or no atlas); give it a texture of its own.
+        if(!region.texture) {
+            region.texture = get(fileName);
+            region.bounds = sf::IntRect(
+                0,
+                0,
+                static_cast<int>(region.texture->getSize().x),
+                static_cast<int>(region.texture->getSize().y)
+            );
+        }
+
+        regions.insert(std::make_pair(fileName, region));
+
+        return region;
+    }
+
+} // hikari
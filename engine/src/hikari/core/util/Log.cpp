@@ -1,4 +1,6 @@
 #include "hikari/core/util/Log.hpp"
+#include "hikari/core/util/AsyncLogWriter.hpp"
+#include <algorithm>
 #include <ctime>
 #include <cstdio>
 #include <iostream>
@@ -9,6 +11,7 @@ namespace hikari {
     */
     LogLevel Log::reportingLevel = info;
     std::ostream & Log::outputStream = std::cout;
+    std::unique_ptr<AsyncLogWriter> Log::asyncWriter;
 
     LogLevel & Log::getReportingLevel() {
         return reportingLevel;
@@ -18,6 +21,42 @@ namespace hikari {
         reportingLevel = level;
     }
 
+    bool Log::parseLevel(const std::string & name, LogLevel & level) {
+        static const char* names[] = {
+            "fatal", "error", "warning", "script", "info",
+            "debug", "debug1", "debug2", "debug3", "debug4"
+        };
+
+        for(int i = fatal; i <= debug4; ++i) {
+            if(name == names[i]) {
+                level = static_cast<LogLevel>(i);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void Log::startAsync(std::size_t capacity) {
+        // The writer is created once and kept alive for the life of the
+        // process so other threads never see it disappear mid-message.
+        if(!asyncWriter) {
+            asyncWriter.reset(new AsyncLogWriter(outputStream, capacity));
+        }
+
+        asyncWriter->start();
+    }
+
+    void Log::stopAsync() {
+        if(asyncWriter) {
+            asyncWriter->stop();
+        }
+    }
+
+    std::size_t Log::getDroppedCount() {
+        return asyncWriter ? asyncWriter->getDroppedCount() : 0;
+    }
+
     /*
         Non-static methods and fields
     */
@@ -28,7 +67,14 @@ namespace hikari {
     }
 
     Log::~Log() {
-        Log::outputStream << os.str() << std::endl;
+        std::string message = os.str();
+
+        // The message is only moved from if the writer takes it.
+        if(asyncWriter && asyncWriter->pushIfRunning(std::move(message))) {
+            return;
+        }
+
+        Log::outputStream << message << std::endl;
         //fprintf(stdout, "%s", os.str().c_str());
         //fflush(stdout);
     }
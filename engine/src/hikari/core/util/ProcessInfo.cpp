@@ -0,0 +1,40 @@
+#include "hikari/core/util/ProcessInfo.hpp"
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace hikari {
+
+    std::size_t ProcessInfo::getPeakMemoryUsage() {
+#if defined(_WIN32)
+        PROCESS_MEMORY_COUNTERS counters;
+
+        if(GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+            return static_cast<std::size_t>(counters.PeakWorkingSetSize);
+        }
+
+        return 0;
+#elif defined(__unix__) || defined(__APPLE__)
+        struct rusage usage;
+
+        if(getrusage(RUSAGE_SELF, &usage) != 0) {
+            return 0;
+        }
+
+#if defined(__APPLE__)
+        // OS X reports bytes...
+        return static_cast<std::size_t>(usage.ru_maxrss);
+#else
+        // ...everyone else reports kilobytes.
+        return static_cast<std::size_t>(usage.ru_maxrss) * 1024;
+#endif
+#else
+        return 0;
+#endif
+    }
+
+} // hikari
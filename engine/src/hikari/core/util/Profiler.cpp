@@ -0,0 +1,246 @@
+#include "hikari/core/util/Profiler.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <ostream>
+
+namespace hikari {
+
+    namespace {
+
+        void writeJsonString(std::ostream & output, const char * text) {
+            output << '"';
+
+            for(const char * c = text; *c != '\0'; ++c) {
+                if(*c == '"' || *c == '\\') {
+                    output << '\\' << *c;
+                } else if(static_cast<unsigned char>(*c) < 0x20) {
+                    output << ' ';
+                } else {
+                    output << *c;
+                }
+            }
+
+            output << '"';
+        }
+
+        void writeTraceEvent(std::ostream & output, const char * name, std::uint64_t start, std::uint64_t duration) {
+            output << "{\"name\":";
+            writeJsonString(output, name);
+            output << ",\"ph\":\"X\",\"pid\":1,\"tid\":1"
+                   << ",\"ts\":" << (static_cast<double>(start) / 1000.0)
+                   << ",\"dur\":" << (static_cast<double>(duration) / 1000.0)
+                   << "}";
+        }
+
+        bool isSameName(const char * a, const char * b) {
+            return a == b || std::strcmp(a, b) == 0;
+        }
+
+    }
+
+    const std::size_t Profiler::DEFAULT_FRAME_CAPACITY = 300;
+    const std::size_t Profiler::DEFAULT_ZONE_CAPACITY = 300 * 64;
+
+    Profiler::Profiler(std::size_t frameCapacity, std::size_t zoneCapacity)
+        : epoch(Clock::now())
+        , enabled(false)
+        , inFrame(false)
+        , frames(std::max<std::size_t>(frameCapacity, 1))
+        , framesWritten(0)
+        , currentFrame()
+        , zones(std::max<std::size_t>(zoneCapacity, 1))
+        , zonesWritten(0)
+        , openZones()
+    {
+        openZones.reserve(32);
+    }
+
+    Profiler & Profiler::getInstance() {
+        static Profiler instance;
+        return instance;
+    }
+
+    std::uint64_t Profiler::now() const {
+        return static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - epoch).count()
+        );
+    }
+
+    bool Profiler::isZoneRetained(std::uint64_t zoneIndex) const {
+        return zonesWritten - zoneIndex <= zones.size();
+    }
+
+    void Profiler::setEnabled(bool enabled) {
+        this->enabled = enabled;
+
+        if(!enabled) {
+            inFrame = false;
+        }
+    }
+
+    void Profiler::beginFrame() {
+        if(!enabled) {
+            return;
+        }
+
+        inFrame = true;
+        currentFrame.start = now();
+        currentFrame.duration = 0;
+        currentFrame.firstZone = zonesWritten;
+        currentFrame.zoneCount = 0;
+    }
+
+    void Profiler::endFrame() {
+        if(!inFrame) {
+            return;
+        }
+
+        currentFrame.duration = now() - currentFrame.start;
+        currentFrame.zoneCount = static_cast<std::size_t>(zonesWritten - currentFrame.firstZone);
+
+        frames[framesWritten % frames.size()] = currentFrame;
+        ++framesWritten;
+
+        inFrame = false;
+    }
+
+    bool Profiler::beginZone(const char * name) {
+        if(!enabled || !inFrame) {
+            return false;
+        }
+
+        OpenZone zone;
+        zone.name = name;
+        zone.start = now();
+
+        openZones.push_back(zone);
+
+        return true;
+    }
+
+    void Profiler::endZone() {
+        if(openZones.empty()) {
+            return;
+        }
+
+        const OpenZone & open = openZones.back();
+
+        Zone & zone = zones[zonesWritten % zones.size()];
+        zone.name = open.name;
+        zone.start = open.start;
+        zone.duration = now() - open.start;
+        zone.depth = static_cast<unsigned int>(openZones.size() - 1);
+
+        ++zonesWritten;
+        openZones.pop_back();
+    }
+
+    std::size_t Profiler::getFrameCount() const {
+        return static_cast<std::size_t>(std::min<std::uint64_t>(framesWritten, frames.size()));
+    }
+
+    const Profiler::Frame & Profiler::getFrame(std::size_t age) const {
+        return frames[(framesWritten - 1 - age) % frames.size()];
+    }
+
+    std::vector<Profiler::ZoneSummary> Profiler::summarize(std::size_t frameCount) const {
+        std::vector<ZoneSummary> summaries;
+        std::vector<std::uint64_t> frameDurations;
+
+        frameCount = std::min(frameCount, getFrameCount());
+
+        for(std::size_t age = 0; age < frameCount; ++age) {
+            const Frame & frame = getFrame(age);
+
+            for(std::uint64_t index = frame.firstZone; index < frame.firstZone + frame.zoneCount; ++index) {
+                if(!isZoneRetained(index)) {
+                    continue;
+                }
+
+                const Zone & zone = zones[index % zones.size()];
+
+                std::size_t found = 0;
+
+                while(found < summaries.size() && !isSameName(summaries[found].name, zone.name)) {
+                    ++found;
+                }
+
+                if(found == summaries.size()) {
+                    ZoneSummary summary;
+                    summary.name = zone.name;
+                    summary.depth = zone.depth;
+                    summary.calls = 0;
+                    summary.totalDuration = 0;
+                    summary.maxFrameDuration = 0;
+
+                    summaries.push_back(summary);
+                    frameDurations.push_back(0);
+                }
+
+                ZoneSummary & summary = summaries[found];
+                summary.depth = std::min(summary.depth, zone.depth);
+                summary.calls += 1;
+                summary.totalDuration += zone.duration;
+                frameDurations[found] += zone.duration;
+            }
+
+            for(std::size_t i = 0; i < summaries.size(); ++i) {
+                summaries[i].maxFrameDuration = std::max(summaries[i].maxFrameDuration, frameDurations[i]);
+                frameDurations[i] = 0;
+            }
+        }
+
+        std::sort(std::begin(summaries), std::end(summaries), [](const ZoneSummary & a, const ZoneSummary & b) {
+            return a.totalDuration > b.totalDuration;
+        });
+
+        return summaries;
+    }
+
+    void Profiler::writeChromeTrace(std::ostream & output) const {
+        const std::ios::fmtflags flags = output.flags();
+        const std::streamsize precision = output.precision();
+
+        output << std::fixed << std::setprecision(3);
+        output << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+        bool first = true;
+
+        for(std::size_t age = getFrameCount(); age > 0; --age) {
+            const Frame & frame = getFrame(age - 1);
+
+            if(!first) {
+                output << ",";
+            }
+
+            writeTraceEvent(output, "Frame", frame.start, frame.duration);
+            first = false;
+
+            for(std::uint64_t index = frame.firstZone; index < frame.firstZone + frame.zoneCount; ++index) {
+                if(isZoneRetained(index)) {
+                    const Zone & zone = zones[index % zones.size()];
+
+                    output << ",\n";
+                    writeTraceEvent(output, zone.name, zone.start, zone.duration);
+                }
+            }
+
+            output << "\n";
+        }
+
+        output << "]}\n";
+
+        output.flags(flags);
+        output.precision(precision);
+    }
+
+    void Profiler::clear() {
+        framesWritten = 0;
+        zonesWritten = 0;
+        inFrame = false;
+        openZones.clear();
+    }
+
+} // hikari
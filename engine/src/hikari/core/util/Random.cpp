@@ -0,0 +1,40 @@
+#include "hikari/core/util/Random.hpp"
+
+namespace hikari {
+
+    Random::Random(std::uint32_t seed)
+        : engine(seed)
+        , seedValue(seed)
+    {
+
+    }
+
+    void Random::seed(std::uint32_t seed) {
+        seedValue = seed;
+        engine.seed(seed);
+    }
+
+    std::uint32_t Random::getSeed() const {
+        return seedValue;
+    }
+
+    std::uint32_t Random::next() {
+        return static_cast<std::uint32_t>(engine());
+    }
+
+    int Random::nextInt(int bound) {
+        if(bound <= 0) {
+            return 0;
+        }
+
+        // The standard distributions differ between library vendors, so
+        // scale the raw output here to keep results portable.
+        return static_cast<int>(next() % static_cast<std::uint32_t>(bound));
+    }
+
+    float Random::nextFloat() {
+        // 24 bits is all the precision a float has.
+        return static_cast<float>(next() >> 8) / static_cast<float>(1u << 24);
+    }
+
+} // hikari
@@ -0,0 +1,73 @@
+#include "hikari/core/util/ShelfPacker.hpp"
+
+namespace hikari {
+
+    ShelfPacker::ShelfPacker(int width, int height, int padding)
+        : width(width)
+        , height(height)
+        , padding(padding)
+        , usedHeight(0)
+        , shelves()
+    {
+
+    }
+
+    bool ShelfPacker::insert(int rectWidth, int rectHeight, Rectangle2D<int> & placement) {
+        if(rectWidth <= 0 || rectHeight <= 0) {
+            return false;
+        }
+
+        const int paddedWidth = rectWidth + padding;
+        const int paddedHeight = rectHeight + padding;
+
+        // Use the shelf which wastes the least height.
+        Shelf * bestShelf = nullptr;
+
+        for(auto it = std::begin(shelves); it != std::end(shelves); ++it) {
+            Shelf & shelf = *it;
+
+            if(shelf.height >= paddedHeight && width - shelf.usedWidth >= paddedWidth) {
+                if(!bestShelf || shelf.height < bestShelf->height) {
+                    bestShelf = &shelf;
+                }
+            }
+        }
+
+        if(!bestShelf) {
+            if(paddedWidth > width || height - usedHeight < paddedHeight) {
+                return false;
+            }
+
+            Shelf shelf;
+            shelf.y = usedHeight;
+            shelf.height = paddedHeight;
+            shelf.usedWidth = 0;
+
+            shelves.push_back(shelf);
+            usedHeight += paddedHeight;
+            bestShelf = &shelves.back();
+        }
+
+        placement = Rectangle2D<int>(bestShelf->usedWidth, bestShelf->y, rectWidth, rectHeight);
+        bestShelf->usedWidth += paddedWidth;
+
+        return true;
+    }
+
+    int ShelfPacker::getWidth() const {
+        return width;
+    }
+
+    int ShelfPacker::getHeight() const {
+        return height;
+    }
+
+    float ShelfPacker::getOccupancy() const {
+        if(width <= 0 || height <= 0) {
+            return 0.0f;
+        }
+
+        return static_cast<float>(usedHeight) / static_cast<float>(height);
+    }
+
+} // hikari
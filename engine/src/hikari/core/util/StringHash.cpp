@@ -0,0 +1,80 @@
+#include "hikari/core/util/StringHash.hpp"
+#include "hikari/core/util/Log.hpp"
+
+#include <iomanip>
+#include <sstream>
+
+#ifdef HIKARI_DEBUG_STRING_HASHES
+#include <mutex>
+#include <unordered_map>
+#endif // HIKARI_DEBUG_STRING_HASHES
+
+namespace hikari {
+
+    namespace {
+
+#ifdef HIKARI_DEBUG_STRING_HASHES
+        struct HashedStringTable {
+            std::mutex mutex;
+            std::unordered_map<StringHash, std::string> strings;
+        };
+
+        // Function-local so it can be used during static initialization.
+        HashedStringTable & getHashedStringTable() {
+            static HashedStringTable table;
+            return table;
+        }
+#endif // HIKARI_DEBUG_STRING_HASHES
+
+        std::string formatHash(StringHash hash) {
+            std::ostringstream formatted;
+            formatted << "0x" << std::hex << std::setw(8) << std::setfill('0') << hash;
+            return formatted.str();
+        }
+
+    }
+
+    StringHash hashString(const std::string & string) {
+        StringHash hash = detail::STRING_HASH_OFFSET;
+
+        for(auto it = std::begin(string), end = std::end(string); it != end; it++) {
+            hash = static_cast<StringHash>((hash ^ static_cast<unsigned char>(*it)) * detail::STRING_HASH_PRIME);
+        }
+
+        return hash;
+    }
+
+    StringHash rememberHashedString(const std::string & string) {
+        const StringHash hash = hashString(string);
+
+#ifdef HIKARI_DEBUG_STRING_HASHES
+        HashedStringTable & table = getHashedStringTable();
+        std::lock_guard<std::mutex> lock(table.mutex);
+
+        auto inserted = table.strings.insert(std::make_pair(hash, string));
+
+        if(!inserted.second && inserted.first->second != string) {
+            HIKARI_LOG(error) << "String hash collision: \"" << string << "\" and \""
+                              << inserted.first->second << "\" both hash to " << formatHash(hash) << ".";
+        }
+#endif // HIKARI_DEBUG_STRING_HASHES
+
+        return hash;
+    }
+
+    std::string findHashedString(StringHash hash) {
+#ifdef HIKARI_DEBUG_STRING_HASHES
+        HashedStringTable & table = getHashedStringTable();
+        std::lock_guard<std::mutex> lock(table.mutex);
+
+        auto found = table.strings.find(hash);
+
+        if(found != table.strings.end()) {
+            return found->second;
+        }
+#endif // HIKARI_DEBUG_STRING_HASHES
+
+        return formatHash(hash);
+    }
+
+} // hikari
@@ -0,0 +1,141 @@
+#include "hikari/core/util/TextureAtlas.hpp"
+#include "hikari/core/util/Log.hpp"
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <algorithm>
+
+namespace hikari {
+
+    namespace {
+
+        /**
+         * Copies an image into the middle of a larger one and repeats its
+         * outermost pixels across the border around it. Sampling just past
+         * the image's edge (when filtering, or when a sprite lands between
+         * two pixels) then picks up the image's own edge color instead of
+         * whatever was packed next to it.
+         */
+        sf::Image extrude(const sf::Image & image, unsigned int border) {
+            const unsigned int width = image.getSize().x;
+            const unsigned int height = image.getSize().y;
+
+            sf::Image padded;
+            padded.create(width + border * 2, height + border * 2, sf::Color::Transparent);
+            padded.copy(image, border, border);
+
+            // Left and right edges
+            for(unsigned int y = 0; y < height; ++y) {
+                const sf::Color left = image.getPixel(0, y);
+                const sf::Color right = image.getPixel(width - 1, y);
+
+                for(unsigned int i = 0; i < border; ++i) {
+                    padded.setPixel(i, y + border, left);
+                    padded.setPixel(width + border + i, y + border, right);
+                }
+            }
+
+            // Top and bottom edges, corners included
+            for(unsigned int x = 0; x < width + border * 2; ++x) {
+                const sf::Color top = padded.getPixel(x, border);
+                const sf::Color bottom = padded.getPixel(x, height + border - 1);
+
+                for(unsigned int i = 0; i < border; ++i) {
+                    padded.setPixel(x, i, top);
+                    padded.setPixel(x, height + border + i, bottom);
+                }
+            }
+
+            return padded;
+        }
+
+    }
+
+    const unsigned int TextureAtlas::DEFAULT_PAGE_SIZE = 1024;
+    const int TextureAtlas::PADDING = 1;
+
+    TextureAtlas::Page::Page(const std::shared_ptr<sf::Texture> & texture, int size)
+        : texture(texture)
+        , packer(size, size)
+    {
+
+    }
+
+    TextureAtlas::TextureAtlas(unsigned int pageSize, bool smoothing)
+        : pageSize(std::min(pageSize, sf::Texture::getMaximumSize()))
+        , smoothing(smoothing)
+        , pages()
+    {
+
+    }
+
+    bool TextureAtlas::accepts(unsigned int width, unsigned int height) const {
+        return width > 0 && height > 0 && width <= pageSize / 2 && height <= pageSize / 2;
+    }
+
+    bool TextureAtlas::addPage() {
+        // Start out fully transparent so that padding never shows garbage.
+        sf::Image blank;
+        blank.create(pageSize, pageSize, sf::Color::Transparent);
+
+        std::shared_ptr<sf::Texture> texture(new sf::Texture());
+
+        if(!texture->loadFromImage(blank)) {
+            HIKARI_LOG(error) << "Couldn't create a " << pageSize << "x" << pageSize << " texture atlas page.";
+            return false;
+        }
+
+        texture->setSmooth(smoothing);
+        texture->setRepeated(false);
+
+        pages.push_back(Page(texture, static_cast<int>(pageSize)));
+
+        HIKARI_LOG(debug) << "Texture atlas now has " << pages.size() << " page(s).";
+
+        return true;
+    }
+
+    bool TextureAtlas::place(Page & page, const sf::Image & image, TextureRegion & region) {
+        const sf::Vector2u size = image.getSize();
+        const int width = static_cast<int>(size.x);
+        const int height = static_cast<int>(size.y);
+        Rectangle2D<int> placement;
+
+        if(!page.packer.insert(width + PADDING * 2, height + PADDING * 2, placement)) {
+            return false;
+        }
+
+        page.texture->update(extrude(image, static_cast<unsigned int>(PADDING)), placement.getX(), placement.getY());
+
+        region.texture = page.texture;
+        region.bounds = sf::IntRect(placement.getX() + PADDING, placement.getY() + PADDING, width, height);
+
+        return true;
+    }
+
+    bool TextureAtlas::add(const sf::Image & image, TextureRegion & region) {
+        if(!accepts(image.getSize().x, image.getSize().y)) {
+            return false;
+        }
+
+        // Earlier pages usually still have room for small images.
+        for(auto it = std::begin(pages); it != std::end(pages); ++it) {
+            if(place(*it, image, region)) {
+                return true;
+            }
+        }
+
+        return addPage() && place(pages.back(), image, region);
+    }
+
+    unsigned int TextureAtlas::getPageSize() const {
+        return pageSize;
+    }
+
+    std::size_t TextureAtlas::getPageCount() const {
+        return pages.size();
+    }
+
+} // hikari
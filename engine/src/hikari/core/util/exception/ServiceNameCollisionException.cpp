@@ -0,0 +1,11 @@
+#include "hikari/core/util/exception/ServiceNameCollisionException.hpp"
+
+namespace hikari {
+
+    ServiceNameCollisionException::ServiceNameCollisionException(const std::string& message)
+        : HikariException(message)
+    {
+
+    }
+
+} // hikari
\ No newline at end of file
@@ -0,0 +1,72 @@
+#include "catch.hpp"
+
+#include <hikari/core/game/AnimationSet.hpp>
+
+#include <memory>
+
+namespace {
+
+    hikari::AnimationPtr makeAnimation() {
+        hikari::FrameList frames;
+        frames.push_back(hikari::AnimationFrame(hikari::Rectangle2D<int>(0, 0, 16, 16), 0.1f));
+
+        return std::make_shared<hikari::Animation>(frames);
+    }
+
+}
+
+//
+// Tests for hikari::AnimationSet
+//
+
+TEST_CASE( "AnimationSet/getHandle/resolves names to handles", "Each animation gets its own handle which finds it again" ) {
+    hikari::AnimationSet animationSet("test", "test.png", nullptr);
+    auto idle = makeAnimation();
+    auto walking = makeAnimation();
+
+    REQUIRE( animationSet.add("idle", idle) );
+    REQUIRE( animationSet.add("walking", walking) );
+    REQUIRE_FALSE( animationSet.add("idle", walking) );
+
+    const auto idleHandle = animationSet.getHandle("idle");
+    const auto walkingHandle = animationSet.getHandle("walking");
+
+    REQUIRE( idleHandle != hikari::AnimationSet::INVALID_HANDLE );
+    REQUIRE( walkingHandle != hikari::AnimationSet::INVALID_HANDLE );
+    REQUIRE( idleHandle != walkingHandle );
+
+    REQUIRE( animationSet.get(idleHandle) == idle );
+    REQUIRE( animationSet.get(walkingHandle) == walking );
+    REQUIRE( animationSet.get("walking") == walking );
+    REQUIRE( animationSet.getName(walkingHandle) == "walking" );
+}
+
+TEST_CASE( "AnimationSet/getHandle/rejects unknown names and handles", "Unknown names have no handle and bad handles find nothing" ) {
+    hikari::AnimationSet animationSet("test", "test.png", nullptr);
+
+    REQUIRE( animationSet.add("idle", makeAnimation()) );
+
+    REQUIRE( animationSet.getHandle("missing") == hikari::AnimationSet::INVALID_HANDLE );
+    REQUIRE_FALSE( animationSet.get(hikari::AnimationSet::INVALID_HANDLE) );
+    REQUIRE_FALSE( animationSet.get(42) );
+    REQUIRE( animationSet.getName(42).empty() );
+}
+
+TEST_CASE( "AnimationSet/remove/keeps other handles valid", "Removing an animation doesn't move the others" ) {
+    hikari::AnimationSet animationSet("test", "test.png", nullptr);
+    auto idle = makeAnimation();
+    auto walking = makeAnimation();
+
+    animationSet.add("idle", idle);
+    animationSet.add("walking", walking);
+
+    const auto idleHandle = animationSet.getHandle("idle");
+    const auto walkingHandle = animationSet.getHandle("walking");
+
+    animationSet.remove("idle");
+
+    REQUIRE_FALSE( animationSet.has("idle") );
+    REQUIRE_FALSE( animationSet.get(idleHandle) );
+    REQUIRE( animationSet.get(walkingHandle) == walking );
+    REQUIRE( animationSet.getHandle("walking") == walkingHandle );
+}
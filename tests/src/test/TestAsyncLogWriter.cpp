@@ -0,0 +1,137 @@
+#include "catch.hpp"
+
+#include <hikari/core/util/AsyncLogWriter.hpp>
+#include <hikari/core/util/Log.hpp>
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+//
+// Tests for hikari::AsyncLogWriter
+//
+
+namespace {
+    std::size_t countLines(const std::string & text) {
+        std::size_t lines = 0;
+
+        for(auto it = std::begin(text); it != std::end(text); ++it) {
+            if(*it == '\n') {
+                lines++;
+            }
+        }
+
+        return lines;
+    }
+}
+
+TEST_CASE( "AsyncLogWriter/constructor/capacity", "Capacity is rounded up to a power of two" ) {
+    std::ostringstream output;
+    hikari::AsyncLogWriter writer(output, 100);
+
+    REQUIRE( writer.getCapacity() == 128 );
+    REQUIRE( writer.getDroppedCount() == 0 );
+    REQUIRE_FALSE( writer.isRunning() );
+}
+
+TEST_CASE( "AsyncLogWriter/flush/writes in order", "Pending messages are written in the order they were pushed" ) {
+    std::ostringstream output;
+    hikari::AsyncLogWriter writer(output, 8);
+
+    REQUIRE( writer.push(std::string("first")) );
+    REQUIRE( writer.push(std::string("second")) );
+
+    REQUIRE( output.str().empty() );
+
+    writer.flush();
+
+    REQUIRE( output.str() == "first\nsecond\n" );
+}
+
+TEST_CASE( "AsyncLogWriter/push/drops when full", "Pushing into a full buffer drops and counts the message" ) {
+    std::ostringstream output;
+    hikari::AsyncLogWriter writer(output, 4);
+
+    for(int i = 0; i < 4; ++i) {
+        REQUIRE( writer.push(std::string("message")) );
+    }
+
+    REQUIRE_FALSE( writer.push(std::string("overflow")) );
+    REQUIRE( writer.getDroppedCount() == 1 );
+
+    writer.flush();
+
+    REQUIRE( output.str().find("overflow") == std::string::npos );
+    REQUIRE( output.str().find("1 log message(s) dropped") != std::string::npos );
+
+    // Space is available again once the buffer has been drained
+    REQUIRE( writer.push(std::string("again")) );
+}
+
+TEST_CASE( "AsyncLogWriter/stop/drains everything", "Stopping writes every message pushed from several threads" ) {
+    std::ostringstream output;
+    hikari::AsyncLogWriter writer(output, 4096);
+    const int threadCount = 4;
+    const int messagesPerThread = 500;
+
+    writer.start();
+    REQUIRE( writer.isRunning() );
+
+    std::vector<std::thread> producers;
+
+    for(int t = 0; t < threadCount; ++t) {
+        producers.push_back(std::thread([&writer, messagesPerThread]() {
+            for(int i = 0; i < messagesPerThread; ++i) {
+                writer.push(std::string("message"));
+            }
+        }));
+    }
+
+    for(auto it = std::begin(producers); it != std::end(producers); ++it) {
+        it->join();
+    }
+
+    writer.stop();
+
+    REQUIRE_FALSE( writer.isRunning() );
+    REQUIRE( writer.getDroppedCount() == 0 );
+    REQUIRE( countLines(output.str()) == static_cast<std::size_t>(threadCount * messagesPerThread) );
+}
+
+TEST_CASE( "AsyncLogWriter/pushIfRunning/refuses while stopped", "Messages are only taken while the drain thread runs" ) {
+    std::ostringstream output;
+    hikari::AsyncLogWriter writer(output, 8);
+    std::string message("before");
+
+    REQUIRE_FALSE( writer.pushIfRunning(std::move(message)) );
+    REQUIRE( message == "before" );
+
+    writer.start();
+
+    REQUIRE( writer.pushIfRunning(std::string("during")) );
+
+    writer.stop();
+    message = "after";
+
+    REQUIRE_FALSE( writer.pushIfRunning(std::move(message)) );
+    REQUIRE( message == "after" );
+    REQUIRE( output.str() == "during\n" );
+}
+
+//
+// Tests for hikari::Log
+//
+
+TEST_CASE( "Log/parseLevel", "Level names map to LogLevel values" ) {
+    hikari::LogLevel level = hikari::info;
+
+    REQUIRE( hikari::Log::parseLevel("warning", level) );
+    REQUIRE( level == hikari::warning );
+
+    REQUIRE( hikari::Log::parseLevel("debug4", level) );
+    REQUIRE( level == hikari::debug4 );
+
+    REQUIRE_FALSE( hikari::Log::parseLevel("verbose", level) );
+    REQUIRE( level == hikari::debug4 );
+}
@@ -0,0 +1,69 @@
+#include "catch.hpp"
+
+#include <hikari/core/util/BlockPool.hpp>
+
+#include <memory>
+
+//
+// Tests for hikari::BlockPool and hikari::BlockAllocator
+//
+
+namespace {
+    struct Payload {
+        char bytes[40];
+    };
+}
+
+TEST_CASE( "BlockPool/allocate/reuses freed blocks", "A freed block is handed out again before asking the heap" ) {
+    typedef hikari::BlockPool<sizeof(Payload)> Pool;
+
+    void * first = Pool::allocate();
+    Pool::deallocate(first);
+
+    void * second = Pool::allocate();
+
+    REQUIRE( second == first );
+
+    Pool::deallocate(second);
+}
+
+TEST_CASE( "BlockAllocator/allocate/pools single objects only", "Arrays come from the heap and never end up on the free list" ) {
+    hikari::BlockAllocator<Payload> allocator;
+
+    Payload * single = allocator.allocate(1);
+    allocator.deallocate(single, 1);
+
+    Payload * array = allocator.allocate(4);
+    Payload * reused = allocator.allocate(1);
+
+    REQUIRE( reused == single );
+    REQUIRE( array != single );
+
+    allocator.deallocate(array, 4);
+
+    // Freeing the array must not have put it on the free list
+    Payload * next = allocator.allocate(1);
+
+    REQUIRE( next != array );
+
+    allocator.deallocate(next, 1);
+    allocator.deallocate(reused, 1);
+}
+
+TEST_CASE( "BlockAllocator/shared_ptr/frees through the deleter", "shared_ptr can take a BlockAllocator for its reference count" ) {
+    int deleted = 0;
+
+    {
+        std::shared_ptr<int> lease(new int(7), [&deleted](int * value) {
+            ++deleted;
+            delete value;
+        }, hikari::BlockAllocator<int>());
+
+        std::weak_ptr<int> observer = lease;
+
+        REQUIRE( *lease == 7 );
+        REQUIRE_FALSE( observer.expired() );
+    }
+
+    REQUIRE( deleted == 1 );
+}
@@ -4,8 +4,13 @@
 #include <hikari/client/game/events/EventBusImpl.hpp>
 #include <hikari/client/game/events/EventData.hpp>
 #include <hikari/client/game/events/BaseEventData.hpp>
+#include <hikari/client/game/events/EventPool.hpp>
 
+#include <chrono>
+#include <iostream>
 #include <memory>
+#include <thread>
+#include <vector>
 
 //
 // Helper classes and functions
@@ -233,4 +238,190 @@ TEST_CASE( "EventBusImpl/processEvents (empty queue)", "Returns true if the queu
     REQUIRE( eventBus->processEvents() );
 }
 
-// addListener(const hikari::EventListenerDelegate & eventDelegate, const EventType & type) = 0;
\ No newline at end of file
+TEST_CASE( "EventBusImpl/processEvents (events queued by listeners)", "Events queued while processing wait for the next call" ) {
+    std::unique_ptr<hikari::EventBus> eventBus(new hikari::EventBusImpl("global", true));
+    hikari::EventBus * bus = eventBus.get();
+
+    unsigned int calls = 0;
+
+    hikari::EventListenerDelegate requeueingDelegate([&](hikari::EventDataPtr evt) {
+        calls++;
+        bus->queueEvent(hikari::EventDataPtr(new ::helpers::MockEventDataA()));
+    });
+
+    eventBus->addListener(requeueingDelegate, ::helpers::MockEventDataA::Type);
+    eventBus->queueEvent(hikari::EventDataPtr(new ::helpers::MockEventDataA()));
+
+    REQUIRE( eventBus->processEvents() );
+    REQUIRE( calls == 1 );
+
+    eventBus->processEvents();
+
+    REQUIRE( calls == 2 );
+}
+
+TEST_CASE( "EventBusImpl/triggerEvent (listener removes another)", "A listener removed during dispatch is not called" ) {
+    std::unique_ptr<hikari::EventBus> eventBus(new hikari::EventBusImpl("global", true));
+    hikari::EventBus * bus = eventBus.get();
+
+    unsigned int secondCalls = 0;
+
+    hikari::EventListenerDelegate second([&](hikari::EventDataPtr evt) {
+        secondCalls++;
+    });
+
+    hikari::EventListenerDelegate first([&](hikari::EventDataPtr evt) {
+        bus->removeListener(second, ::helpers::MockEventDataA::Type);
+    });
+
+    eventBus->addListener(first, ::helpers::MockEventDataA::Type);
+    eventBus->addListener(second, ::helpers::MockEventDataA::Type);
+    eventBus->triggerEvent(hikari::EventDataPtr(new ::helpers::MockEventDataA()));
+
+    REQUIRE( secondCalls == 0 );
+    REQUIRE_FALSE( eventBus->removeListener(second, ::helpers::MockEventDataA::Type) );
+}
+
+TEST_CASE( "EventBusImpl/triggerEvent (listener adds another)", "A listener added during dispatch is called from the next event on" ) {
+    std::unique_ptr<hikari::EventBus> eventBus(new hikari::EventBusImpl("global", true));
+    hikari::EventBus * bus = eventBus.get();
+
+    unsigned int addedCalls = 0;
+
+    hikari::EventListenerDelegate added([&](hikari::EventDataPtr evt) {
+        addedCalls++;
+    });
+
+    hikari::EventListenerDelegate adder([&](hikari::EventDataPtr evt) {
+        bus->addListener(added, ::helpers::MockEventDataA::Type);
+    });
+
+    eventBus->addListener(adder, ::helpers::MockEventDataA::Type);
+    eventBus->triggerEvent(hikari::EventDataPtr(new ::helpers::MockEventDataA()));
+
+    REQUIRE( addedCalls == 0 );
+
+    eventBus->triggerEvent(hikari::EventDataPtr(new ::helpers::MockEventDataA()));
+
+    REQUIRE( addedCalls == 1 );
+}
+
+TEST_CASE( "EventBusImpl/processEvents (time budget)", "Events which don't fit in the budget are carried over in order" ) {
+    std::unique_ptr<hikari::EventBusImpl> eventBus(new hikari::EventBusImpl("global", false));
+
+    std::vector<hikari::EventType> order;
+
+    hikari::EventListenerDelegate slowDelegate([&](hikari::EventDataPtr evt) {
+        order.push_back(evt->getEventType());
+        std::this_thread::sleep_for(std::chrono::milliseconds(3));
+    });
+
+    eventBus->addListener(slowDelegate, ::helpers::MockEventDataA::Type);
+    eventBus->addListener(slowDelegate, ::helpers::MockEventDataB::Type);
+
+    eventBus->queueEvent(hikari::EventDataPtr(new ::helpers::MockEventDataA()));
+    eventBus->queueEvent(hikari::EventDataPtr(new ::helpers::MockEventDataB()));
+    eventBus->queueEvent(hikari::EventDataPtr(new ::helpers::MockEventDataA()));
+
+    REQUIRE_FALSE( eventBus->processEvents(1) );
+    REQUIRE( order.size() == 1 );
+    REQUIRE( eventBus->getQueuedEventCount() == 2 );
+
+    eventBus->queueEvent(hikari::EventDataPtr(new ::helpers::MockEventDataB()));
+
+    REQUIRE( eventBus->processEvents() );
+    REQUIRE( order.size() == 4 );
+    REQUIRE( order[0] == ::helpers::MockEventDataA::Type );
+    REQUIRE( order[1] == ::helpers::MockEventDataB::Type );
+    REQUIRE( order[2] == ::helpers::MockEventDataA::Type );
+    REQUIRE( order[3] == ::helpers::MockEventDataB::Type );
+}
+
+TEST_CASE( "EventBusImpl/getStatistics", "Dispatch counts and handler times are recorded per event type" ) {
+    std::unique_ptr<hikari::EventBusImpl> eventBus(new hikari::EventBusImpl("global", false));
+
+    hikari::EventListenerDelegate delegatedFunction(&::helpers::testAddListener);
+
+    eventBus->addListener(delegatedFunction, ::helpers::MockEventDataA::Type);
+    eventBus->triggerEvent(hikari::EventDataPtr(new ::helpers::MockEventDataA()));
+    eventBus->queueEvent(hikari::EventDataPtr(new ::helpers::MockEventDataA()));
+    eventBus->processEvents();
+
+    const auto & statistics = eventBus->getStatistics();
+    auto found = statistics.find(::helpers::MockEventDataA::Type);
+
+    REQUIRE( statistics.size() == 1 );
+    REQUIRE( found != statistics.end() );
+    REQUIRE( found->second.name == "MockEventDataA" );
+    REQUIRE( found->second.count == 2 );
+    REQUIRE( found->second.maxNanoseconds <= found->second.totalNanoseconds );
+
+    eventBus->resetStatistics();
+
+    REQUIRE( eventBus->getStatistics().empty() );
+}
+
+TEST_CASE( "EventPool/makeEvent", "Pooled events are reused once released" ) {
+    auto event = hikari::makeEvent<::helpers::MockEventDataA>();
+    const void * address = event.get();
+
+    REQUIRE( event->getEventType() == ::helpers::MockEventDataA::Type );
+
+    event.reset();
+
+    auto reused = hikari::makeEvent<::helpers::MockEventDataA>();
+
+    REQUIRE( reused.get() == address );
+}
+
+//
+// Dispatch cost benchmark; hidden from the default run. Use:
+//   tests "[benchmark]"
+//
+TEST_CASE( "EventBusImpl/benchmark/dispatch cost per event", "[.][benchmark] Measures trigger and queue/process cost" ) {
+    const int iterations = 200000;
+    const int listenerCount = 4;
+
+    std::unique_ptr<hikari::EventBus> eventBus(new hikari::EventBusImpl("global", false));
+    std::vector<hikari::EventListenerDelegate> delegates;
+    unsigned int calls = 0;
+
+    for(int i = 0; i < listenerCount; ++i) {
+        delegates.push_back(hikari::EventListenerDelegate([&](hikari::EventDataPtr evt) {
+            calls++;
+        }));
+
+        eventBus->addListener(delegates.back(), ::helpers::MockEventDataA::Type);
+    }
+
+    typedef std::chrono::high_resolution_clock Clock;
+
+    std::cout << "EventBusImpl benchmark (" << listenerCount << " listeners, "
+              << iterations << " events)" << std::endl;
+
+    auto start = Clock::now();
+
+    for(int i = 0; i < iterations; ++i) {
+        eventBus->triggerEvent(hikari::makeEvent<::helpers::MockEventDataA>());
+    }
+
+    auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+
+    std::cout << "  triggerEvent:           " << (nanos / iterations) << " ns/event" << std::endl;
+
+    start = Clock::now();
+
+    for(int i = 0; i < iterations; i += 100) {
+        for(int j = 0; j < 100; ++j) {
+            eventBus->queueEvent(hikari::makeEvent<::helpers::MockEventDataA>());
+        }
+
+        eventBus->processEvents();
+    }
+
+    nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+
+    std::cout << "  queueEvent + process:   " << (nanos / iterations) << " ns/event" << std::endl;
+
+    REQUIRE( calls == static_cast<unsigned int>(iterations * listenerCount * 2) );
+}
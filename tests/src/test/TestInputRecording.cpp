@@ -0,0 +1,162 @@
+#include "catch.hpp"
+
+#include <hikari/client/game/InputRecorder.hpp>
+#include <hikari/client/game/InputRecording.hpp>
+#include <hikari/client/game/ReplayInput.hpp>
+#include <hikari/client/game/ScriptedInput.hpp>
+
+#include <json/reader.h>
+#include <json/value.h>
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+//
+// Tests for hikari::InputRecording, hikari::InputRecorder and hikari::ReplayInput
+//
+
+TEST_CASE( "InputRecording/write/round trips", "A written recording reads back identically" ) {
+    hikari::InputRecording recording(1234);
+
+    recording.addTick(hikari::Input::BUTTON_NONE);
+    recording.addTick(hikari::Input::BUTTON_RIGHT);
+    recording.addTick(hikari::Input::BUTTON_RIGHT | hikari::Input::BUTTON_JUMP);
+    recording.addTick(hikari::Input::BUTTON_RIGHT | hikari::Input::BUTTON_JUMP);
+    recording.addTick(hikari::Input::BUTTON_CANCEL);
+
+    std::stringstream stream;
+    recording.write(stream);
+
+    hikari::InputRecording loaded;
+
+    REQUIRE( loaded.read(stream) );
+    REQUIRE( loaded.getRandomSeed() == 1234 );
+    REQUIRE( loaded.getTickCount() == recording.getTickCount() );
+
+    for(std::size_t i = 0; i < recording.getTickCount(); ++i) {
+        REQUIRE( loaded.getTick(i) == recording.getTick(i) );
+    }
+
+    REQUIRE( loaded.getTick(recording.getTickCount()) == hikari::Input::BUTTON_NONE );
+}
+
+TEST_CASE( "InputRecording/write/keeps the speed multiplier", "Replays need the time step the session was recorded with" ) {
+    hikari::InputRecording recording(7, 0.5f);
+    recording.addTick(hikari::Input::BUTTON_LEFT);
+
+    std::stringstream stream;
+    recording.write(stream);
+
+    hikari::InputRecording loaded;
+
+    REQUIRE( loaded.read(stream) );
+    REQUIRE( loaded.getSpeedMultiplier() == 0.5f );
+    REQUIRE( hikari::InputRecording().getSpeedMultiplier() == 1.0f );
+}
+
+TEST_CASE( "InputRecording/read/accepts version 1", "Recordings from before the speed multiplier was saved play at normal speed" ) {
+    const char bytes[] = {
+        'H', 'K', 'I', 'R',
+        1,
+        42, 0, 0, 0,            // random seed
+        3, 0, 0, 0,             // tick count
+        1, 0, 0, 0,             // run count
+        2, 0, 3, 0              // BUTTON_RIGHT for 3 ticks
+    };
+
+    std::stringstream stream(std::string(bytes, sizeof(bytes)));
+    hikari::InputRecording recording(0, 2.0f);
+
+    REQUIRE( recording.read(stream) );
+    REQUIRE( recording.getRandomSeed() == 42 );
+    REQUIRE( recording.getSpeedMultiplier() == 1.0f );
+    REQUIRE( recording.getTickCount() == 3 );
+    REQUIRE( recording.getTick(2) == hikari::Input::BUTTON_RIGHT );
+}
+
+TEST_CASE( "InputRecording/write/is run-length encoded", "Holding the same buttons doesn't grow the file" ) {
+    hikari::InputRecording shortRecording;
+    hikari::InputRecording longRecording;
+
+    shortRecording.addTick(hikari::Input::BUTTON_LEFT);
+
+    for(int i = 0; i < 10000; ++i) {
+        longRecording.addTick(hikari::Input::BUTTON_LEFT);
+    }
+
+    std::stringstream shortStream;
+    std::stringstream longStream;
+    shortRecording.write(shortStream);
+    longRecording.write(longStream);
+
+    REQUIRE( shortStream.str().size() == longStream.str().size() );
+}
+
+TEST_CASE( "InputRecording/read/rejects garbage", "Reading something that isn't a recording fails and leaves it empty" ) {
+    hikari::InputRecording recording;
+    recording.addTick(hikari::Input::BUTTON_UP);
+
+    std::stringstream stream("definitely not a recording");
+
+    REQUIRE_FALSE( recording.read(stream) );
+    REQUIRE( recording.getTickCount() == 0 );
+}
+
+TEST_CASE( "ReplayInput/replays/what was recorded", "Replaying a recording reproduces the recorded input tick by tick" ) {
+    Json::Reader reader;
+    Json::Value script;
+    reader.parse(
+        "{ \"steps\": ["
+        "    { \"frame\": 1, \"buttons\": [ \"right\" ] },"
+        "    { \"frame\": 3, \"buttons\": [ \"right\", \"shoot\" ] },"
+        "    { \"frame\": 4, \"buttons\": [ ] }"
+        "] }",
+        script,
+        false
+    );
+
+    const hikari::Input::Button buttons[] = {
+        hikari::Input::BUTTON_RIGHT,
+        hikari::Input::BUTTON_SHOOT,
+        hikari::Input::BUTTON_JUMP
+    };
+
+    hikari::InputRecorder recorder(std::make_shared<hikari::ScriptedInput>(script), 42);
+    std::vector<std::string> recorded;
+
+    for(int tick = 0; tick < 6; ++tick) {
+        recorder.update(1.0f / 60.0f);
+
+        std::string state;
+
+        for(std::size_t i = 0; i < sizeof(buttons) / sizeof(buttons[0]); ++i) {
+            state += recorder.isDown(buttons[i]) ? 'D' : 'u';
+            state += recorder.wasPressed(buttons[i]) ? 'P' : '-';
+            state += recorder.wasReleased(buttons[i]) ? 'R' : '-';
+        }
+
+        recorded.push_back(state);
+    }
+
+    hikari::ReplayInput replay(recorder.getRecording());
+
+    REQUIRE( replay.getRecording().getRandomSeed() == 42 );
+
+    for(int tick = 0; tick < 6; ++tick) {
+        replay.update(1.0f / 60.0f);
+
+        std::string state;
+
+        for(std::size_t i = 0; i < sizeof(buttons) / sizeof(buttons[0]); ++i) {
+            state += replay.isDown(buttons[i]) ? 'D' : 'u';
+            state += replay.wasPressed(buttons[i]) ? 'P' : '-';
+            state += replay.wasReleased(buttons[i]) ? 'R' : '-';
+        }
+
+        REQUIRE( state == recorded[tick] );
+    }
+
+    REQUIRE( replay.isFinished() );
+}
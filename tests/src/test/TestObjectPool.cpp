@@ -0,0 +1,129 @@
+#include "catch.hpp"
+
+#include <hikari/client/game/objects/ObjectPool.hpp>
+
+#include <memory>
+
+//
+// Tests for hikari::ObjectPool<T>
+//
+
+namespace {
+    class Pooled {
+    public:
+        static int destroyedCount;
+
+        int value;
+        int recycleCount;
+
+        explicit Pooled(int value)
+            : value(value)
+            , recycleCount(0)
+        {
+        }
+
+        ~Pooled() {
+            ++destroyedCount;
+        }
+
+        std::unique_ptr<Pooled> clone() const {
+            return std::unique_ptr<Pooled>(new Pooled(*this));
+        }
+
+        void recycle(const Pooled & proto) {
+            value = proto.value;
+            ++recycleCount;
+        }
+    };
+
+    int Pooled::destroyedCount = 0;
+
+    typedef hikari::ObjectPool<Pooled> PooledPool;
+}
+
+TEST_CASE( "ObjectPool/acquire/clones when empty", "Acquiring from an empty pool clones the prototype" ) {
+    auto pool = std::make_shared<PooledPool>(std::make_shared<Pooled>(7));
+
+    auto instance = pool->acquire();
+
+    REQUIRE( instance );
+    REQUIRE( instance != pool->getPrototype() );
+    REQUIRE( instance->value == 7 );
+    REQUIRE( pool->getCreatedCount() == 1 );
+    REQUIRE( pool->getAvailableCount() == 0 );
+}
+
+TEST_CASE( "ObjectPool/acquire/reuses returned instances", "Instances come back when the last reference goes and are recycled instead of cloning again" ) {
+    auto pool = std::make_shared<PooledPool>(std::make_shared<Pooled>(7));
+
+    auto instance = pool->acquire();
+    Pooled * address = instance.get();
+    instance->value = 42;
+
+    instance.reset();
+
+    REQUIRE( pool->getAvailableCount() == 1 );
+
+    auto reused = pool->acquire();
+
+    REQUIRE( reused.get() == address );
+    REQUIRE( reused->value == 7 );
+    REQUIRE( reused->recycleCount == 1 );
+    REQUIRE( pool->getAvailableCount() == 0 );
+    REQUIRE( pool->getCreatedCount() == 1 );
+}
+
+TEST_CASE( "ObjectPool/acquire/skips instances still in use", "Instances that are still referenced elsewhere are never handed out" ) {
+    auto pool = std::make_shared<PooledPool>(std::make_shared<Pooled>(7));
+
+    auto instance = pool->acquire();
+    auto holder = instance;
+
+    instance.reset();
+
+    auto other = pool->acquire();
+
+    REQUIRE( other != holder );
+    REQUIRE( pool->getCreatedCount() == 2 );
+
+    holder.reset();
+
+    REQUIRE( pool->getAvailableCount() == 1 );
+}
+
+TEST_CASE( "ObjectPool/acquire/expires old weak references", "A reused instance can't be reached through weak_ptrs taken before it was returned" ) {
+    auto pool = std::make_shared<PooledPool>(std::make_shared<Pooled>(7));
+
+    auto instance = pool->acquire();
+    Pooled * address = instance.get();
+    std::weak_ptr<Pooled> observer = instance;
+
+    instance.reset();
+
+    REQUIRE( observer.expired() );
+
+    auto reused = pool->acquire();
+
+    REQUIRE( reused.get() == address );
+    REQUIRE( observer.expired() );
+    REQUIRE_FALSE( observer.lock() );
+}
+
+TEST_CASE( "ObjectPool/acquire/instances can outlive the pool", "Instances returned after their pool is gone are deleted" ) {
+    auto pool = std::make_shared<PooledPool>(std::make_shared<Pooled>(7));
+
+    auto instance = pool->acquire();
+    auto spare = pool->acquire();
+    spare.reset();
+
+    const int destroyedBefore = Pooled::destroyedCount;
+
+    pool.reset();
+
+    // The prototype and the spare on the free list go with the pool
+    REQUIRE( Pooled::destroyedCount == destroyedBefore + 2 );
+
+    instance.reset();
+
+    REQUIRE( Pooled::destroyedCount == destroyedBefore + 3 );
+}
@@ -0,0 +1,157 @@
+#include "catch.hpp"
+
+#include <hikari/client/game/ParticleBuffer.hpp>
+
+#include <memory>
+#include <vector>
+
+//
+// Tests for hikari::ParticleBuffer
+//
+
+namespace {
+    const hikari::Rectangle2D<float> VIEW(0.0f, 0.0f, 256.0f, 240.0f);
+
+    /**
+     * Stands in for a texture. Textures are only ever compared, so any
+     * distinct pointer will do.
+     */
+    std::shared_ptr<sf::Texture> makeTexture(const std::shared_ptr<int> & owner) {
+        return std::shared_ptr<sf::Texture>(owner, reinterpret_cast<sf::Texture*>(owner.get()));
+    }
+
+    hikari::ParticleTemplate makeTemplate(const std::shared_ptr<sf::Texture> & texture, int frameLeft, float maximumAge = 0.0f) {
+        hikari::FrameList frames;
+        frames.push_back(hikari::AnimationFrame(hikari::Rectangle2D<int>(frameLeft, 0, 16, 8), 0.1f, hikari::Point2D<int>(8, 4)));
+
+        hikari::ParticleTemplate description;
+        description.texture = texture;
+        description.animation = std::make_shared<hikari::Animation>(frames);
+        description.boundingBox = hikari::BoundingBox<float>(0.0f, 0.0f, 16.0f, 8.0f);
+        description.maximumAge = maximumAge;
+
+        return description;
+    }
+
+    struct Quad {
+        std::size_t textureIndex;
+        float left;
+        float top;
+        float u;
+    };
+
+    struct QuadCollector {
+        std::vector<Quad> quads;
+
+        void operator()(std::size_t textureIndex, float left, float top, float width, float height, float u, float v) {
+            Quad quad;
+            quad.textureIndex = textureIndex;
+            quad.left = left;
+            quad.top = top;
+            quad.u = u;
+            quads.push_back(quad);
+        }
+    };
+}
+
+TEST_CASE( "ParticleBuffer/spawn/adds a row per particle", "Spawning stores each particle and rejects unknown templates" ) {
+    auto owner = std::make_shared<int>(0);
+    hikari::ParticleBuffer buffer;
+
+    const auto id = buffer.addTemplate("Spark", makeTemplate(makeTexture(owner), 0, 1.0f));
+
+    REQUIRE( buffer.findTemplate("Spark") == id );
+    REQUIRE( buffer.findTemplate("Smoke") == hikari::ParticleBuffer::INVALID_TEMPLATE );
+    REQUIRE( buffer.getMaximumAge(id) == Approx(1.0f) );
+
+    REQUIRE( buffer.spawn(id, hikari::Vector2<float>(10.0f, 20.0f), hikari::Vector2<float>(1.0f, -1.0f), 1.0f) );
+    REQUIRE( buffer.spawn(id, hikari::Vector2<float>(30.0f, 40.0f), hikari::Vector2<float>(0.0f, 0.0f), 1.0f) );
+    REQUIRE_FALSE( buffer.spawn(hikari::ParticleBuffer::INVALID_TEMPLATE, hikari::Vector2<float>(), hikari::Vector2<float>(), 1.0f) );
+    REQUIRE_FALSE( buffer.spawn(id + 1, hikari::Vector2<float>(), hikari::Vector2<float>(), 1.0f) );
+
+    REQUIRE( buffer.size() == 2 );
+    REQUIRE( buffer.getPosition(0).getX() == Approx(10.0f) );
+    REQUIRE( buffer.getPosition(1).getY() == Approx(40.0f) );
+
+    buffer.update(0.0f, VIEW);
+
+    // Velocities are in pixels per tick
+    REQUIRE( buffer.getPosition(0).getX() == Approx(11.0f) );
+    REQUIRE( buffer.getPosition(0).getY() == Approx(19.0f) );
+
+    buffer.clear();
+
+    REQUIRE( buffer.size() == 0 );
+    REQUIRE( buffer.findTemplate("Spark") == id );
+}
+
+TEST_CASE( "ParticleBuffer/update/kills by moving the last row", "Dead particles are replaced by the last particle and the rest stay put" ) {
+    auto owner = std::make_shared<int>(0);
+    hikari::ParticleBuffer buffer;
+
+    const auto id = buffer.addTemplate("Spark", makeTemplate(makeTexture(owner), 0));
+    const hikari::Vector2<float> still(0.0f, 0.0f);
+
+    buffer.spawn(id, hikari::Vector2<float>(10.0f, 10.0f), still, 5.0f);
+    buffer.spawn(id, hikari::Vector2<float>(20.0f, 10.0f), still, 0.5f);
+    buffer.spawn(id, hikari::Vector2<float>(30.0f, 10.0f), still, 5.0f);
+    buffer.spawn(id, hikari::Vector2<float>(40.0f, 10.0f), still, 5.0f);
+
+    buffer.update(1.0f, VIEW);
+
+    REQUIRE( buffer.size() == 3 );
+    REQUIRE( buffer.getPosition(0).getX() == Approx(10.0f) );
+    REQUIRE( buffer.getPosition(1).getX() == Approx(40.0f) );
+    REQUIRE( buffer.getPosition(2).getX() == Approx(30.0f) );
+
+    // Leaving the view kills a particle too, including the last one
+    buffer.spawn(id, hikari::Vector2<float>(1000.0f, 10.0f), still, 0.0f);
+    buffer.update(0.0f, VIEW);
+
+    REQUIRE( buffer.size() == 3 );
+    REQUIRE( buffer.getPosition(2).getX() == Approx(30.0f) );
+
+    // Particles without a maximum age live as long as they're visible
+    buffer.spawn(id, hikari::Vector2<float>(50.0f, 10.0f), still, 0.0f);
+    buffer.update(100.0f, VIEW);
+
+    REQUIRE( buffer.size() == 1 );
+    REQUIRE( buffer.getPosition(0).getX() == Approx(50.0f) );
+}
+
+TEST_CASE( "ParticleBuffer/visitQuads/batches by texture", "Templates sharing a texture share its index, so their particles end up in one batch" ) {
+    auto firstOwner = std::make_shared<int>(0);
+    auto secondOwner = std::make_shared<int>(0);
+    auto firstTexture = makeTexture(firstOwner);
+    auto secondTexture = makeTexture(secondOwner);
+    hikari::ParticleBuffer buffer;
+
+    const auto spark = buffer.addTemplate("Spark", makeTemplate(firstTexture, 0));
+    const auto smoke = buffer.addTemplate("Smoke", makeTemplate(secondTexture, 16));
+    const auto ember = buffer.addTemplate("Ember", makeTemplate(firstTexture, 32));
+
+    REQUIRE( buffer.getTextureCount() == 2 );
+    REQUIRE( buffer.getTexture(0) == firstTexture );
+    REQUIRE( buffer.getTexture(1) == secondTexture );
+
+    const hikari::Vector2<float> still(0.0f, 0.0f);
+
+    buffer.spawn(spark, hikari::Vector2<float>(20.5f, 30.75f), still, 1.0f);
+    buffer.spawn(smoke, hikari::Vector2<float>(40.0f, 30.0f), still, 1.0f);
+    buffer.spawn(ember, hikari::Vector2<float>(60.0f, 30.0f), still, 1.0f);
+
+    QuadCollector collector;
+    buffer.visitQuads(collector);
+
+    REQUIRE( collector.quads.size() == 3 );
+
+    REQUIRE( collector.quads[0].textureIndex == 0 );
+    REQUIRE( collector.quads[1].textureIndex == 1 );
+    REQUIRE( collector.quads[2].textureIndex == 0 );
+
+    // Whole pixels, less the hotspot; u comes from each template's frame
+    REQUIRE( collector.quads[0].left == Approx(12.0f) );
+    REQUIRE( collector.quads[0].top == Approx(26.0f) );
+    REQUIRE( collector.quads[1].u == Approx(16.0f) );
+    REQUIRE( collector.quads[2].u == Approx(32.0f) );
+}
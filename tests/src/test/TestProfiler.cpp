@@ -0,0 +1,102 @@
+#include "catch.hpp"
+
+#include <hikari/core/util/Profiler.hpp>
+
+#include <sstream>
+#include <string>
+
+//
+// Tests for hikari::Profiler
+//
+
+TEST_CASE( "Profiler/disabled/records nothing", "Zones and frames are ignored while the profiler is disabled" ) {
+    hikari::Profiler profiler;
+
+    profiler.beginFrame();
+    {
+        hikari::ProfileZone zone(profiler, "ignored");
+    }
+    profiler.endFrame();
+
+    REQUIRE( profiler.getFrameCount() == 0 );
+}
+
+TEST_CASE( "Profiler/zones/nest", "Nested zones are recorded with their depth" ) {
+    hikari::Profiler profiler;
+    profiler.setEnabled(true);
+
+    profiler.beginFrame();
+    {
+        hikari::ProfileZone outer(profiler, "outer");
+        {
+            hikari::ProfileZone inner(profiler, "inner");
+        }
+        {
+            hikari::ProfileZone inner(profiler, "inner");
+        }
+    }
+    profiler.endFrame();
+
+    REQUIRE( profiler.getFrameCount() == 1 );
+    REQUIRE( profiler.getFrame(0).zoneCount == 3 );
+
+    auto summaries = profiler.summarize(1);
+
+    REQUIRE( summaries.size() == 2 );
+    REQUIRE( std::string(summaries[0].name) == "outer" );
+    REQUIRE( summaries[0].depth == 0 );
+    REQUIRE( summaries[0].calls == 1 );
+    REQUIRE( std::string(summaries[1].name) == "inner" );
+    REQUIRE( summaries[1].depth == 1 );
+    REQUIRE( summaries[1].calls == 2 );
+    REQUIRE( summaries[0].totalDuration >= summaries[1].totalDuration );
+}
+
+TEST_CASE( "Profiler/frames/ring buffer", "Only the most recent frames are kept" ) {
+    hikari::Profiler profiler(4, 8);
+    profiler.setEnabled(true);
+
+    for(int i = 0; i < 10; ++i) {
+        profiler.beginFrame();
+        {
+            hikari::ProfileZone first(profiler, "first");
+        }
+        {
+            hikari::ProfileZone second(profiler, "second");
+        }
+        profiler.endFrame();
+    }
+
+    REQUIRE( profiler.getFrameCount() == 4 );
+    REQUIRE( profiler.getFrame(0).firstZone == 18 );
+    REQUIRE( profiler.getFrame(3).firstZone == 12 );
+
+    // The zone buffer only holds 8 zones, so 4 frames x 2 zones all fit.
+    auto summaries = profiler.summarize(10);
+
+    REQUIRE( summaries.size() == 2 );
+    REQUIRE( summaries[0].calls == 4 );
+    REQUIRE( summaries[1].calls == 4 );
+}
+
+TEST_CASE( "Profiler/writeChromeTrace", "Frames and zones are written as complete trace events" ) {
+    hikari::Profiler profiler;
+    profiler.setEnabled(true);
+
+    profiler.beginFrame();
+    {
+        hikari::ProfileZone zone(profiler, "say \"hi\"");
+    }
+    profiler.endFrame();
+
+    std::ostringstream output;
+    profiler.writeChromeTrace(output);
+
+    const std::string trace = output.str();
+
+    REQUIRE( trace.find("\"traceEvents\":[") != std::string::npos );
+    REQUIRE( trace.find("\"name\":\"Frame\"") != std::string::npos );
+    REQUIRE( trace.find("\"name\":\"say \\\"hi\\\"\"") != std::string::npos );
+    REQUIRE( trace.find("\"ph\":\"X\"") != std::string::npos );
+    REQUIRE( trace.substr(trace.size() - 3) == "]}\n" );
+}
@@ -0,0 +1,39 @@
+#include "catch.hpp"
+
+#include <hikari/core/util/Random.hpp>
+
+//
+// Tests for hikari::Random
+//
+
+TEST_CASE( "Random/seed/repeats the sequence", "Generators with the same seed produce the same numbers" ) {
+    hikari::Random first(99);
+    hikari::Random second(99);
+
+    for(int i = 0; i < 100; ++i) {
+        REQUIRE( first.next() == second.next() );
+    }
+
+    first.seed(7);
+    second.seed(7);
+
+    REQUIRE( first.getSeed() == 7 );
+    REQUIRE( first.nextInt(100) == second.nextInt(100) );
+}
+
+TEST_CASE( "Random/nextInt/stays in range", "nextInt and nextFloat stay within their bounds" ) {
+    hikari::Random random(1);
+
+    for(int i = 0; i < 1000; ++i) {
+        const int value = random.nextInt(100);
+        const float fraction = random.nextFloat();
+
+        REQUIRE( value >= 0 );
+        REQUIRE( value < 100 );
+        REQUIRE( fraction >= 0.0f );
+        REQUIRE( fraction < 1.0f );
+    }
+
+    REQUIRE( random.nextInt(0) == 0 );
+    REQUIRE( random.nextInt(-5) == 0 );
+}
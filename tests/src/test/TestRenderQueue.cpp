@@ -0,0 +1,118 @@
+#include "catch.hpp"
+
+#include <hikari/client/game/RenderQueue.hpp>
+#include <hikari/core/game/Renderable.hpp>
+
+namespace {
+
+    class FakeRenderable : public hikari::Renderable {
+    private:
+        int zIndex;
+
+    public:
+        explicit FakeRenderable(int zIndex = 0)
+            : zIndex(zIndex)
+        {
+
+        }
+
+        virtual void render(sf::RenderTarget & target) { }
+        virtual void render(hikari::SpriteBatch & batch) { }
+        virtual void setZIndex(int index) { zIndex = index; }
+        virtual int getZIndex() const { return zIndex; }
+    };
+
+}
+
+//
+// Tests for hikari::RenderQueue
+//
+
+TEST_CASE( "RenderQueue/add/keeps drawing order", "Renderables are ordered by z-index, then layer, then when they were added" ) {
+    hikari::RenderQueue queue;
+    FakeRenderable front(1);
+    FakeRenderable back(-1);
+    FakeRenderable lowLayer(0);
+    FakeRenderable highLayer(0);
+    FakeRenderable highLayerLater(0);
+
+    queue.add(&front);
+    queue.add(&highLayer, 2);
+    queue.add(&back);
+    queue.add(&highLayerLater, 2);
+    queue.add(&lowLayer, 1);
+
+    REQUIRE( queue.size() == 5 );
+    REQUIRE( queue.at(0) == &back );
+    REQUIRE( queue.at(1) == &lowLayer );
+    REQUIRE( queue.at(2) == &highLayer );
+    REQUIRE( queue.at(3) == &highLayerLater );
+    REQUIRE( queue.at(4) == &front );
+}
+
+TEST_CASE( "RenderQueue/update/picks up z-index changes", "Changing a z-index moves the Renderable on the next update" ) {
+    hikari::RenderQueue queue;
+    FakeRenderable first(0);
+    FakeRenderable second(0);
+    FakeRenderable third(0);
+
+    queue.add(&first);
+    queue.add(&second);
+    queue.add(&third);
+
+    third.setZIndex(-1);
+    first.setZIndex(2);
+    queue.update();
+
+    REQUIRE( queue.at(0) == &third );
+    REQUIRE( queue.at(1) == &second );
+    REQUIRE( queue.at(2) == &first );
+
+    // Moving back restores the original order among equals.
+    third.setZIndex(0);
+    first.setZIndex(0);
+    queue.update();
+
+    REQUIRE( queue.at(0) == &first );
+    REQUIRE( queue.at(1) == &second );
+    REQUIRE( queue.at(2) == &third );
+}
+
+TEST_CASE( "RenderQueue/remove/keeps the rest in order", "Removing a Renderable leaves the others where they were" ) {
+    hikari::RenderQueue queue;
+    FakeRenderable first(0);
+    FakeRenderable second(0);
+    FakeRenderable third(0);
+
+    queue.add(&first);
+    queue.add(&second);
+    queue.add(&third);
+
+    REQUIRE( queue.remove(&second) );
+    REQUIRE_FALSE( queue.remove(&second) );
+    REQUIRE_FALSE( queue.contains(&second) );
+    REQUIRE( queue.size() == 2 );
+    REQUIRE( queue.at(0) == &first );
+    REQUIRE( queue.at(1) == &third );
+
+    queue.clear();
+
+    REQUIRE( queue.empty() );
+}
+
+TEST_CASE( "RenderQueue/lowerBound/splits background from foreground", "lowerBound finds the first Renderable at or above a z-index" ) {
+    hikari::RenderQueue queue;
+    FakeRenderable back(-2);
+    FakeRenderable middle(-1);
+    FakeRenderable front(0);
+
+    REQUIRE( queue.lowerBound(0) == 0 );
+
+    queue.add(&front);
+    queue.add(&back);
+    queue.add(&middle);
+
+    REQUIRE( queue.lowerBound(0) == 2 );
+    REQUIRE( queue.lowerBound(-1) == 1 );
+    REQUIRE( queue.lowerBound(5) == 3 );
+}
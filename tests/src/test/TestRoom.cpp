@@ -0,0 +1,241 @@
+#include "catch.hpp"
+
+#include <hikari/core/game/map/Force.hpp>
+#include <hikari/core/game/map/Room.hpp>
+#include <hikari/core/game/map/RoomTransition.hpp>
+#include <hikari/core/game/map/TileAttribute.hpp>
+#include <hikari/core/geom/BoundingBox.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+//
+// Tests for hikari::Room's ladder, force and transition queries
+//
+
+namespace {
+    const int ROOM_X = 2;
+    const int ROOM_Y = 1;
+    const int ROOM_WIDTH = 40;
+    const int ROOM_HEIGHT = 30;
+    const int GRID_SIZE = 16;
+
+    /**
+     * Builds a room covering several index cells. The first ladder, force
+     * and transition of each kind are long enough to cover more than one
+     * cell; the rest fit inside a single cell.
+     */
+    std::unique_ptr<hikari::Room> makeRoom() {
+        std::vector<int> tile(ROOM_WIDTH * ROOM_HEIGHT, hikari::Room::NO_TILE);
+        std::vector<int> attr(ROOM_WIDTH * ROOM_HEIGHT, hikari::TileAttribute::NO_ATTRIBUTES);
+
+        // A ladder running the full height of the room...
+        for(int y = 0; y < ROOM_HEIGHT; ++y) {
+            attr[10 + (y * ROOM_WIDTH)] = hikari::TileAttribute::LADDER;
+        }
+
+        // ...and a short one, followed by a second in the same column.
+        for(int y = 5; y < 8; ++y) {
+            attr[30 + (y * ROOM_WIDTH)] = hikari::TileAttribute::LADDER;
+        }
+
+        for(int y = 20; y < 22; ++y) {
+            attr[30 + (y * ROOM_WIDTH)] = hikari::TileAttribute::LADDER;
+        }
+
+        std::vector<std::shared_ptr<hikari::Force>> forces;
+        forces.push_back(std::make_shared<hikari::Force>(
+            hikari::BoundingBox<float>(64.0f, 64.0f, 400.0f, 300.0f), hikari::Vector2<float>(1.0f, 0.0f)));
+        forces.push_back(std::make_shared<hikari::Force>(
+            hikari::BoundingBox<float>(500.0f, 40.0f, 16.0f, 16.0f), hikari::Vector2<float>(0.0f, 1.0f)));
+        forces.push_back(std::make_shared<hikari::Force>(
+            hikari::BoundingBox<float>(600.0f, 400.0f, 32.0f, 32.0f), hikari::Vector2<float>(-1.0f, 0.0f)));
+
+        std::vector<hikari::RoomTransition> transitions;
+        transitions.push_back(hikari::RoomTransition(0, 1, ROOM_WIDTH, 1, 0, ROOM_HEIGHT - 1, hikari::RoomTransition::DirectionDown, false, false));
+        transitions.push_back(hikari::RoomTransition(0, 2, 1, 3, ROOM_WIDTH - 1, 2, hikari::RoomTransition::DirectionForward, false, false));
+
+        return std::unique_ptr<hikari::Room>(new hikari::Room(
+            0, ROOM_X, ROOM_Y, ROOM_WIDTH, ROOM_HEIGHT, GRID_SIZE, hikari::Room::DEFAULT_BG_COLOR,
+            hikari::Point2D<int>(0, 0),
+            hikari::Rectangle2D<int>(ROOM_X * GRID_SIZE, ROOM_Y * GRID_SIZE, ROOM_WIDTH * GRID_SIZE, ROOM_HEIGHT * GRID_SIZE),
+            tile,
+            attr,
+            transitions,
+            std::vector<std::shared_ptr<hikari::Spawner>>(),
+            forces,
+            std::vector<hikari::BlockSequenceDescriptor>(),
+            nullptr,
+            nullptr,
+            hikari::Room::DEFAULT_BOSS_ENTITY_NAME
+        ));
+    }
+
+    /**
+     * The world-space bounds of a room's transitions, worked out the same
+     * way the game did before rooms had an index.
+     */
+    std::vector<hikari::BoundingBox<float>> transitionBoundsOf(const hikari::Room & room) {
+        std::vector<hikari::BoundingBox<float>> bounds;
+        const auto & transitions = room.getTransitions();
+
+        for(auto it = std::begin(transitions), end = std::end(transitions); it != end; it++) {
+            bounds.push_back(hikari::BoundingBox<float>(
+                static_cast<float>((room.getX() + it->getX()) * room.getGridSize()),
+                static_cast<float>((room.getY() + it->getY()) * room.getGridSize()),
+                static_cast<float>(it->getWidth() * room.getGridSize()),
+                static_cast<float>(it->getHeight() * room.getGridSize())
+            ));
+        }
+
+        return bounds;
+    }
+
+    std::vector<hikari::BoundingBox<float>> forceBoundsOf(const hikari::Room & room) {
+        std::vector<hikari::BoundingBox<float>> bounds;
+        const auto & forces = room.getForces();
+
+        for(auto it = std::begin(forces), end = std::end(forces); it != end; it++) {
+            bounds.push_back((*it)->getBounds());
+        }
+
+        return bounds;
+    }
+
+    /**
+     * Checks every feature against the region, like the old linear scans.
+     */
+    std::vector<int> linearScan(const std::vector<hikari::BoundingBox<float>> & features, const hikari::BoundingBox<float> & region) {
+        std::vector<int> results;
+
+        for(std::size_t i = 0; i < features.size(); ++i) {
+            if(features[i].intersects(region)) {
+                results.push_back(static_cast<int>(i));
+            }
+        }
+
+        return results;
+    }
+
+    bool isStrictlyAscending(const std::vector<int> & results) {
+        return std::adjacent_find(std::begin(results), std::end(results), [](int a, int b) {
+            return a >= b;
+        }) == std::end(results);
+    }
+
+    /**
+     * Hero-sized and larger regions swept across the room and a little
+     * beyond its edges, so some straddle cell boundaries.
+     */
+    std::vector<hikari::BoundingBox<float>> sampleRegions() {
+        std::vector<hikari::BoundingBox<float>> regions;
+        const float left = static_cast<float>(ROOM_X * GRID_SIZE) - 32.0f;
+        const float top = static_cast<float>(ROOM_Y * GRID_SIZE) - 32.0f;
+        const float right = static_cast<float>((ROOM_X + ROOM_WIDTH) * GRID_SIZE) + 32.0f;
+        const float bottom = static_cast<float>((ROOM_Y + ROOM_HEIGHT) * GRID_SIZE) + 32.0f;
+
+        for(float y = top; y < bottom; y += 24.0f) {
+            for(float x = left; x < right; x += 24.0f) {
+                regions.push_back(hikari::BoundingBox<float>(x, y, 16.0f, 24.0f));
+                regions.push_back(hikari::BoundingBox<float>(x, y, 150.0f, 90.0f));
+            }
+        }
+
+        return regions;
+    }
+}
+
+TEST_CASE( "Room/queryLadders/finds a ladder once across cells", "A ladder covering several cells is reported once" ) {
+    auto room = makeRoom();
+    std::vector<int> results;
+
+    REQUIRE( room->getLadders().size() == 3 );
+
+    // The tall ladder crosses every row of cells in the room.
+    const auto & tallLadder = room->getLadders()[0];
+    REQUIRE( static_cast<int>(tallLadder.getTop() / 128.0f) != static_cast<int>((tallLadder.getBottom() - 1.0f) / 128.0f) );
+
+    room->queryLadders(hikari::BoundingBox<float>(0.0f, 0.0f, 1024.0f, 1024.0f), results);
+
+    REQUIRE( results.size() == 3 );
+    REQUIRE( isStrictlyAscending(results) );
+
+    room->queryLadders(hikari::BoundingBox<float>(tallLadder.getLeft(), tallLadder.getTop(), 4.0f, tallLadder.getHeight()), results);
+
+    REQUIRE( results.size() == 1 );
+    REQUIRE( results[0] == 0 );
+}
+
+TEST_CASE( "Room/queryLadders/matches a linear scan", "Ladder queries return what checking every ladder would" ) {
+    auto room = makeRoom();
+    const auto regions = sampleRegions();
+    std::vector<int> results;
+
+    for(auto it = std::begin(regions), end = std::end(regions); it != end; it++) {
+        room->queryLadders(*it, results);
+
+        REQUIRE( isStrictlyAscending(results) );
+        REQUIRE( (results == linearScan(room->getLadders(), *it)) );
+    }
+}
+
+TEST_CASE( "Room/queryForces/finds a force once across cells", "A force covering several cells is reported once" ) {
+    auto room = makeRoom();
+    std::vector<int> results;
+
+    room->queryForces(hikari::BoundingBox<float>(0.0f, 0.0f, 1024.0f, 1024.0f), results);
+
+    REQUIRE( results.size() == 3 );
+    REQUIRE( isStrictlyAscending(results) );
+
+    room->queryForces(hikari::BoundingBox<float>(100.0f, 100.0f, 300.0f, 200.0f), results);
+
+    REQUIRE( results.size() == 1 );
+    REQUIRE( results[0] == 0 );
+}
+
+TEST_CASE( "Room/queryForces/matches a linear scan", "Force queries return what checking every force would" ) {
+    auto room = makeRoom();
+    const auto forceBounds = forceBoundsOf(*room);
+    const auto regions = sampleRegions();
+    std::vector<int> results;
+
+    for(auto it = std::begin(regions), end = std::end(regions); it != end; it++) {
+        room->queryForces(*it, results);
+
+        REQUIRE( isStrictlyAscending(results) );
+        REQUIRE( (results == linearScan(forceBounds, *it)) );
+    }
+}
+
+TEST_CASE( "Room/queryTransitions/finds a transition once across cells", "A transition covering several cells is reported once" ) {
+    auto room = makeRoom();
+    const auto transitionBounds = transitionBoundsOf(*room);
+    std::vector<int> results;
+
+    room->queryTransitions(hikari::BoundingBox<float>(0.0f, 0.0f, 1024.0f, 1024.0f), results);
+
+    REQUIRE( results.size() == 2 );
+    REQUIRE( isStrictlyAscending(results) );
+
+    // Along the whole bottom edge, which spans every column of cells.
+    room->queryTransitions(transitionBounds[0], results);
+
+    REQUIRE( results.size() == 1 );
+    REQUIRE( results[0] == 0 );
+}
+
+TEST_CASE( "Room/queryTransitions/matches a linear scan", "Transition queries return what checking every transition would" ) {
+    auto room = makeRoom();
+    const auto transitionBounds = transitionBoundsOf(*room);
+    const auto regions = sampleRegions();
+    std::vector<int> results;
+
+    for(auto it = std::begin(regions), end = std::end(regions); it != end; it++) {
+        room->queryTransitions(*it, results);
+
+        REQUIRE( isStrictlyAscending(results) );
+        REQUIRE( (results == linearScan(transitionBounds, *it)) );
+    }
+}
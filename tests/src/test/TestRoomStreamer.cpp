@@ -0,0 +1,150 @@
+#include "catch.hpp"
+
+#include <hikari/core/game/map/RoomBlueprint.hpp>
+#include <hikari/core/game/map/RoomStreamer.hpp>
+#include <hikari/core/game/map/RoomStreamWorker.hpp>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//
+// Tests for hikari::RoomStreamer and hikari::RoomStreamWorker
+//
+
+namespace {
+    /**
+     * Hands out empty blueprints whose transitions lead to the given rooms,
+     * and remembers which thread read each room.
+     */
+    struct FakeStage {
+        std::map<unsigned int, std::vector<int>> links;
+        std::mutex mutex;
+        std::map<unsigned int, std::vector<std::thread::id>> reads;
+        std::vector<int> finished;
+
+        std::unique_ptr<hikari::RoomBlueprint> read(unsigned int index) {
+            std::unique_ptr<hikari::RoomBlueprint> blueprint(new hikari::RoomBlueprint());
+            blueprint->id = static_cast<int>(index);
+
+            const std::vector<int> & targets = links[index];
+
+            for(auto it = std::begin(targets), end = std::end(targets); it != end; it++) {
+                blueprint->transitions.push_back(
+                    hikari::RoomTransition(static_cast<int>(index), *it, 1, 1, 0, 0, hikari::RoomTransition::DirectionForward, false, false)
+                );
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            reads[index].push_back(std::this_thread::get_id());
+
+            return blueprint;
+        }
+
+        std::size_t readCount(unsigned int index) {
+            std::lock_guard<std::mutex> lock(mutex);
+            return reads[index].size();
+        }
+
+        std::shared_ptr<hikari::RoomStreamer> makeStreamer(unsigned int roomCount, const std::shared_ptr<hikari::RoomStreamWorker> & worker) {
+            return std::make_shared<hikari::RoomStreamer>(
+                [this](unsigned int index) {
+                    return read(index);
+                },
+                [this](hikari::RoomBlueprint & blueprint) {
+                    finished.push_back(blueprint.id);
+                    return hikari::RoomPtr();
+                },
+                roomCount,
+                worker
+            );
+        }
+    };
+}
+
+TEST_CASE( "RoomStreamer/getRoom/builds rooms lazily", "Rooms are only read and finished when they are asked for" ) {
+    auto worker = std::make_shared<hikari::RoomStreamWorker>();
+    FakeStage stage;
+    stage.links[0] = { 1 };
+
+    auto streamer = stage.makeStreamer(4, worker);
+    streamer->waitForPrefetches();
+
+    REQUIRE( stage.readCount(0) == 0 );
+    REQUIRE( stage.finished.empty() );
+
+    streamer->getRoom(2);
+    streamer->waitForPrefetches();
+
+    REQUIRE( stage.readCount(2) == 1 );
+    REQUIRE( stage.reads[2][0] == std::this_thread::get_id() );
+    REQUIRE( stage.finished.size() == 1 );
+    REQUIRE( stage.finished[0] == 2 );
+
+    // Room 2 leads nowhere, so nothing else was touched
+    REQUIRE( stage.readCount(0) == 0 );
+    REQUIRE( stage.readCount(1) == 0 );
+    REQUIRE( stage.readCount(3) == 0 );
+
+    streamer->getRoom(4);
+
+    REQUIRE( stage.readCount(4) == 0 );
+    REQUIRE( stage.finished.size() == 1 );
+}
+
+TEST_CASE( "RoomStreamer/getRoom/prefetches adjacent rooms", "The rooms a room leads to are read on the worker thread" ) {
+    auto worker = std::make_shared<hikari::RoomStreamWorker>();
+    FakeStage stage;
+    stage.links[0] = { 1, 2, -1 };
+    stage.links[1] = { 0 };
+
+    auto streamer = stage.makeStreamer(4, worker);
+
+    streamer->getRoom(0);
+    streamer->waitForPrefetches();
+
+    REQUIRE( stage.readCount(1) == 1 );
+    REQUIRE( stage.readCount(2) == 1 );
+    REQUIRE( stage.readCount(3) == 0 );
+    REQUIRE( stage.reads[1][0] != std::this_thread::get_id() );
+    REQUIRE( stage.reads[2][0] != std::this_thread::get_id() );
+
+    // The prepared blueprint is used instead of reading the room again, and
+    // room 0 isn't queued a second time by room 1's transition back to it.
+    streamer->getRoom(1);
+    streamer->waitForPrefetches();
+
+    REQUIRE( stage.readCount(0) == 1 );
+    REQUIRE( stage.readCount(1) == 1 );
+    REQUIRE( stage.finished.size() == 2 );
+    REQUIRE( stage.finished[1] == 1 );
+}
+
+TEST_CASE( "RoomStreamWorker/schedule/serves several streamers", "One worker prepares rooms for every map and outlives dropped ones" ) {
+    auto worker = std::make_shared<hikari::RoomStreamWorker>();
+    FakeStage first;
+    FakeStage second;
+
+    auto firstStreamer = first.makeStreamer(2, worker);
+    auto secondStreamer = second.makeStreamer(2, worker);
+
+    firstStreamer->prefetch(1);
+    secondStreamer->prefetch(0);
+    firstStreamer->waitForPrefetches();
+    secondStreamer->waitForPrefetches();
+
+    REQUIRE( first.readCount(1) == 1 );
+    REQUIRE( second.readCount(0) == 1 );
+    REQUIRE( first.reads[1][0] == second.reads[0][0] );
+
+    // Dropping a map with rooms still queued leaves the worker usable
+    firstStreamer->prefetch(0);
+    firstStreamer.reset();
+
+    secondStreamer->prefetch(1);
+    secondStreamer->waitForPrefetches();
+
+    REQUIRE( second.readCount(1) == 1 );
+}
@@ -0,0 +1,83 @@
+#include "catch.hpp"
+
+#include <hikari/client/audio/SampleCache.hpp>
+
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+//
+// Tests for hikari::SampleCache
+//
+
+namespace {
+    std::vector<char> writeToBuffer(std::uint32_t sampleRate, std::uint32_t channelCount, const std::vector<short> & pcm) {
+        std::ostringstream output;
+        hikari::SampleCache::write(output, sampleRate, channelCount, pcm);
+
+        const std::string written = output.str();
+        return std::vector<char>(std::begin(written), std::end(written));
+    }
+}
+
+TEST_CASE( "SampleCache/write/round trips", "Written samples read back identically" ) {
+    const std::vector<short> pcm = { 0, 1, -1, 32767, -32768, 1234 };
+    const std::vector<char> contents = writeToBuffer(44100, 2, pcm);
+
+    REQUIRE( contents.size() == sizeof(hikari::SampleCache::Header) + pcm.size() * sizeof(short) );
+    REQUIRE( std::memcmp(&contents[0], "HKSC", 4) == 0 );
+
+    std::vector<short> loaded;
+
+    REQUIRE( hikari::SampleCache::read(contents, 44100, 2, loaded) );
+    REQUIRE( (loaded == pcm) );
+}
+
+TEST_CASE( "SampleCache/read/rejects stale files", "Files rendered differently or by another version are rejected" ) {
+    const std::vector<short> pcm = { 10, 20, 30, 40 };
+    const std::vector<short> untouched = { 99 };
+    std::vector<short> loaded = untouched;
+
+    SECTION( "different sample rate" ) {
+        REQUIRE_FALSE( hikari::SampleCache::read(writeToBuffer(22050, 2, pcm), 44100, 2, loaded) );
+    }
+
+    SECTION( "different channel count" ) {
+        REQUIRE_FALSE( hikari::SampleCache::read(writeToBuffer(44100, 1, pcm), 44100, 2, loaded) );
+    }
+
+    SECTION( "older version" ) {
+        std::vector<char> contents = writeToBuffer(44100, 2, pcm);
+        hikari::SampleCache::Header header;
+        std::memcpy(&header, &contents[0], sizeof(header));
+        header.version = hikari::SampleCache::VERSION - 1;
+        std::memcpy(&contents[0], &header, sizeof(header));
+
+        REQUIRE_FALSE( hikari::SampleCache::read(contents, 44100, 2, loaded) );
+    }
+
+    SECTION( "truncated samples" ) {
+        std::vector<char> contents = writeToBuffer(44100, 2, pcm);
+        contents.pop_back();
+
+        REQUIRE_FALSE( hikari::SampleCache::read(contents, 44100, 2, loaded) );
+    }
+
+    SECTION( "truncated header" ) {
+        std::vector<char> contents = writeToBuffer(44100, 2, pcm);
+        contents.resize(sizeof(hikari::SampleCache::Header) - 1);
+
+        REQUIRE_FALSE( hikari::SampleCache::read(contents, 44100, 2, loaded) );
+    }
+
+    SECTION( "not a cache file" ) {
+        std::vector<char> contents = writeToBuffer(44100, 2, pcm);
+        contents[0] = 'X';
+
+        REQUIRE_FALSE( hikari::SampleCache::read(contents, 44100, 2, loaded) );
+        REQUIRE_FALSE( hikari::SampleCache::read(std::vector<char>(), 44100, 2, loaded) );
+    }
+
+    REQUIRE( (loaded == untouched) );
+}
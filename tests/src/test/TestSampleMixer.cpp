@@ -0,0 +1,116 @@
+#include "catch.hpp"
+
+#include <hikari/client/audio/SampleMixer.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+//
+// Tests for hikari::mixSamples
+//
+
+TEST_CASE( "SampleMixer/mixSamples/no sources", "Mixing nothing produces silence" ) {
+    std::vector<short> output(4, 123);
+
+    hikari::mixSamples(nullptr, 0, &output[0], output.size());
+
+    REQUIRE( std::count(std::begin(output), std::end(output), 0) == 4 );
+}
+
+TEST_CASE( "SampleMixer/mixSamples/single source", "Mixing one source copies it" ) {
+    const short samples[] = { -5, 0, 7, SHRT_MAX };
+    const short * sources[] = { samples };
+    std::vector<short> output(4, 0);
+
+    hikari::mixSamples(sources, 1, &output[0], output.size());
+
+    REQUIRE( output[0] == -5 );
+    REQUIRE( output[1] == 0 );
+    REQUIRE( output[2] == 7 );
+    REQUIRE( output[3] == SHRT_MAX );
+}
+
+TEST_CASE( "SampleMixer/mixSamples/sums sources", "Mixing several sources adds them together" ) {
+    const short a[] = { 100, -100, 0 };
+    const short b[] = { 20, -20, 5 };
+    const short c[] = { 3, -3, -5 };
+    const short * sources[] = { a, b, c };
+    std::vector<short> output(3, 0);
+
+    hikari::mixSamples(sources, 3, &output[0], output.size());
+
+    REQUIRE( output[0] == 123 );
+    REQUIRE( output[1] == -123 );
+    REQUIRE( output[2] == 0 );
+}
+
+TEST_CASE( "SampleMixer/mixSamples/saturates", "Mixing clamps instead of wrapping around" ) {
+    const short a[] = { 30000, -30000 };
+    const short b[] = { 30000, -30000 };
+    const short * sources[] = { a, b };
+    std::vector<short> output(2, 0);
+
+    hikari::mixSamples(sources, 2, &output[0], output.size());
+
+    REQUIRE( output[0] == SHRT_MAX );
+    REQUIRE( output[1] == SHRT_MIN );
+}
+
+TEST_CASE( "SampleMixer/mixSamples/partial blocks", "Buffers that aren't a whole number of blocks are fully mixed" ) {
+    const std::vector<short> a(300, 1);
+    const std::vector<short> b(300, 2);
+    const short * sources[] = { &a[0], &b[0] };
+    std::vector<short> output(300, 0);
+
+    hikari::mixSamples(sources, 2, &output[0], output.size());
+
+    REQUIRE( std::count(std::begin(output), std::end(output), 3) == 300 );
+}
+
+//
+// Mixing cost benchmark; hidden from the default run. Use:
+//   tests "[benchmark]"
+//
+TEST_CASE( "SampleMixer/benchmark/mix cost per buffer", "[.][benchmark] Measures mixing cost for 1-8 samplers" ) {
+    const std::size_t bufferSize = 4096;
+    const int iterations = 2000;
+
+    std::vector<std::vector<short>> buffers(8, std::vector<short>(bufferSize));
+    std::srand(1);
+
+    for(auto buffer = std::begin(buffers); buffer != std::end(buffers); ++buffer) {
+        for(auto sample = std::begin(*buffer); sample != std::end(*buffer); ++sample) {
+            *sample = static_cast<short>((std::rand() % 65536) - 32768);
+        }
+    }
+
+    std::vector<const short*> sources;
+    std::vector<short> output(bufferSize);
+
+    typedef std::chrono::high_resolution_clock Clock;
+
+    std::cout << "SampleMixer benchmark (" << bufferSize << " samples per buffer, "
+              << iterations << " buffers)" << std::endl;
+
+    for(std::size_t samplerCount = 1; samplerCount <= buffers.size(); ++samplerCount) {
+        sources.push_back(&buffers[samplerCount - 1][0]);
+
+        const auto start = Clock::now();
+
+        for(int i = 0; i < iterations; ++i) {
+            hikari::mixSamples(sources.data(), sources.size(), &output[0], bufferSize);
+        }
+
+        const auto end = Clock::now();
+        const auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+        std::cout << "  " << samplerCount << " sampler(s): "
+                  << (nanos / iterations) << " ns/buffer" << std::endl;
+    }
+
+    REQUIRE( sources.size() == buffers.size() );
+}
@@ -0,0 +1,77 @@
+#include "catch.hpp"
+
+#include <hikari/client/game/ScriptedInput.hpp>
+
+#include <json/reader.h>
+#include <json/value.h>
+
+#include <string>
+
+//
+// Tests for hikari::ScriptedInput
+//
+
+namespace {
+
+    Json::Value parseScript(const std::string & text) {
+        Json::Reader reader;
+        Json::Value script;
+        reader.parse(text, script, false);
+        return script;
+    }
+
+}
+
+TEST_CASE( "ScriptedInput/empty script/presses nothing", "An empty script never presses any buttons" ) {
+    hikari::ScriptedInput input((Json::Value()));
+
+    REQUIRE( input.isFinished() );
+    REQUIRE( input.isUp(hikari::Input::BUTTON_JUMP) );
+
+    input.update(1.0f / 60.0f);
+
+    REQUIRE( input.isUp(hikari::Input::BUTTON_JUMP) );
+    REQUIRE( input.getFrame() == 1 );
+}
+
+TEST_CASE( "ScriptedInput/steps/apply on their frame", "Buttons go down and up on the frames the script says" ) {
+    hikari::ScriptedInput input(parseScript(
+        "{ \"steps\": ["
+        "    { \"frame\": 0, \"buttons\": [ \"right\" ] },"
+        "    { \"frame\": 2, \"buttons\": [ \"right\", \"jump\" ] },"
+        "    { \"frame\": 4, \"buttons\": [ ] }"
+        "] }"
+    ));
+
+    // Frame 0
+    REQUIRE( input.isDown(hikari::Input::BUTTON_RIGHT) );
+    REQUIRE( input.wasPressed(hikari::Input::BUTTON_RIGHT) );
+    REQUIRE( input.isUp(hikari::Input::BUTTON_JUMP) );
+
+    // Frame 1
+    input.update(1.0f / 60.0f);
+    REQUIRE( input.isHeld(hikari::Input::BUTTON_RIGHT) );
+    REQUIRE_FALSE( input.wasPressed(hikari::Input::BUTTON_RIGHT) );
+
+    // Frame 2
+    input.update(1.0f / 60.0f);
+    REQUIRE( input.wasPressed(hikari::Input::BUTTON_JUMP) );
+    REQUIRE( input.isHeld(hikari::Input::BUTTON_RIGHT) );
+
+    // Frame 3
+    input.update(1.0f / 60.0f);
+    REQUIRE( input.isHeld(hikari::Input::BUTTON_JUMP) );
+    REQUIRE_FALSE( input.isFinished() );
+
+    // Frame 4
+    input.update(1.0f / 60.0f);
+    REQUIRE( input.wasReleased(hikari::Input::BUTTON_RIGHT) );
+    REQUIRE( input.wasReleased(hikari::Input::BUTTON_JUMP) );
+    REQUIRE( input.isUp(hikari::Input::BUTTON_RIGHT) );
+    REQUIRE( input.isFinished() );
+}
+
+TEST_CASE( "ScriptedInput/parseButton/unknown names", "Unknown button names map to BUTTON_NONE" ) {
+    REQUIRE( hikari::ScriptedInput::parseButton("shoot") == hikari::Input::BUTTON_SHOOT );
+    REQUIRE( hikari::ScriptedInput::parseButton("fly") == hikari::Input::BUTTON_NONE );
+}
@@ -0,0 +1,95 @@
+#include "catch.hpp"
+
+#include <hikari/core/util/ShelfPacker.hpp>
+#include <hikari/core/geom/Rectangle2D.hpp>
+
+#include <vector>
+
+//
+// Tests for hikari::ShelfPacker
+//
+
+TEST_CASE( "ShelfPacker/insert/places rectangles in rows", "Rectangles fill a shelf left to right before a new one is opened" ) {
+    hikari::ShelfPacker packer(64, 64);
+    hikari::Rectangle2D<int> placement;
+
+    REQUIRE( packer.insert(32, 16, placement) );
+    REQUIRE( placement.getX() == 0 );
+    REQUIRE( placement.getY() == 0 );
+    REQUIRE( placement.getWidth() == 32 );
+    REQUIRE( placement.getHeight() == 16 );
+
+    REQUIRE( packer.insert(32, 16, placement) );
+    REQUIRE( placement.getX() == 32 );
+    REQUIRE( placement.getY() == 0 );
+
+    REQUIRE( packer.insert(16, 16, placement) );
+    REQUIRE( placement.getX() == 0 );
+    REQUIRE( placement.getY() == 16 );
+
+    REQUIRE( packer.getOccupancy() == Approx(0.5f) );
+}
+
+TEST_CASE( "ShelfPacker/insert/keeps padding between rectangles", "Padding is left to the right of and below each rectangle" ) {
+    hikari::ShelfPacker packer(64, 64, 1);
+    hikari::Rectangle2D<int> first;
+    hikari::Rectangle2D<int> second;
+    hikari::Rectangle2D<int> third;
+
+    REQUIRE( packer.insert(16, 16, first) );
+    REQUIRE( packer.insert(16, 16, second) );
+    REQUIRE( second.getX() == first.getX() + first.getWidth() + 1 );
+    REQUIRE( second.getY() == first.getY() );
+
+    REQUIRE( packer.insert(48, 16, third) );
+    REQUIRE( third.getX() == 0 );
+    REQUIRE( third.getY() == first.getY() + first.getHeight() + 1 );
+}
+
+TEST_CASE( "ShelfPacker/insert/reuses the tightest shelf", "A short rectangle goes on the shortest shelf it fits on" ) {
+    hikari::ShelfPacker packer(64, 128);
+    hikari::Rectangle2D<int> placement;
+
+    REQUIRE( packer.insert(48, 32, placement) );
+    REQUIRE( packer.insert(48, 8, placement) );
+    REQUIRE( placement.getY() == 32 );
+
+    REQUIRE( packer.insert(8, 8, placement) );
+    REQUIRE( placement.getX() == 48 );
+    REQUIRE( placement.getY() == 32 );
+
+    REQUIRE( packer.insert(8, 24, placement) );
+    REQUIRE( placement.getX() == 48 );
+    REQUIRE( placement.getY() == 0 );
+}
+
+TEST_CASE( "ShelfPacker/insert/refuses what does not fit", "Oversized or empty rectangles and rectangles for a full area are refused" ) {
+    hikari::ShelfPacker packer(32, 32);
+    hikari::Rectangle2D<int> placement;
+
+    REQUIRE_FALSE( packer.insert(33, 8, placement) );
+    REQUIRE_FALSE( packer.insert(8, 33, placement) );
+    REQUIRE_FALSE( packer.insert(0, 8, placement) );
+
+    std::vector< hikari::Rectangle2D<int> > placements;
+
+    for(int i = 0; i < 16; ++i) {
+        REQUIRE( packer.insert(8, 8, placement) );
+        placements.push_back(placement);
+    }
+
+    REQUIRE_FALSE( packer.insert(8, 8, placement) );
+    REQUIRE( packer.getOccupancy() == Approx(1.0f) );
+
+    for(std::size_t i = 0; i < placements.size(); ++i) {
+        for(std::size_t j = i + 1; j < placements.size(); ++j) {
+            const bool overlaps =
+                placements[i].getX() < placements[j].getX() + placements[j].getWidth() &&
+                placements[j].getX() < placements[i].getX() + placements[i].getWidth() &&
+                placements[i].getY() < placements[j].getY() + placements[j].getHeight() &&
+                placements[j].getY() < placements[i].getY() + placements[i].getHeight();
+
+            REQUIRE_FALSE( overlaps );
+        }
+    }
+}
@@ -0,0 +1,83 @@
+#include "catch.hpp"
+
+#include <hikari/core/util/SlotMap.hpp>
+
+#include <string>
+
+//
+// Tests for hikari::SlotMap
+//
+
+TEST_CASE( "SlotMap/insert/handles find their values", "Each inserted value can be found through its handle" ) {
+    hikari::SlotMap<std::string> map;
+
+    const hikari::SlotHandle first = map.insert("first");
+    const hikari::SlotHandle second = map.insert("second");
+
+    REQUIRE( map.size() == 2 );
+    REQUIRE( map.contains(first) );
+    REQUIRE( map.contains(second) );
+    REQUIRE( *map.get(first) == "first" );
+    REQUIRE( *map.get(second) == "second" );
+
+    REQUIRE( hikari::SlotHandle().isNull() );
+    REQUIRE_FALSE( first.isNull() );
+    REQUIRE_FALSE( map.contains(hikari::SlotHandle()) );
+}
+
+TEST_CASE( "SlotMap/remove/keeps values packed", "Removing moves the last value into the gap and other handles stay valid" ) {
+    hikari::SlotMap<int> map;
+
+    const hikari::SlotHandle a = map.insert(1);
+    const hikari::SlotHandle b = map.insert(2);
+    const hikari::SlotHandle c = map.insert(3);
+
+    REQUIRE( map.remove(a) );
+    REQUIRE_FALSE( map.remove(a) );
+
+    REQUIRE( map.size() == 2 );
+    REQUIRE( map.getValues()[0] == 3 );
+    REQUIRE( map.getValues()[1] == 2 );
+    REQUIRE( *map.get(b) == 2 );
+    REQUIRE( *map.get(c) == 3 );
+    REQUIRE_FALSE( map.get(a) );
+}
+
+TEST_CASE( "SlotMap/insert/stale handles don't find reused slots", "A slot's generation changes when it is reused" ) {
+    hikari::SlotMap<int> map;
+
+    const hikari::SlotHandle old = map.insert(1);
+    map.remove(old);
+
+    const hikari::SlotHandle reused = map.insert(2);
+
+    REQUIRE( reused.index == old.index );
+    REQUIRE( reused.generation != old.generation );
+    REQUIRE_FALSE( map.contains(old) );
+    REQUIRE( *map.get(reused) == 2 );
+}
+
+TEST_CASE( "SlotMap/clear/invalidates every handle", "Clearing empties the map and makes all handles stale" ) {
+    hikari::SlotMap<int> map;
+
+    const hikari::SlotHandle a = map.insert(1);
+    const hikari::SlotHandle b = map.insert(2);
+
+    map.clear();
+
+    REQUIRE( map.empty() );
+    REQUIRE_FALSE( map.contains(a) );
+    REQUIRE_FALSE( map.contains(b) );
+
+    const hikari::SlotHandle c = map.insert(3);
+    const hikari::SlotHandle d = map.insert(4);
+    int sum = 0;
+
+    for(auto it = std::begin(map), end = std::end(map); it != end; it++) {
+        sum += *it;
+    }
+
+    REQUIRE( sum == 7 );
+    REQUIRE( *map.get(c) == 3 );
+    REQUIRE( *map.get(d) == 4 );
+}
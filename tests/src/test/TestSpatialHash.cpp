@@ -0,0 +1,193 @@
+#include "catch.hpp"
+
+#include <hikari/core/geom/SpatialHash.hpp>
+#include <hikari/core/geom/BoundingBox.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+//
+// Tests for hikari::SpatialHash<T>
+//
+
+TEST_CASE( "SpatialHash/constructor/cell size", "SpatialHash uses the cell size it was given" ) {
+    hikari::SpatialHash<int> hash(32.0f);
+
+    REQUIRE( hash.getCellSize() == 32.0f );
+    REQUIRE( hash.size() == 0 );
+}
+
+TEST_CASE( "SpatialHash/constructor/invalid cell size", "SpatialHash falls back to a default cell size when given a non-positive one" ) {
+    hikari::SpatialHash<int> hash(0.0f);
+
+    REQUIRE( hash.getCellSize() > 0.0f );
+}
+
+TEST_CASE( "SpatialHash/update/inserts items", "Updating an unknown item inserts it" ) {
+    hikari::SpatialHash<int> hash(16.0f);
+
+    hash.update(1, hikari::BoundingBox<float>(0.0f, 0.0f, 8.0f, 8.0f));
+    hash.update(2, hikari::BoundingBox<float>(100.0f, 100.0f, 8.0f, 8.0f));
+
+    REQUIRE( hash.size() == 2 );
+    REQUIRE( hash.contains(1) );
+    REQUIRE( hash.contains(2) );
+    REQUIRE_FALSE( hash.contains(3) );
+}
+
+TEST_CASE( "SpatialHash/query/finds nearby items", "Querying returns items in overlapping cells only" ) {
+    hikari::SpatialHash<int> hash(16.0f);
+    std::vector<int> results;
+
+    hash.update(1, hikari::BoundingBox<float>(0.0f, 0.0f, 8.0f, 8.0f));
+    hash.update(2, hikari::BoundingBox<float>(100.0f, 100.0f, 8.0f, 8.0f));
+
+    hash.query(hikari::BoundingBox<float>(4.0f, 4.0f, 2.0f, 2.0f), results);
+
+    REQUIRE( results.size() == 1 );
+    REQUIRE( results[0] == 1 );
+}
+
+TEST_CASE( "SpatialHash/query/negative coordinates", "Items with negative coordinates can be found" ) {
+    hikari::SpatialHash<int> hash(16.0f);
+    std::vector<int> results;
+
+    hash.update(1, hikari::BoundingBox<float>(-40.0f, -40.0f, 8.0f, 8.0f));
+    hash.query(hikari::BoundingBox<float>(-36.0f, -36.0f, 1.0f, 1.0f), results);
+
+    REQUIRE( results.size() == 1 );
+
+    hash.query(hikari::BoundingBox<float>(4.0f, 4.0f, 1.0f, 1.0f), results);
+
+    REQUIRE( results.empty() );
+}
+
+TEST_CASE( "SpatialHash/query/no duplicates", "Items spanning several cells are reported once" ) {
+    hikari::SpatialHash<int> hash(16.0f);
+    std::vector<int> results;
+
+    hash.update(7, hikari::BoundingBox<float>(0.0f, 0.0f, 64.0f, 64.0f));
+    hash.query(hikari::BoundingBox<float>(0.0f, 0.0f, 64.0f, 64.0f), results);
+
+    REQUIRE( results.size() == 1 );
+    REQUIRE( results[0] == 7 );
+}
+
+TEST_CASE( "SpatialHash/update/moves items", "Updating an item moves it to its new cells" ) {
+    hikari::SpatialHash<int> hash(16.0f);
+    std::vector<int> results;
+
+    hash.update(1, hikari::BoundingBox<float>(0.0f, 0.0f, 8.0f, 8.0f));
+    hash.update(1, hikari::BoundingBox<float>(200.0f, 0.0f, 8.0f, 8.0f));
+
+    hash.query(hikari::BoundingBox<float>(0.0f, 0.0f, 8.0f, 8.0f), results);
+    REQUIRE( results.empty() );
+
+    hash.query(hikari::BoundingBox<float>(200.0f, 0.0f, 8.0f, 8.0f), results);
+    REQUIRE( results.size() == 1 );
+    REQUIRE( hash.size() == 1 );
+}
+
+TEST_CASE( "SpatialHash/remove", "Removed items are no longer returned by queries" ) {
+    hikari::SpatialHash<int> hash(16.0f);
+    std::vector<int> results;
+
+    hash.update(1, hikari::BoundingBox<float>(0.0f, 0.0f, 40.0f, 40.0f));
+    hash.remove(1);
+    hash.remove(42); // Not present; should be harmless
+
+    hash.query(hikari::BoundingBox<float>(0.0f, 0.0f, 40.0f, 40.0f), results);
+
+    REQUIRE( results.empty() );
+    REQUIRE( hash.size() == 0 );
+}
+
+TEST_CASE( "SpatialHash/query/touching edges", "Boxes that share an edge are considered candidates" ) {
+    hikari::SpatialHash<int> hash(16.0f);
+    std::vector<int> results;
+
+    hash.update(1, hikari::BoundingBox<float>(0.0f, 0.0f, 16.0f, 16.0f));
+    hash.query(hikari::BoundingBox<float>(16.0f, 0.0f, 8.0f, 8.0f), results);
+
+    REQUIRE( results.size() == 1 );
+}
+
+//
+// Stress benchmark; hidden from the default run. Use:
+//   tests "[benchmark]"
+//
+namespace {
+    std::vector<hikari::BoundingBox<float>> makeRandomBoxes(int count, float size, unsigned int seed) {
+        std::vector<hikari::BoundingBox<float>> boxes;
+        std::srand(seed);
+
+        for(int i = 0; i < count; ++i) {
+            const float x = static_cast<float>(std::rand() % 2048);
+            const float y = static_cast<float>(std::rand() % 960);
+            boxes.push_back(hikari::BoundingBox<float>(x, y, size, size));
+        }
+
+        return boxes;
+    }
+}
+
+TEST_CASE( "SpatialHash/benchmark/projectiles vs enemies", "[.][benchmark] Compares brute force and hashed overlap tests" ) {
+    const int enemyCount = 500;
+    const int projectileCount = 500;
+    const int frames = 60;
+
+    const auto enemies = makeRandomBoxes(enemyCount, 24.0f, 1);
+    const auto projectiles = makeRandomBoxes(projectileCount, 8.0f, 2);
+
+    typedef std::chrono::high_resolution_clock Clock;
+
+    std::size_t bruteHits = 0;
+    const auto bruteStart = Clock::now();
+
+    for(int frame = 0; frame < frames; ++frame) {
+        for(auto p = std::begin(projectiles); p != std::end(projectiles); ++p) {
+            for(auto e = std::begin(enemies); e != std::end(enemies); ++e) {
+                if(p->intersects(*e)) {
+                    bruteHits++;
+                }
+            }
+        }
+    }
+
+    const auto bruteEnd = Clock::now();
+
+    hikari::SpatialHash<int> hash(64.0f);
+    std::vector<int> candidates;
+    std::size_t hashedHits = 0;
+    const auto hashedStart = Clock::now();
+
+    for(int frame = 0; frame < frames; ++frame) {
+        for(int i = 0; i < enemyCount; ++i) {
+            hash.update(i, enemies[i]);
+        }
+
+        for(auto p = std::begin(projectiles); p != std::end(projectiles); ++p) {
+            hash.query(*p, candidates);
+
+            for(auto c = std::begin(candidates); c != std::end(candidates); ++c) {
+                if(p->intersects(enemies[*c])) {
+                    hashedHits++;
+                }
+            }
+        }
+    }
+
+    const auto hashedEnd = Clock::now();
+
+    const auto bruteMicros = std::chrono::duration_cast<std::chrono::microseconds>(bruteEnd - bruteStart).count();
+    const auto hashedMicros = std::chrono::duration_cast<std::chrono::microseconds>(hashedEnd - hashedStart).count();
+
+    std::cout << "SpatialHash benchmark (" << projectileCount << " projectiles x "
+              << enemyCount << " enemies, " << frames << " frames)" << std::endl;
+    std::cout << "  brute force: " << bruteMicros << " us (" << (bruteMicros / frames) << " us/frame)" << std::endl;
+    std::cout << "  spatial hash: " << hashedMicros << " us (" << (hashedMicros / frames) << " us/frame)" << std::endl;
+
+    REQUIRE( hashedHits == bruteHits );
+}
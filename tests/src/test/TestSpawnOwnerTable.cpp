@@ -0,0 +1,117 @@
+#include "catch.hpp"
+
+#include <hikari/client/game/SpawnOwnerTable.hpp>
+
+#include <memory>
+#include <vector>
+
+//
+// Tests for hikari::SpawnOwnerTable<T>
+//
+
+namespace {
+    /**
+     * Stands in for a Spawner: remembers which of its objects it was told
+     * about, and can spawn a replacement from inside its handler.
+     */
+    class Owner : public std::enable_shared_from_this<Owner> {
+    public:
+        std::vector<int> removed;
+        hikari::SpawnOwnerTable<Owner> * respawnInto;
+
+        Owner()
+            : removed()
+            , respawnInto(nullptr)
+        {
+        }
+
+        void onSpawnRemoved(int objectId) {
+            removed.push_back(objectId);
+
+            if(respawnInto) {
+                respawnInto->setOwner(objectId, shared_from_this());
+            }
+        }
+    };
+
+    typedef hikari::SpawnOwnerTable<Owner> OwnerTable;
+}
+
+TEST_CASE( "SpawnOwnerTable/notifyOwner/tells only the owner", "Removing a spawned object notifies the spawner that owns it and nobody else" ) {
+    OwnerTable table;
+    auto first = std::make_shared<Owner>();
+    auto second = std::make_shared<Owner>();
+
+    table.setOwner(1, first);
+    table.setOwner(2, second);
+    table.setOwner(3, first);
+
+    table.notifyOwner(3);
+
+    REQUIRE( first->removed.size() == 1 );
+    REQUIRE( first->removed[0] == 3 );
+    REQUIRE( second->removed.empty() );
+    REQUIRE( table.getSize() == 2 );
+}
+
+TEST_CASE( "SpawnOwnerTable/notifyOwner/tells the owner once", "An object's owner is forgotten once it has been told" ) {
+    OwnerTable table;
+    auto owner = std::make_shared<Owner>();
+
+    table.setOwner(1, owner);
+    table.notifyOwner(1);
+    table.notifyOwner(1);
+    table.notifyOwner(2);
+
+    REQUIRE( owner->removed.size() == 1 );
+    REQUIRE( table.getSize() == 0 );
+}
+
+TEST_CASE( "SpawnOwnerTable/notifyOwner/skips destroyed owners", "Owners are held weakly and aren't kept alive by the table" ) {
+    OwnerTable table;
+    std::weak_ptr<Owner> observer;
+
+    {
+        auto owner = std::make_shared<Owner>();
+        observer = owner;
+        table.setOwner(1, owner);
+    }
+
+    REQUIRE( observer.expired() );
+
+    table.notifyOwner(1);
+
+    REQUIRE( table.getSize() == 0 );
+}
+
+TEST_CASE( "SpawnOwnerTable/notifyOwner/allows respawning", "An owner can take ownership of the same ID again while it is being told" ) {
+    OwnerTable table;
+    auto owner = std::make_shared<Owner>();
+    owner->respawnInto = &table;
+
+    table.setOwner(7, owner);
+    table.notifyOwner(7);
+
+    REQUIRE( owner->removed.size() == 1 );
+    REQUIRE( table.getSize() == 1 );
+
+    owner->respawnInto = nullptr;
+    table.notifyOwner(7);
+
+    REQUIRE( owner->removed.size() == 2 );
+}
+
+TEST_CASE( "SpawnOwnerTable/clear/forgets every owner", "Clearing drops owners without telling them, as on a room change" ) {
+    OwnerTable table;
+    auto owner = std::make_shared<Owner>();
+
+    table.setOwner(1, owner);
+    table.setOwner(2, owner);
+    table.clear();
+
+    REQUIRE( table.getSize() == 0 );
+
+    table.notifyOwner(1);
+
+    REQUIRE( owner->removed.empty() );
+}
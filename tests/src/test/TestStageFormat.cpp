@@ -0,0 +1,269 @@
+#include "catch.hpp"
+
+#include <hikari/core/game/map/Force.hpp>
+#include <hikari/core/game/map/RoomBlueprint.hpp>
+#include <hikari/core/game/map/StageCompiler.hpp>
+#include <hikari/core/game/map/StageReader.hpp>
+#include <hikari/core/game/map/StageWriter.hpp>
+
+#include <json/reader.h>
+#include <json/value.h>
+
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+//
+// Tests for hikari::StageWriter, hikari::StageReader and hikari::StageCompiler
+//
+
+namespace {
+    hikari::StageInfo makeInfo() {
+        hikari::StageInfo info;
+        info.tilesetName = "assets/tilesets/test.json";
+        info.gridSize = 16;
+        info.musicName = "Test Stage";
+        info.bossEntity = "Test Boss";
+        info.startingRoomIndex = 1;
+        info.midpointRoomIndex = 2;
+        info.bossCorridorRoomIndex = 3;
+        info.bossChamberRoomIndex = 4;
+        return info;
+    }
+
+    hikari::RoomBlueprint makeRoom() {
+        hikari::RoomBlueprint room;
+
+        room.id = 7;
+        room.x = 10;
+        room.y = 20;
+        room.width = 3;
+        room.height = 2;
+        room.gridSize = 16;
+        room.backgroundColor = 0x112233;
+        room.heroSpawnPosition = hikari::Point2D<int>(40, 50);
+        room.cameraBounds = hikari::Rectangle2D<int>(160, 320, 256, 240);
+        room.bossEntity = "Test Boss";
+        room.tile = { 0, 1, 2, 3, 4, 5 };
+        room.attr = { 0, 1, 0, 257, 0, 9 };
+
+        room.transitions.push_back(hikari::RoomTransition(-1, 3, 1, 14, 16, 0, hikari::RoomTransition::DirectionForward, true, false));
+        room.transitions.push_back(hikari::RoomTransition(-1, 0, 2, 1, 4, 15, hikari::RoomTransition::DirectionDown, false, true));
+
+        room.forces.push_back(std::make_shared<hikari::Force>(
+            hikari::BoundingBox<float>(8.0f, 16.0f, 32.0f, 64.0f),
+            hikari::Vector2<float>(-0.5f, 0.25f)
+        ));
+
+        hikari::SpawnerBlueprint enemy;
+        enemy.type = "Telly";
+        enemy.position = hikari::Point2D<int>(24, 48);
+        enemy.direction = hikari::Directions::Left;
+        enemy.spawnLimit = 3;
+        enemy.spawnRate = 0.5f;
+        enemy.hasContinuous = true;
+        enemy.continuous = true;
+        enemy.hasConfig = true;
+        enemy.config["speed"] = 2;
+        room.enemies.push_back(enemy);
+
+        hikari::SpawnerBlueprint item;
+        item.type = "Large Health Energy";
+        item.position = hikari::Point2D<int>(8, 8);
+        room.items.push_back(item);
+
+        room.exitDoor.present = true;
+        room.exitDoor.x = 15;
+        room.exitDoor.y = 11;
+
+        std::vector<hikari::BlockTiming> timing;
+        timing.push_back(hikari::BlockTiming({ 0 }));
+        timing.push_back(hikari::BlockTiming({ 1, 2 }));
+
+        room.blockSequences.push_back(hikari::BlockSequenceDescriptor(
+            hikari::Rectangle2D<int>(160, 320, 64, 32),
+            { hikari::Point2D<int>(160, 320), hikari::Point2D<int>(176, 320), hikari::Point2D<int>(192, 320) },
+            timing,
+            1.5f,
+            2.0f,
+            "Appearing Block (Blue)",
+            "Disappearing Block"
+        ));
+
+        return room;
+    }
+
+    std::vector<char> writeStage() {
+        hikari::StageWriter writer(makeInfo());
+        hikari::RoomBlueprint empty;
+
+        empty.id = 0;
+        empty.x = 0;
+        empty.y = 0;
+        empty.width = 0;
+        empty.height = 0;
+        empty.backgroundColor = 0;
+
+        writer.addRoom(empty);
+        writer.addRoom(makeRoom());
+
+        return writer.write();
+    }
+
+    Json::Value parseMap() {
+        Json::Value json;
+        Json::Reader reader;
+
+        reader.parse(
+            "{ \"tileset\": \"assets/tilesets/test.json\", \"gridsize\": 16, \"musicName\": \"Test Stage\","
+            "  \"specialRooms\": { \"starting\": 1 },"
+            "  \"rooms\": ["
+            "    { \"id\": 0, \"x\": 0, \"y\": 0, \"width\": 1, \"height\": 1, \"tile\": [ 1 ], \"attr\": [ 0 ],"
+            "      \"cameraBounds\": { \"x\": 0, \"y\": 0, \"width\": 1, \"height\": 1 } },"
+            "    { \"id\": 1, \"x\": 10, \"y\": 20, \"width\": 2, \"height\": 1, \"tile\": [ 3, 4 ], \"attr\": [ 0, 9 ],"
+            "      \"heroSpawnX\": 40, \"heroSpawnY\": 50,"
+            "      \"cameraBounds\": { \"x\": 0, \"y\": 0, \"width\": 2, \"height\": 1 },"
+            "      \"transitions\": [ { \"to\": 0, \"x\": 0, \"y\": 0, \"width\": 1, \"height\": 1, \"direction\": \"backward\" } ],"
+            "      \"enemies\": [ { \"type\": \"Telly\", \"x\": 8, \"y\": 8, \"direction\": \"Left\", \"config\": { \"speed\": 2 } } ],"
+            "      \"doors\": { \"exit\": { \"x\": 1 } } }"
+            "  ] }",
+            json,
+            false
+        );
+
+        return json;
+    }
+}
+
+TEST_CASE( "StageFormat/round trip/stage info", "Map-wide properties survive a round trip" ) {
+    hikari::StageReader reader(writeStage());
+    const hikari::StageInfo & info = reader.getInfo();
+
+    REQUIRE( info.tilesetName == "assets/tilesets/test.json" );
+    REQUIRE( info.gridSize == 16 );
+    REQUIRE( info.musicName == "Test Stage" );
+    REQUIRE( info.bossEntity == "Test Boss" );
+    REQUIRE( info.startingRoomIndex == 1 );
+    REQUIRE( info.midpointRoomIndex == 2 );
+    REQUIRE( info.bossCorridorRoomIndex == 3 );
+    REQUIRE( info.bossChamberRoomIndex == 4 );
+    REQUIRE( reader.getRoomCount() == 2 );
+    REQUIRE( reader.getRoomRect(1).getX() == 160 );
+    REQUIRE( reader.getRoomRect(1).getY() == 320 );
+    REQUIRE( reader.getRoomRect(1).getWidth() == 48 );
+    REQUIRE( reader.getRoomRect(1).getHeight() == 32 );
+}
+
+TEST_CASE( "StageFormat/round trip/room", "Tiles and entity tables survive a round trip" ) {
+    hikari::StageReader reader(writeStage());
+    auto room = reader.readRoom(1);
+
+    REQUIRE( room->id == 7 );
+    REQUIRE( room->gridSize == 16 );
+    REQUIRE( room->backgroundColor == 0x112233 );
+    REQUIRE( room->heroSpawnPosition.getX() == 40 );
+    REQUIRE( room->cameraBounds.getX() == 160 );
+    REQUIRE( room->cameraBounds.getHeight() == 240 );
+    REQUIRE( room->bossEntity == "Test Boss" );
+    REQUIRE( room->tile.size() == 6 );
+    REQUIRE( room->tile[5] == 5 );
+    REQUIRE( room->attr[3] == 257 );
+
+    REQUIRE( room->transitions.size() == 2 );
+    REQUIRE( room->transitions[0].getToRegion() == 3 );
+    REQUIRE( room->transitions[0].isDoor() );
+    REQUIRE( room->transitions[1].isLadderOnly() );
+    REQUIRE( room->transitions[1].getDirection() == hikari::RoomTransition::DirectionDown );
+
+    REQUIRE( room->forces.size() == 1 );
+    REQUIRE( room->forces[0]->getBounds().getWidth() == 32.0f );
+    REQUIRE( room->forces[0]->getVelocity().getX() == -0.5f );
+
+    REQUIRE( room->enemies.size() == 1 );
+    REQUIRE( room->enemies[0].type == "Telly" );
+    REQUIRE( room->enemies[0].direction == hikari::Directions::Left );
+    REQUIRE( room->enemies[0].spawnLimit == 3 );
+    REQUIRE( room->enemies[0].continuous );
+    REQUIRE( room->enemies[0].hasConfig );
+    REQUIRE( room->enemies[0].config["speed"].asInt() == 2 );
+
+    REQUIRE( room->items.size() == 1 );
+    REQUIRE( room->items[0].type == "Large Health Energy" );
+    REQUIRE_FALSE( room->items[0].hasContinuous );
+    REQUIRE_FALSE( room->items[0].hasConfig );
+
+    REQUIRE_FALSE( room->entranceDoor.present );
+    REQUIRE( room->exitDoor.present );
+    REQUIRE( room->exitDoor.x == 15 );
+    REQUIRE( room->exitDoor.height == 3 );
+
+    REQUIRE( room->blockSequences.size() == 1 );
+    const auto & sequence = room->blockSequences[0];
+    REQUIRE( sequence.getBlockPositions().size() == 3 );
+    REQUIRE( sequence.getBlockPositions()[2].getX() == 192 );
+    REQUIRE( sequence.getTiming().size() == 2 );
+    REQUIRE( sequence.getTiming()[1].getBlockIndicies().size() == 2 );
+    REQUIRE( sequence.getEntityName() == "Appearing Block (Blue)" );
+    REQUIRE( sequence.getSpawnInterval() == 1.5f );
+}
+
+TEST_CASE( "StageFormat/reader/rejects bad data", "Foreign, outdated and truncated data is rejected" ) {
+    std::vector<char> wrongMagic = writeStage();
+    wrongMagic[0] = 'X';
+    REQUIRE_THROWS_AS( hikari::StageReader(std::move(wrongMagic)), const std::runtime_error & );
+
+    std::vector<char> wrongVersion = writeStage();
+    const std::uint32_t version = hikari::StageFormat::VERSION + 1;
+    std::memcpy(&wrongVersion[sizeof(hikari::StageFormat::MAGIC)], &version, sizeof(version));
+    REQUIRE_THROWS_AS( hikari::StageReader(std::move(wrongVersion)), const std::runtime_error & );
+
+    std::vector<char> truncated = writeStage();
+    truncated.resize(truncated.size() - 8);
+    REQUIRE_THROWS_AS( hikari::StageReader(std::move(truncated)), const std::runtime_error & );
+}
+
+TEST_CASE( "StageFormat/writer/rejects wide cells", "Tiles which don't fit in 16 bits can't be written" ) {
+    hikari::StageWriter writer(makeInfo());
+    hikari::RoomBlueprint room = makeRoom();
+    room.tile[0] = 70000;
+
+    REQUIRE_THROWS_AS( writer.addRoom(room), const std::runtime_error & );
+}
+
+TEST_CASE( "StageCompiler/compile/matches the JSON", "A compiled stage reads back the same rooms the JSON describes" ) {
+    const Json::Value json = parseMap();
+    const hikari::StageCompiler compiler;
+
+    hikari::StageReader reader(compiler.compile(json));
+    auto prepared = compiler.prepareRooms(json);
+
+    REQUIRE( reader.getInfo().tilesetName == "assets/tilesets/test.json" );
+    REQUIRE( reader.getInfo().startingRoomIndex == 1 );
+    REQUIRE( reader.getInfo().bossEntity == "None" );
+    REQUIRE( reader.getRoomCount() == prepared.size() );
+
+    auto room = reader.readRoom(1);
+
+    REQUIRE( room->id == prepared[1]->id );
+    REQUIRE( (room->tile == prepared[1]->tile) );
+    REQUIRE( (room->attr == prepared[1]->attr) );
+    REQUIRE( room->heroSpawnPosition.getX() == 40 );
+    REQUIRE( room->cameraBounds.getX() == 160 );
+    REQUIRE( room->cameraBounds.getWidth() == 32 );
+    REQUIRE( room->transitions.size() == 1 );
+    REQUIRE( room->transitions[0].getDirection() == hikari::RoomTransition::DirectionBackward );
+    REQUIRE( room->enemies.size() == 1 );
+    REQUIRE( room->enemies[0].direction == hikari::Directions::Left );
+    REQUIRE( room->enemies[0].config["speed"].asInt() == 2 );
+    REQUIRE( room->exitDoor.present );
+    REQUIRE( room->exitDoor.x == 1 );
+    REQUIRE_FALSE( room->entranceDoor.present );
+}
+
+TEST_CASE( "StageCompiler/compile/rejects invalid maps", "JSON which isn't a map can't be compiled" ) {
+    Json::Value json = parseMap();
+    json["rooms"] = "not a list of rooms";
+
+    REQUIRE_THROWS_AS( hikari::StageCompiler().compile(json), const std::runtime_error & );
+}
@@ -0,0 +1,64 @@
+#include "catch.hpp"
+
+#include <hikari/core/util/StringHash.hpp>
+
+#include <string>
+
+namespace {
+
+    constexpr hikari::StringHash FIRST = hikari::hashString("first");
+    constexpr hikari::StringHash SECOND = hikari::hashString("second");
+
+    int whichOne(hikari::StringHash hash) {
+        switch(hash) {
+            case FIRST:
+                return 1;
+            case SECOND:
+                return 2;
+            default:
+                return 0;
+        }
+    }
+
+}
+
+//
+// Tests for hikari::hashString
+//
+
+TEST_CASE( "StringHash/hashString/matches FNV-1a", "Hashes are 32-bit FNV-1a so they are the same everywhere" ) {
+    static_assert(hikari::hashString("") == 0x811c9dc5u, "The empty string hashes to the offset basis");
+
+    REQUIRE( hikari::hashString("a") == 0xe40c292cu );
+    REQUIRE( hikari::hashString("foobar") == 0xbf9cf968u );
+}
+
+TEST_CASE( "StringHash/hashString/runtime matches compile time", "Hashing a std::string gives the same value as a literal" ) {
+    const std::string name = "EntityDeathEventData";
+
+    REQUIRE( hikari::hashString(name) == hikari::hashString("EntityDeathEventData") );
+    REQUIRE( hikari::hashString(std::string()) == hikari::hashString("") );
+
+    // Bytes above 0x7f must not be sign-extended on the way in.
+    REQUIRE( hikari::hashString(std::string("\xe9t\xe9")) == hikari::hashString("\xe9t\xe9") );
+}
+
+TEST_CASE( "StringHash/hashString/usable as case labels", "Compile-time hashes can be switched on" ) {
+    REQUIRE( whichOne(hikari::hashString(std::string("first"))) == 1 );
+    REQUIRE( whichOne(hikari::hashString(std::string("second"))) == 2 );
+    REQUIRE( whichOne(hikari::hashString(std::string("third"))) == 0 );
+}
+
+TEST_CASE( "StringHash/findHashedString/falls back to hex", "Unknown hashes are shown as hexadecimal" ) {
+    REQUIRE( hikari::findHashedString(0x0000beefu) == "0x0000beef" );
+
+    const hikari::StringHash hash = hikari::rememberHashedString("RememberedName");
+
+    REQUIRE( hash == hikari::hashString("RememberedName") );
+
+#ifdef HIKARI_DEBUG_STRING_HASHES
+    REQUIRE( hikari::findHashedString(hash) == "RememberedName" );
+#else
+    REQUIRE( hikari::findHashedString(hash).size() == 10 );
+#endif // HIKARI_DEBUG_STRING_HASHES
+}
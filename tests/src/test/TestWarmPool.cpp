@@ -0,0 +1,111 @@
+#include "catch.hpp"
+
+#include <hikari/client/game/objects/WarmPool.hpp>
+
+#include <memory>
+#include <string>
+
+//
+// Tests for hikari::WarmPool<T>
+//
+
+namespace {
+    typedef hikari::WarmPool<std::string> StringPool;
+
+    /**
+     * Works like a ScriptedEnemyBrain: it takes a ready instance from the
+     * pool it shares with its prototype's other clones, creates one if there
+     * are none, and hands its instance back when it's destroyed.
+     */
+    class Borrower {
+    private:
+        std::shared_ptr<StringPool> pool;
+
+    public:
+        std::string instance;
+        bool created;
+
+        explicit Borrower(const std::shared_ptr<StringPool> & pool)
+            : pool(pool)
+            , instance()
+            , created(false)
+        {
+            if(!pool->take(instance)) {
+                instance = "new";
+                created = true;
+            }
+        }
+
+        ~Borrower() {
+            pool->give(instance);
+        }
+    };
+}
+
+TEST_CASE( "WarmPool/take/fails when empty", "Taking from an empty pool leaves the instance alone" ) {
+    StringPool pool(2);
+    std::string instance = "untouched";
+
+    REQUIRE_FALSE( pool.take(instance) );
+    REQUIRE( instance == "untouched" );
+    REQUIRE( pool.getSize() == 0 );
+    REQUIRE( pool.getCapacity() == 2 );
+}
+
+TEST_CASE( "WarmPool/take/returns the last instance given", "Instances come back out most recent first" ) {
+    StringPool pool(2);
+    std::string instance;
+
+    REQUIRE( pool.give("first") );
+    REQUIRE( pool.give("second") );
+
+    REQUIRE( pool.take(instance) );
+    REQUIRE( instance == "second" );
+    REQUIRE( pool.take(instance) );
+    REQUIRE( instance == "first" );
+    REQUIRE_FALSE( pool.take(instance) );
+}
+
+TEST_CASE( "WarmPool/give/refuses instances once full", "A full pool doesn't keep anything more" ) {
+    StringPool pool(2);
+
+    REQUIRE( pool.give("first") );
+    REQUIRE_FALSE( pool.isFull() );
+    REQUIRE( pool.give("second") );
+    REQUIRE( pool.isFull() );
+    REQUIRE_FALSE( pool.give("third") );
+    REQUIRE( pool.getSize() == 2 );
+
+    std::string instance;
+    pool.take(instance);
+
+    REQUIRE( instance == "second" );
+    REQUIRE_FALSE( pool.isFull() );
+}
+
+TEST_CASE( "WarmPool/sharing/instances move between owners", "Owners sharing a pool reuse each other's instances instead of creating more" ) {
+    auto pool = std::make_shared<StringPool>(1);
+
+    {
+        Borrower first(pool);
+
+        REQUIRE( first.created );
+
+        first.instance = "used";
+    }
+
+    REQUIRE( pool->getSize() == 1 );
+
+    {
+        Borrower second(pool);
+        Borrower third(pool);
+
+        REQUIRE_FALSE( second.created );
+        REQUIRE( second.instance == "used" );
+        REQUIRE( third.created );
+        REQUIRE( pool->getSize() == 0 );
+    }
+
+    // Only one of the two instances fits back in
+    REQUIRE( pool->getSize() == 1 );
+}
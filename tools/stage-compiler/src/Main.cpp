@@ -0,0 +1,61 @@
+#include "hikari/core/game/map/StageCompiler.hpp"
+
+#include <json/reader.h>
+#include <json/value.h>
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+//
+// Compiles a JSON map into a stage file that MapLoader can load directly.
+//
+// Usage: stage-compiler <map.json> <map.stage>
+//
+int main(int argc, char** argv) {
+    if(argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <map.json> <map.stage>" << std::endl;
+        return 1;
+    }
+
+    const std::string inputPath = argv[1];
+    const std::string outputPath = argv[2];
+
+    std::ifstream input(inputPath.c_str(), std::ios::binary);
+
+    if(!input) {
+        std::cerr << "Couldn't open \"" << inputPath << "\"." << std::endl;
+        return 1;
+    }
+
+    const std::string contents((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+
+    Json::Value json;
+    Json::Reader reader;
+
+    if(!reader.parse(contents, json, false)) {
+        std::cerr << "There was a problem parsing \"" << inputPath << "\". " << reader.getFormatedErrorMessages() << std::endl;
+        return 1;
+    }
+
+    std::vector<char> compiled;
+
+    try {
+        compiled = hikari::StageCompiler().compile(json);
+    } catch(std::runtime_error & ex) {
+        std::cerr << "Couldn't compile \"" << inputPath << "\": " << ex.what() << std::endl;
+        return 1;
+    }
+
+    std::ofstream output(outputPath.c_str(), std::ios::binary | std::ios::trunc);
+
+    if(!output.write(&compiled[0], static_cast<std::streamsize>(compiled.size()))) {
+        std::cerr << "Couldn't write \"" << outputPath << "\"." << std::endl;
+        return 1;
+    }
+
+    return 0;
+}